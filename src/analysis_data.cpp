@@ -0,0 +1,293 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// analysis_data.cpp - 求解分析数据解析实现
+
+#include "analysis_data.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QJsonDocument>
+#include <QCryptographicHash>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+const char* const kTimeStageKeys[kTimeStageCount] = {
+    "data_loading",
+    "network_building",
+    "heuristic",
+    "root_cg",
+    "branch_and_price",
+    "output"
+};
+
+const char* const kTimeStageNames[kTimeStageCount] = {
+    "数据读取",
+    "网络构建",
+    "启发式",
+    "根节点CG",
+    "分支定价",
+    "导出"
+};
+
+const double kTargetGaps[kTargetGapCount] = {0.10, 0.05, 0.01};
+
+const char* const kAnytimeColumnKeys[kAnytimeColumnCount] = {
+    "reference",
+    "horizon",
+    "primal_integral",
+    "dual_integral",
+    "primal_dual_integral",
+    "time_to_first_incumbent",
+    "time_to_gap_0.1",
+    "time_to_gap_0.05",
+    "time_to_gap_0.01"
+};
+
+void AnytimeColumnValues(const AnytimeMetrics& metrics, double values[kAnytimeColumnCount]) {
+    values[0] = metrics.reference;
+    values[1] = metrics.horizon;
+    values[2] = metrics.primal_integral;
+    values[3] = metrics.dual_integral;
+    values[4] = metrics.primal_dual_integral;
+    values[5] = metrics.time_to_first_incumbent;
+    for (int k = 0; k < kTargetGapCount; k++) {
+        values[6 + k] = metrics.time_to_target[k];
+    }
+}
+
+namespace {
+
+bool IsValidUpperBound(double ub) {
+    return ub >= 0 && ub < 1e10;
+}
+
+bool IsValidLowerBound(double lb) {
+    return lb >= 0;
+}
+
+}  // namespace
+
+NodeStatusCode ParseNodeStatus(const QString& status) {
+    if (status == "branched") return NodeStatusCode::kBranched;
+    if (status == "pruned") return NodeStatusCode::kPruned;
+    if (status == "infeasible") return NodeStatusCode::kInfeasible;
+    if (status == "integer") return NodeStatusCode::kInteger;
+    if (status == "active") return NodeStatusCode::kActive;
+    return NodeStatusCode::kOther;
+}
+
+BranchTypeCode ParseBranchType(const QString& branch_type) {
+    if (branch_type.isEmpty() || branch_type == "none") return BranchTypeCode::kNone;
+    if (branch_type == "sp1_arc") return BranchTypeCode::kSp1Arc;
+    if (branch_type == "sp2_arc") return BranchTypeCode::kSp2Arc;
+    return BranchTypeCode::kOther;
+}
+
+std::vector<ConvergencePoint> ParseConvergence(const QJsonArray& convergence) {
+    std::vector<ConvergencePoint> points;
+    points.reserve(convergence.size());
+
+    for (const QJsonValue& val : convergence) {
+        QJsonObject ev = val.toObject();
+
+        ConvergencePoint point;
+        point.time = ev["time"].toDouble();
+        point.event = ev["event"].toString();
+        point.node_id = ev["node_id"].toInt(-1);
+        point.lb = ev["lb"].toDouble(-1);
+        point.ub = ev["ub"].toDouble(-1);
+        points.push_back(point);
+    }
+
+    return points;
+}
+
+std::vector<NodeData> ParseNodes(const QJsonArray& nodes) {
+    std::vector<NodeData> result;
+    result.reserve(nodes.size());
+
+    for (const QJsonValue& val : nodes) {
+        QJsonObject node_obj = val.toObject();
+        NodeData node;
+        node.id = node_obj["id"].toInt();
+        node.parent_id = node_obj["parent_id"].toInt();
+        node.depth = node_obj["depth"].toInt();
+        node.lower_bound = node_obj["lower_bound"].toDouble(-1);
+        node.status = node_obj["status"].toString();
+        node.branch_type = node_obj["branch_type"].toString();
+        node.branch_dir = node_obj["branch_dir"].toString();
+        node.cg_iterations = node_obj["cg_iterations"].toInt();
+        node.final_y_cols = node_obj["final_y_cols"].toInt();
+        node.final_x_cols = node_obj["final_x_cols"].toInt();
+        node.is_integer = node_obj["is_integer"].toBool();
+
+        result.push_back(node);
+    }
+
+    return result;
+}
+
+TimeBreakdown ParseTimeBreakdown(const QJsonObject& time_breakdown) {
+    TimeBreakdown time;
+    for (int i = 0; i < kTimeStageCount; i++) {
+        time.stages[i] = time_breakdown[kTimeStageKeys[i]].toDouble();
+    }
+    time.total = time_breakdown["total"].toDouble();
+    return time;
+}
+
+double RelativeGap(double a, double b) {
+    double scale = std::max(std::abs(a), std::abs(b));
+    if (scale < 1e-12) return 0.0;
+    if (a * b < 0) return 1.0;
+    return std::min(1.0, std::abs(a - b) / scale);
+}
+
+AnytimeMetrics ComputeAnytimeMetrics(const std::vector<ConvergencePoint>& convergence,
+                                     double reference, double horizon) {
+    AnytimeMetrics metrics;
+
+    // 按时间排序的事件下标 (文件中一般已有序, 此处不做假设)
+    std::vector<size_t> order(convergence.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return convergence[a].time < convergence[b].time;
+    });
+
+    if (reference <= 0) {
+        for (const auto& point : convergence) {
+            if (IsValidUpperBound(point.ub) && (reference <= 0 || point.ub < reference)) {
+                reference = point.ub;
+            }
+        }
+    }
+    if (reference <= 0) return metrics;
+
+    double end_time = std::max(0.0, horizon);
+    if (!order.empty()) {
+        end_time = std::max(end_time, convergence[order.back()].time);
+    }
+
+    metrics.valid = true;
+    metrics.reference = reference;
+    metrics.horizon = end_time;
+
+    double ub = std::numeric_limits<double>::infinity();
+    double lb = -std::numeric_limits<double>::infinity();
+    double prev_time = 0.0;
+
+    // 差距函数在相邻事件之间为常数, 积分即分段求和
+    auto accumulate = [&](double until) {
+        double dt = until - prev_time;
+        if (dt <= 0) return;
+        bool has_ub = std::isfinite(ub);
+        bool has_lb = std::isfinite(lb);
+        metrics.primal_integral += dt * (has_ub ? RelativeGap(ub, reference) : 1.0);
+        metrics.dual_integral += dt * (has_lb ? RelativeGap(lb, reference) : 1.0);
+        metrics.primal_dual_integral += dt * (has_ub && has_lb ? RelativeGap(ub, lb) : 1.0);
+        prev_time = until;
+    };
+
+    for (size_t index : order) {
+        const ConvergencePoint& point = convergence[index];
+        double t = std::clamp(point.time, prev_time, end_time);
+        accumulate(t);
+
+        if (IsValidUpperBound(point.ub) && point.ub < ub) {
+            ub = point.ub;
+            if (metrics.time_to_first_incumbent < 0) {
+                metrics.time_to_first_incumbent = t;
+            }
+            double gap = RelativeGap(ub, reference);
+            for (int k = 0; k < kTargetGapCount; k++) {
+                if (metrics.time_to_target[k] < 0 && gap <= kTargetGaps[k] + 1e-12) {
+                    metrics.time_to_target[k] = t;
+                }
+            }
+        }
+        if (IsValidLowerBound(point.lb) && point.lb > lb) {
+            lb = point.lb;
+        }
+    }
+    accumulate(end_time);
+
+    return metrics;
+}
+
+QString ExtractInstanceKey(const QJsonObject& root) {
+    // 显式算例名
+    for (const char* key : {"instance", "instance_name", "data_file"}) {
+        QJsonValue val = root[key];
+        if (val.isString() && !val.toString().isEmpty()) {
+            return QFileInfo(val.toString()).completeBaseName();
+        }
+        if (val.isObject()) {
+            QString name = val.toObject()["name"].toString();
+            if (!name.isEmpty()) return name;
+        }
+    }
+
+    // 签名: 母板尺寸 + 子板类型数 + 子板类型内容摘要
+    QJsonObject stock = root["stock"].toObject();
+    QJsonArray item_types = root["item_types"].toArray();
+    QByteArray digest = QCryptographicHash::hash(
+        QJsonDocument(item_types).toJson(QJsonDocument::Compact),
+        QCryptographicHash::Md5).toHex().left(8);
+
+    return QString("%1x%2_n%3_%4")
+        .arg(stock["width"].toInt())
+        .arg(stock["length"].toInt())
+        .arg(item_types.size())
+        .arg(QString::fromLatin1(digest));
+}
+
+RunSummary LoadRunSummary(const QString& json_path) {
+    RunSummary run;
+    run.file_path = json_path;
+    run.config_label = QFileInfo(json_path).absoluteDir().dirName();
+
+    QFile file(json_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        run.error = QString::fromUtf8("无法打开文件");
+        return run;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    file.close();
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        run.error = QString::fromUtf8("JSON 解析错误: ") + error.errorString();
+        return run;
+    }
+
+    QJsonObject root = doc.object();
+    run.instance_key = ExtractInstanceKey(root);
+
+    QJsonObject summary = root["summary"].toObject();
+    run.solve_status = summary["solve_status"].toString("unknown");
+    run.objective_value = summary["objective_value"].toDouble();
+    run.heuristic_value = summary["heuristic_value"].toDouble();
+    run.root_lb = summary["root_lb"].toDouble();
+    run.final_lb = summary["final_lb"].toDouble();
+    run.gap = summary["gap"].toDouble();
+    run.total_nodes = summary["total_nodes"].toInt();
+    run.pruned_nodes = summary["pruned_nodes"].toInt();
+    run.infeasible_nodes = summary["infeasible_nodes"].toInt();
+    run.integer_nodes = summary["integer_nodes"].toInt();
+
+    run.time = ParseTimeBreakdown(root["time_breakdown"].toObject());
+    run.convergence = ParseConvergence(root["convergence"].toArray());
+    run.anytime = ComputeAnytimeMetrics(run.convergence, run.objective_value, run.time.total);
+
+    // bp_tree 节点表不保留, 随 doc 一起释放
+    run.loaded = true;
+    return run;
+}
@@ -0,0 +1,145 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// analysis_data.h - 求解分析数据结构与解析
+// 包含: 收敛事件、分支定价树节点、时间统计、单次运行概要
+// (不依赖界面, 可在后台线程使用)
+
+#ifndef ANALYSIS_DATA_H_
+#define ANALYSIS_DATA_H_
+
+#include <QString>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <vector>
+
+// 收敛事件数据
+struct ConvergencePoint {
+    double time;
+    QString event;
+    int node_id;
+    double lb;
+    double ub;
+};
+
+// 节点数据
+struct NodeData {
+    int id;
+    int parent_id;
+    int depth;
+    double lower_bound;
+    QString status;
+    QString branch_type;
+    QString branch_dir;
+    int cg_iterations;
+    int final_y_cols;
+    int final_x_cols;
+    bool is_integer;
+};
+
+// 节点状态编码 (过滤、统计与着色时避免逐行比较字符串)
+enum class NodeStatusCode : unsigned char {
+    kOther,
+    kBranched,
+    kPruned,
+    kInfeasible,
+    kInteger,
+    kActive
+};
+constexpr int kNodeStatusCodeCount = 6;
+
+// 分支类型编码
+enum class BranchTypeCode : unsigned char {
+    kNone,      // 根节点或未分支
+    kSp1Arc,
+    kSp2Arc,
+    kOther
+};
+constexpr int kBranchTypeCodeCount = 4;
+
+NodeStatusCode ParseNodeStatus(const QString& status);
+BranchTypeCode ParseBranchType(const QString& branch_type);
+
+// 时间统计阶段 (与 JSON time_breakdown 的键一一对应)
+constexpr int kTimeStageCount = 6;
+extern const char* const kTimeStageKeys[kTimeStageCount];
+extern const char* const kTimeStageNames[kTimeStageCount];  // UTF-8 中文名
+
+struct TimeBreakdown {
+    double stages[kTimeStageCount] = {};
+    double total = 0.0;
+};
+
+// 随时性能指标 (Berthold 原始积分等, 由收敛事件计算)
+// 相对差距 gap(a, b) = |a - b| / max(|a|, |b|), 异号时取 1; 尚无上界/下界的时段差距记为 1
+constexpr int kTargetGapCount = 3;
+extern const double kTargetGaps[kTargetGapCount];   // 10%, 5%, 1%
+
+struct AnytimeMetrics {
+    bool valid = false;
+    double reference = 0.0;                 // 参考最优值 (最优解或已知最好解)
+    double horizon = 0.0;                   // 积分区间 [0, horizon] (秒)
+    double primal_integral = 0.0;           // ∫ gap(上界, 参考值) dt
+    double dual_integral = 0.0;             // ∫ gap(下界, 参考值) dt
+    double primal_dual_integral = 0.0;      // ∫ gap(上界, 下界) dt
+    double time_to_first_incumbent = -1.0;  // -1 表示未找到可行解
+    double time_to_target[kTargetGapCount] = {-1.0, -1.0, -1.0};  // 上界进入参考值 X% 以内的时间
+};
+
+// 随时性能指标的导出列 (多解对比 CSV 与分析数据导出共用同一列名与顺序)
+constexpr int kAnytimeColumnCount = 6 + kTargetGapCount;
+extern const char* const kAnytimeColumnKeys[kAnytimeColumnCount];
+void AnytimeColumnValues(const AnytimeMetrics& metrics, double values[kAnytimeColumnCount]);
+
+// 单次运行概要 (不含节点表, 用于多解对比)
+struct RunSummary {
+    QString file_path;
+    QString instance_key;   // 算例标识 (用于对齐)
+    QString config_label;   // 配置标签 (默认取所在目录名)
+    bool loaded = false;
+    QString error;
+
+    QString solve_status;
+    double objective_value = 0.0;
+    double heuristic_value = 0.0;
+    double root_lb = 0.0;
+    double final_lb = 0.0;
+    double gap = 0.0;
+    int total_nodes = 0;
+    int pruned_nodes = 0;
+    int infeasible_nodes = 0;
+    int integer_nodes = 0;
+
+    TimeBreakdown time;
+    std::vector<ConvergencePoint> convergence;
+    AnytimeMetrics anytime;
+
+    // 解文件含切割方案时按机器参数模拟的加工时间 (LoadRunSummary 不计算, 由多解对比在后台另行填入)
+    bool has_machine_time = false;
+    long long sheet_count = 0;
+    double machine_hours = 0.0;
+};
+
+// 解析函数
+std::vector<ConvergencePoint> ParseConvergence(const QJsonArray& convergence);
+std::vector<NodeData> ParseNodes(const QJsonArray& nodes);
+TimeBreakdown ParseTimeBreakdown(const QJsonObject& time_breakdown);
+
+// 计算随时性能指标
+// reference <= 0 时取收敛事件中的最好上界; horizon 不足最后事件时间时延长到最后事件
+double RelativeGap(double a, double b);
+AnytimeMetrics ComputeAnytimeMetrics(const std::vector<ConvergencePoint>& convergence,
+                                     double reference, double horizon);
+
+// 算例标识: 优先使用 JSON 中的算例名, 否则由母板尺寸与子板类型生成签名
+QString ExtractInstanceKey(const QJsonObject& root);
+
+// 读取解文件概要 (线程安全; 解析后立即释放 JSON 文档与节点表)
+RunSummary LoadRunSummary(const QString& json_path);
+
+#endif  // ANALYSIS_DATA_H_
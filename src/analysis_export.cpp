@@ -0,0 +1,522 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// analysis_export.cpp - 分析数据导出实现
+// 数值格式化使用 std::to_chars 写入字节缓冲区, 按块写盘, 不为每行构造 QString
+
+#include "analysis_export.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QHash>
+#include <QElapsedTimer>
+#include <QtEndian>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace {
+
+constexpr size_t kWriteBufferSize = 1 << 20;
+constexpr char kBinaryMagic[8] = {'C', 'S', '2', 'D', 'A', 'N', 'A', '1'};
+constexpr quint32 kBinaryVersion = 1;
+
+// 分类列取值名称 (顺序与编码一致)
+const char* const kStatusLabels[kNodeStatusCodeCount] = {
+    "other", "branched", "pruned", "infeasible", "integer", "active"
+};
+const char* const kBranchTypeLabels[kBranchTypeCodeCount] = {
+    "none", "sp1_arc", "sp2_arc", "other"
+};
+const char* const kBranchDirLabels[3] = {"none", "left", "right"};
+
+// 收敛事件列 (事件名编码为字典下标)
+struct ConvergenceColumns {
+    std::vector<double> time;
+    std::vector<unsigned char> event;
+    std::vector<int> node_id;
+    std::vector<double> lb;
+    std::vector<double> ub;
+    std::vector<QByteArray> event_labels;
+};
+
+ConvergenceColumns BuildConvergenceColumns(const std::vector<ConvergencePoint>& points) {
+    ConvergenceColumns columns;
+    size_t n = points.size();
+    columns.time.resize(n);
+    columns.event.resize(n);
+    columns.node_id.resize(n);
+    columns.lb.resize(n);
+    columns.ub.resize(n);
+
+    QHash<QString, int> codes;
+    for (size_t i = 0; i < n; i++) {
+        const ConvergencePoint& point = points[i];
+        auto it = codes.constFind(point.event);
+        int code;
+        if (it != codes.constEnd()) {
+            code = it.value();
+        } else if (columns.event_labels.size() < 255) {
+            code = static_cast<int>(columns.event_labels.size());
+            codes.insert(point.event, code);
+            columns.event_labels.push_back(point.event.toUtf8());
+        } else {
+            code = 255;     // 超出字典容量的事件统一记为 other
+            if (columns.event_labels.size() == 255) columns.event_labels.push_back("other");
+        }
+        columns.time[i] = point.time;
+        columns.event[i] = static_cast<unsigned char>(code);
+        columns.node_id[i] = point.node_id;
+        columns.lb[i] = point.lb;
+        columns.ub[i] = point.ub;
+    }
+    return columns;
+}
+
+// ----------------------------------------------------------------------------
+// CSV
+// ----------------------------------------------------------------------------
+
+class CsvWriter {
+public:
+    explicit CsvWriter(QFile* file) : file_(file) {
+        buffer_.reserve(kWriteBufferSize + 4096);
+    }
+
+    void Text(const char* text) { buffer_.append(text); }
+
+    // 字符串字段: 含逗号、引号或换行时加引号, 内部引号加倍 (RFC 4180)
+    void Quoted(const char* text) { Quoted(text, std::strlen(text)); }
+    void Quoted(const QByteArray& text) { Quoted(text.constData(), static_cast<size_t>(text.size())); }
+
+    void Quoted(const char* text, size_t size) {
+        std::string_view view(text, size);
+        if (view.find_first_of(",\"\r\n") == std::string_view::npos) {
+            buffer_.append(text, size);
+            return;
+        }
+        buffer_.push_back('"');
+        for (char c : view) {
+            if (c == '"') buffer_.push_back('"');
+            buffer_.push_back(c);
+        }
+        buffer_.push_back('"');
+    }
+
+    void Int(long long value) {
+        char tmp[24];
+        auto result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        buffer_.append(tmp, result.ptr - tmp);
+    }
+
+    // 最短往返表示 (读回后与原值完全相同)
+    void Double(double value) {
+        char tmp[32];
+        auto result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        buffer_.append(tmp, result.ptr - tmp);
+    }
+
+    void Sep() { buffer_.push_back(','); }
+
+    void EndRow() {
+        buffer_.push_back('\n');
+        if (buffer_.size() >= kWriteBufferSize) Flush();
+    }
+
+    bool Flush() {
+        if (!buffer_.empty()) {
+            qint64 size = static_cast<qint64>(buffer_.size());
+            if (file_->write(buffer_.data(), size) != size) ok_ = false;
+            buffer_.clear();
+        }
+        return ok_;
+    }
+
+private:
+    QFile* file_;
+    std::string buffer_;
+    bool ok_ = true;
+};
+
+bool WriteNodesCsv(const NodeColumns& nodes, const QString& path, QString* error) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+
+    CsvWriter out(&file);
+    out.Text("id,parent_id,depth,lower_bound,status,branch_type,branch_dir,"
+             "cg_iterations,final_y_cols,final_x_cols,is_integer");
+    out.EndRow();
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        out.Int(nodes.id[i]);                                          out.Sep();
+        out.Int(nodes.parent_id[i]);                                   out.Sep();
+        out.Int(nodes.depth[i]);                                       out.Sep();
+        out.Double(nodes.lower_bound[i]);                              out.Sep();
+        out.Quoted(kStatusLabels[static_cast<int>(nodes.status[i])]);  out.Sep();
+        out.Quoted(kBranchTypeLabels[static_cast<int>(nodes.branch_type[i])]); out.Sep();
+        out.Quoted(kBranchDirLabels[nodes.branch_dir[i]]);             out.Sep();
+        out.Int(nodes.cg_iterations[i]);                               out.Sep();
+        out.Int(nodes.y_cols[i]);                                      out.Sep();
+        out.Int(nodes.x_cols[i]);                                      out.Sep();
+        out.Int(nodes.is_integer[i]);
+        out.EndRow();
+    }
+
+    if (!out.Flush()) {
+        *error = QString::fromUtf8("写入失败: ") + path;
+        return false;
+    }
+    return true;
+}
+
+bool WriteConvergenceCsv(const ConvergenceColumns& conv, const QString& path, QString* error) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+
+    CsvWriter out(&file);
+    out.Text("time,event,node_id,lb,ub");
+    out.EndRow();
+
+    for (size_t i = 0; i < conv.time.size(); i++) {
+        out.Double(conv.time[i]);                     out.Sep();
+        out.Quoted(conv.event_labels[conv.event[i]]); out.Sep();
+        out.Int(conv.node_id[i]);                     out.Sep();
+        out.Double(conv.lb[i]);                       out.Sep();
+        out.Double(conv.ub[i]);
+        out.EndRow();
+    }
+
+    if (!out.Flush()) {
+        *error = QString::fromUtf8("写入失败: ") + path;
+        return false;
+    }
+    return true;
+}
+
+bool WriteTimeCsv(const TimeBreakdown& time, const QString& path, QString* error) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+
+    CsvWriter out(&file);
+    out.Text("stage,seconds");
+    out.EndRow();
+    for (int i = 0; i < kTimeStageCount; i++) {
+        out.Text(kTimeStageKeys[i]);
+        out.Sep();
+        out.Double(time.stages[i]);
+        out.EndRow();
+    }
+    out.Text("total");
+    out.Sep();
+    out.Double(time.total);
+    out.EndRow();
+
+    if (!out.Flush()) {
+        *error = QString::fromUtf8("写入失败: ") + path;
+        return false;
+    }
+    return true;
+}
+
+// 单行宽表, 列与多解对比 CSV 的随时性能指标列相同; 指标无效时各列为空
+bool WriteAnytimeCsv(const AnytimeMetrics& anytime, const QString& path, QString* error) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+
+    CsvWriter out(&file);
+    double values[kAnytimeColumnCount];
+    AnytimeColumnValues(anytime, values);
+    for (int i = 0; i < kAnytimeColumnCount; i++) {
+        if (i > 0) out.Sep();
+        out.Text(kAnytimeColumnKeys[i]);
+    }
+    out.EndRow();
+    for (int i = 0; i < kAnytimeColumnCount; i++) {
+        if (i > 0) out.Sep();
+        if (anytime.valid) out.Double(values[i]);
+    }
+    out.EndRow();
+
+    if (!out.Flush()) {
+        *error = QString::fromUtf8("写入失败: ") + path;
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// 列式二进制
+// ----------------------------------------------------------------------------
+
+enum ColumnType : quint8 {
+    kColumnInt32 = 1,
+    kColumnFloat64 = 2,
+    kColumnUInt8 = 3
+};
+
+struct ColumnSpec {
+    QByteArray name;
+    ColumnType type;
+    const void* data;
+    std::vector<QByteArray> labels;
+};
+
+struct TableSpec {
+    QByteArray name;
+    quint64 rows;
+    std::vector<ColumnSpec> columns;
+};
+
+size_t ElementSize(ColumnType type) {
+    switch (type) {
+        case kColumnInt32:   return 4;
+        case kColumnFloat64: return 8;
+        case kColumnUInt8:   return 1;
+    }
+    return 1;
+}
+
+template <typename T>
+void AppendLittleEndian(QByteArray& out, T value) {
+    T le = qToLittleEndian(value);
+    out.append(reinterpret_cast<const char*>(&le), sizeof(le));
+}
+
+void AppendName(QByteArray& out, const QByteArray& name) {
+    AppendLittleEndian<quint16>(out, static_cast<quint16>(name.size()));
+    out.append(name);
+}
+
+std::vector<QByteArray> MakeLabels(const char* const* labels, int count) {
+    std::vector<QByteArray> result;
+    result.reserve(count);
+    for (int i = 0; i < count; i++) result.emplace_back(labels[i]);
+    return result;
+}
+
+// 写一列数据; 小端主机直接写内存, 大端主机分块转换字节序
+bool WriteColumnData(QFile& file, const ColumnSpec& column, quint64 rows) {
+    size_t element = ElementSize(column.type);
+    qint64 bytes = static_cast<qint64>(rows * element);
+
+    if (Q_BYTE_ORDER == Q_LITTLE_ENDIAN || element == 1) {
+        return file.write(static_cast<const char*>(column.data), bytes) == bytes;
+    }
+
+    constexpr size_t kChunkRows = 65536;
+    std::vector<char> buffer(kChunkRows * element);
+    const char* src = static_cast<const char*>(column.data);
+    for (quint64 begin = 0; begin < rows; begin += kChunkRows) {
+        size_t count = static_cast<size_t>(std::min<quint64>(kChunkRows, rows - begin));
+        const char* chunk = src + begin * element;
+        if (column.type == kColumnInt32) {
+            qToLittleEndian<qint32>(chunk, static_cast<qsizetype>(count), buffer.data());
+        } else {
+            qToLittleEndian<quint64>(chunk, static_cast<qsizetype>(count), buffer.data());
+        }
+        qint64 chunk_bytes = static_cast<qint64>(count * element);
+        if (file.write(buffer.data(), chunk_bytes) != chunk_bytes) return false;
+    }
+    return true;
+}
+
+bool WriteBinary(const std::vector<TableSpec>& tables, const QString& path, QString* error) {
+    // 文件头 (数据偏移先占位, 头部长度确定后回填)
+    QByteArray header;
+    header.append(kBinaryMagic, sizeof(kBinaryMagic));
+    AppendLittleEndian<quint32>(header, kBinaryVersion);
+    AppendLittleEndian<quint32>(header, static_cast<quint32>(tables.size()));
+
+    std::vector<int> offset_positions;
+    for (const TableSpec& table : tables) {
+        AppendName(header, table.name);
+        AppendLittleEndian<quint64>(header, table.rows);
+        AppendLittleEndian<quint32>(header, static_cast<quint32>(table.columns.size()));
+        for (const ColumnSpec& column : table.columns) {
+            AppendName(header, column.name);
+            AppendLittleEndian<quint8>(header, column.type);
+            AppendLittleEndian<quint16>(header, static_cast<quint16>(column.labels.size()));
+            for (const QByteArray& label : column.labels) {
+                AppendName(header, label);
+            }
+            offset_positions.push_back(static_cast<int>(header.size()));
+            AppendLittleEndian<quint64>(header, 0);
+            AppendLittleEndian<quint64>(header, table.rows * ElementSize(column.type));
+        }
+    }
+
+    auto align8 = [](quint64 value) { return (value + 7) & ~quint64(7); };
+    quint64 offset = align8(static_cast<quint64>(header.size()));
+    size_t position_index = 0;
+    for (const TableSpec& table : tables) {
+        for (const ColumnSpec& column : table.columns) {
+            qToLittleEndian<quint64>(offset, header.data() + offset_positions[position_index++]);
+            offset = align8(offset + table.rows * ElementSize(column.type));
+        }
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+
+    bool ok = file.write(header) == header.size();
+    static const char kPadding[8] = {};
+    quint64 written = static_cast<quint64>(header.size());
+    for (const TableSpec& table : tables) {
+        for (const ColumnSpec& column : table.columns) {
+            if (!ok) break;
+            quint64 padding = align8(written) - written;
+            if (padding > 0) {
+                ok = file.write(kPadding, static_cast<qint64>(padding)) == static_cast<qint64>(padding);
+            }
+            ok = ok && WriteColumnData(file, column, table.rows);
+            written = align8(written) + table.rows * ElementSize(column.type);
+        }
+    }
+
+    file.close();
+    if (!ok) {
+        *error = QString::fromUtf8("写入失败: ") + path;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+AnalysisExportFormat AnalysisExportFormatFromPath(const QString& path) {
+    return path.endsWith(".csv", Qt::CaseInsensitive) ?
+        AnalysisExportFormat::kCsv : AnalysisExportFormat::kBinary;
+}
+
+bool LoadAnalysisExportData(const QString& json_path, AnalysisExportData* data, QString* error) {
+    QFile file(json_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        *error = QString::fromUtf8("无法打开文件: ") + json_path;
+        return false;
+    }
+
+    QJsonParseError parse_error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parse_error);
+    file.close();
+    if (parse_error.error != QJsonParseError::NoError || !doc.isObject()) {
+        *error = QString::fromUtf8("JSON 解析错误: ") + parse_error.errorString();
+        return false;
+    }
+
+    QJsonObject root = doc.object();
+    data->nodes = BuildNodeColumns(ParseNodes(root["bp_tree"].toObject()["nodes"].toArray()));
+    data->convergence = ParseConvergence(root["convergence"].toArray());
+    data->time = ParseTimeBreakdown(root["time_breakdown"].toObject());
+    data->anytime = ComputeAnytimeMetrics(data->convergence,
+                                          root["summary"].toObject()["objective_value"].toDouble(),
+                                          data->time.total);
+    return true;
+}
+
+AnalysisExportResult ExportAnalysisData(const AnalysisExportData& data,
+                                        const QString& path,
+                                        AnalysisExportFormat format) {
+    AnalysisExportResult result;
+    QElapsedTimer timer;
+    timer.start();
+
+    ConvergenceColumns conv = BuildConvergenceColumns(data.convergence);
+
+    if (format == AnalysisExportFormat::kCsv) {
+        QFileInfo info(path);
+        QString base = info.dir().filePath(info.completeBaseName());
+        QString nodes_path = base + "_nodes.csv";
+        QString conv_path = base + "_convergence.csv";
+        QString time_path = base + "_time.csv";
+        QString anytime_path = base + "_anytime.csv";
+
+        result.success = WriteNodesCsv(data.nodes, nodes_path, &result.error) &&
+                         WriteConvergenceCsv(conv, conv_path, &result.error) &&
+                         WriteTimeCsv(data.time, time_path, &result.error) &&
+                         WriteAnytimeCsv(data.anytime, anytime_path, &result.error);
+        result.files << nodes_path << conv_path << time_path << anytime_path;
+    } else {
+        const NodeColumns& nodes = data.nodes;
+
+        std::vector<unsigned char> stage_codes(kTimeStageCount + 1);
+        std::vector<double> stage_seconds(kTimeStageCount + 1);
+        std::vector<QByteArray> stage_labels;
+        for (int i = 0; i < kTimeStageCount; i++) {
+            stage_codes[i] = static_cast<unsigned char>(i);
+            stage_seconds[i] = data.time.stages[i];
+            stage_labels.emplace_back(kTimeStageKeys[i]);
+        }
+        stage_codes[kTimeStageCount] = static_cast<unsigned char>(kTimeStageCount);
+        stage_seconds[kTimeStageCount] = data.time.total;
+        stage_labels.emplace_back("total");
+
+        // 随时性能指标为单行表 (指标无效时 0 行), 每个指标一列
+        double anytime_values[kAnytimeColumnCount];
+        AnytimeColumnValues(data.anytime, anytime_values);
+        std::vector<ColumnSpec> anytime_columns;
+        for (int i = 0; i < kAnytimeColumnCount; i++) {
+            anytime_columns.push_back({kAnytimeColumnKeys[i], kColumnFloat64, &anytime_values[i], {}});
+        }
+
+        std::vector<TableSpec> tables;
+        tables.push_back({"nodes", nodes.size(), {
+            {"id", kColumnInt32, nodes.id.data(), {}},
+            {"parent_id", kColumnInt32, nodes.parent_id.data(), {}},
+            {"depth", kColumnInt32, nodes.depth.data(), {}},
+            {"lower_bound", kColumnFloat64, nodes.lower_bound.data(), {}},
+            {"status", kColumnUInt8, nodes.status.data(), MakeLabels(kStatusLabels, kNodeStatusCodeCount)},
+            {"branch_type", kColumnUInt8, nodes.branch_type.data(), MakeLabels(kBranchTypeLabels, kBranchTypeCodeCount)},
+            {"branch_dir", kColumnUInt8, nodes.branch_dir.data(), MakeLabels(kBranchDirLabels, 3)},
+            {"cg_iterations", kColumnInt32, nodes.cg_iterations.data(), {}},
+            {"final_y_cols", kColumnInt32, nodes.y_cols.data(), {}},
+            {"final_x_cols", kColumnInt32, nodes.x_cols.data(), {}},
+            {"is_integer", kColumnUInt8, nodes.is_integer.data(), {}},
+        }});
+        tables.push_back({"convergence", conv.time.size(), {
+            {"time", kColumnFloat64, conv.time.data(), {}},
+            {"event", kColumnUInt8, conv.event.data(), conv.event_labels},
+            {"node_id", kColumnInt32, conv.node_id.data(), {}},
+            {"lb", kColumnFloat64, conv.lb.data(), {}},
+            {"ub", kColumnFloat64, conv.ub.data(), {}},
+        }});
+        tables.push_back({"time_breakdown", stage_codes.size(), {
+            {"stage", kColumnUInt8, stage_codes.data(), stage_labels},
+            {"seconds", kColumnFloat64, stage_seconds.data(), {}},
+        }});
+        tables.push_back({"anytime", data.anytime.valid ? 1u : 0u, std::move(anytime_columns)});
+
+        result.success = WriteBinary(tables, path, &result.error);
+        result.files << path;
+    }
+
+    for (const QString& file : result.files) {
+        result.bytes += QFileInfo(file).size();
+    }
+    result.elapsed_ms = timer.elapsed();
+    return result;
+}
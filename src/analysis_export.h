@@ -0,0 +1,61 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// analysis_export.h - 分析数据导出 (CSV / 列式二进制)
+// 导出节点表、收敛历史、时间统计与随时性能指标, 供离线分析使用; 无界面依赖, 可在工作线程或命令行中调用
+//
+// 列式二进制格式 (.cs2a, 全部小端):
+//   文件头: magic "CS2DANA1" (8字节), uint32 版本, uint32 表个数
+//   每个表: uint16 名称长度 + 名称, uint64 行数, uint32 列数
+//   每一列: uint16 名称长度 + 名称, uint8 类型 (1=int32, 2=float64, 3=uint8),
+//           uint16 取值标签个数 + 每个标签 (uint16 长度 + UTF-8), 分类列的 uint8 编码即标签下标
+//           uint64 数据偏移 (相对文件头, 8字节对齐), uint64 数据字节数
+//   数据区: 各列连续存放, 可直接内存映射 (如 numpy.frombuffer)
+
+#ifndef ANALYSIS_EXPORT_H_
+#define ANALYSIS_EXPORT_H_
+
+#include <QString>
+#include <QStringList>
+#include <vector>
+#include "analysis_data.h"
+#include "node_statistics.h"
+
+enum class AnalysisExportFormat {
+    kCsv,       // 每个表一个 CSV 文件: <名称>_nodes.csv / _convergence.csv / _time.csv / _anytime.csv
+    kBinary     // 单个列式二进制文件
+};
+
+// 导出数据快照 (可整体拷贝到工作线程)
+struct AnalysisExportData {
+    NodeColumns nodes;
+    std::vector<ConvergencePoint> convergence;
+    TimeBreakdown time;
+    AnytimeMetrics anytime;     // 参考值取最终目标值, 与分析页面一致
+};
+
+struct AnalysisExportResult {
+    bool success = false;
+    QString error;
+    QStringList files;
+    qint64 bytes = 0;
+    qint64 elapsed_ms = 0;
+};
+
+// 根据扩展名判断格式 (.csv 为 CSV, 其余为二进制)
+AnalysisExportFormat AnalysisExportFormatFromPath(const QString& path);
+
+// 直接从解文件读取导出数据 (命令行导出使用)
+bool LoadAnalysisExportData(const QString& json_path, AnalysisExportData* data, QString* error);
+
+// 导出 (线程安全)
+AnalysisExportResult ExportAnalysisData(const AnalysisExportData& data,
+                                        const QString& path,
+                                        AnalysisExportFormat format);
+
+#endif  // ANALYSIS_EXPORT_H_
@@ -9,6 +9,9 @@
 // analysis_widget.cpp - 求解分析页面实现
 
 #include "analysis_widget.h"
+#include "bp_tree_widget.h"
+#include "run_comparison_widget.h"
+#include "chart_widget.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -24,14 +27,23 @@
 #include <QComboBox>
 #include <QFileDialog>
 #include <QFile>
+#include <QFileInfo>
+#include <QDir>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QMessageBox>
 #include <QProgressBar>
+#include <QStackedWidget>
+#include <QTabWidget>
+#include <QElapsedTimer>
+#include <QtConcurrent>
+#include <memory>
+#include <algorithm>
 
 AnalysisWidget::AnalysisWidget(QWidget* parent)
-    : QWidget(parent) {
+    : QWidget(parent)
+    , export_watcher_(new QFutureWatcher<AnalysisExportResult>(this)) {
     SetupUi();
     SetupConnections();
 }
@@ -57,22 +69,42 @@ void AnalysisWidget::SetupUi() {
     left_layout->addWidget(CreateConvergenceGroup(), 1);
     main_splitter->addWidget(left_panel);
 
-    // 右侧面板 (节点表格)
-    main_splitter->addWidget(CreateNodeTableGroup());
+    // 右侧面板 (节点表格 + 分支树/节点统计)
+    detail_tabs_ = new QTabWidget();
+    detail_tabs_->addTab(CreateTreeViewGroup(), QString::fromUtf8("分支树"));
+    detail_tabs_->addTab(CreateNodeStatsGroup(), QString::fromUtf8("节点统计"));
+
+    QSplitter* right_splitter = new QSplitter(Qt::Vertical);
+    right_splitter->addWidget(CreateNodeTableGroup());
+    right_splitter->addWidget(detail_tabs_);
+    right_splitter->setStretchFactor(0, 1);
+    right_splitter->setStretchFactor(1, 1);
+    main_splitter->addWidget(right_splitter);
 
     main_splitter->setStretchFactor(0, 1);
     main_splitter->setStretchFactor(1, 2);
 
-    main_layout->addWidget(main_splitter, 1);
+    // 单文件分析 / 多解对比 两种模式
+    comparison_widget_ = new RunComparisonWidget();
+    view_stack_ = new QStackedWidget(this);
+    view_stack_->addWidget(main_splitter);
+    view_stack_->addWidget(comparison_widget_);
+
+    main_layout->addWidget(view_stack_, 1);
 }
 
 void AnalysisWidget::SetupConnections() {
     connect(load_file_button_, &QPushButton::clicked, this, &AnalysisWidget::OnLoadFile);
+    connect(compare_mode_button_, &QPushButton::toggled, this, &AnalysisWidget::OnCompareModeToggled);
+    connect(export_button_, &QPushButton::clicked, this, &AnalysisWidget::OnExportData);
+    connect(export_watcher_, &QFutureWatcher<AnalysisExportResult>::finished,
+            this, &AnalysisWidget::OnExportFinished);
     connect(status_filter_combo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &AnalysisWidget::OnNodeFilterChanged);
     connect(branch_type_filter_combo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &AnalysisWidget::OnNodeFilterChanged);
     connect(node_table_, &QTableWidget::cellClicked, this, &AnalysisWidget::OnNodeTableClicked);
+    connect(tree_widget_, &BpTreeWidget::NodeSelected, this, &AnalysisWidget::NodeSelected);
 }
 
 QGroupBox* AnalysisWidget::CreateFileGroup() {
@@ -86,8 +118,18 @@ QGroupBox* AnalysisWidget::CreateFileGroup() {
     load_file_button_ = new QPushButton(QString::fromUtf8("加载..."));
     load_file_button_->setFixedWidth(80);
 
+    export_button_ = new QPushButton(QString::fromUtf8("导出数据..."));
+    export_button_->setFixedWidth(80);
+    export_button_->setToolTip(QString::fromUtf8("导出节点表、收敛历史与时间统计 (CSV 或列式二进制)"));
+
+    compare_mode_button_ = new QPushButton(QString::fromUtf8("多解对比"));
+    compare_mode_button_->setCheckable(true);
+    compare_mode_button_->setFixedWidth(80);
+
     layout->addWidget(file_path_edit_, 1);
     layout->addWidget(load_file_button_);
+    layout->addWidget(export_button_);
+    layout->addWidget(compare_mode_button_);
 
     return group;
 }
@@ -145,6 +187,31 @@ QGroupBox* AnalysisWidget::CreateSummaryGroup() {
     integer_nodes_label_ = new QLabel("-");
     layout->addWidget(integer_nodes_label_, row++, 1);
 
+    // 随时性能 (由收敛历史计算, 单位: 差距×秒)
+    layout->addWidget(new QLabel(QString::fromUtf8("原始积分:")), row, 0);
+    primal_integral_label_ = new QLabel("-");
+    primal_integral_label_->setToolTip(QString::fromUtf8("∫ 上界与最优值的相对差距 dt"));
+    layout->addWidget(primal_integral_label_, row++, 1);
+
+    layout->addWidget(new QLabel(QString::fromUtf8("对偶积分:")), row, 0);
+    dual_integral_label_ = new QLabel("-");
+    dual_integral_label_->setToolTip(QString::fromUtf8("∫ 下界与最优值的相对差距 dt"));
+    layout->addWidget(dual_integral_label_, row++, 1);
+
+    layout->addWidget(new QLabel(QString::fromUtf8("原始对偶积分:")), row, 0);
+    primal_dual_integral_label_ = new QLabel("-");
+    primal_dual_integral_label_->setToolTip(QString::fromUtf8("∫ 上下界相对差距 dt"));
+    layout->addWidget(primal_dual_integral_label_, row++, 1);
+
+    layout->addWidget(new QLabel(QString::fromUtf8("首个可行解:")), row, 0);
+    first_incumbent_label_ = new QLabel("-");
+    layout->addWidget(first_incumbent_label_, row++, 1);
+
+    layout->addWidget(new QLabel(QString::fromUtf8("达到目标差距:")), row, 0);
+    time_to_target_label_ = new QLabel("-");
+    time_to_target_label_->setToolTip(QString::fromUtf8("上界首次进入最优值 X% 以内的时间"));
+    layout->addWidget(time_to_target_label_, row++, 1);
+
     layout->setColumnStretch(1, 1);
     return group;
 }
@@ -207,21 +274,21 @@ QGroupBox* AnalysisWidget::CreateNodeTableGroup() {
 
     filter_layout->addWidget(new QLabel(QString::fromUtf8("状态:")));
     status_filter_combo_ = new QComboBox();
-    status_filter_combo_->addItem(QString::fromUtf8("全部"), "");
-    status_filter_combo_->addItem(QString::fromUtf8("已分支"), "branched");
-    status_filter_combo_->addItem(QString::fromUtf8("已剪枝"), "pruned");
-    status_filter_combo_->addItem(QString::fromUtf8("不可行"), "infeasible");
-    status_filter_combo_->addItem(QString::fromUtf8("整数解"), "integer");
-    status_filter_combo_->addItem(QString::fromUtf8("活跃"), "active");
+    status_filter_combo_->addItem(QString::fromUtf8("全部"), -1);
+    status_filter_combo_->addItem(QString::fromUtf8("已分支"), static_cast<int>(NodeStatusCode::kBranched));
+    status_filter_combo_->addItem(QString::fromUtf8("已剪枝"), static_cast<int>(NodeStatusCode::kPruned));
+    status_filter_combo_->addItem(QString::fromUtf8("不可行"), static_cast<int>(NodeStatusCode::kInfeasible));
+    status_filter_combo_->addItem(QString::fromUtf8("整数解"), static_cast<int>(NodeStatusCode::kInteger));
+    status_filter_combo_->addItem(QString::fromUtf8("活跃"), static_cast<int>(NodeStatusCode::kActive));
     filter_layout->addWidget(status_filter_combo_);
 
     filter_layout->addSpacing(16);
 
     filter_layout->addWidget(new QLabel(QString::fromUtf8("分支类型:")));
     branch_type_filter_combo_ = new QComboBox();
-    branch_type_filter_combo_->addItem(QString::fromUtf8("全部"), "");
-    branch_type_filter_combo_->addItem(QString::fromUtf8("SP1"), "SP1");
-    branch_type_filter_combo_->addItem(QString::fromUtf8("SP2"), "SP2");
+    branch_type_filter_combo_->addItem(QString::fromUtf8("全部"), -1);
+    branch_type_filter_combo_->addItem(QString::fromUtf8("SP1弧"), static_cast<int>(BranchTypeCode::kSp1Arc));
+    branch_type_filter_combo_->addItem(QString::fromUtf8("SP2弧"), static_cast<int>(BranchTypeCode::kSp2Arc));
     filter_layout->addWidget(branch_type_filter_combo_);
 
     filter_layout->addStretch();
@@ -252,6 +319,66 @@ QGroupBox* AnalysisWidget::CreateNodeTableGroup() {
     return group;
 }
 
+QGroupBox* AnalysisWidget::CreateTreeViewGroup() {
+    QGroupBox* group = new QGroupBox(QString::fromUtf8("分支树"));
+    QVBoxLayout* layout = new QVBoxLayout(group);
+
+    tree_widget_ = new BpTreeWidget();
+    layout->addWidget(tree_widget_, 1);
+
+    return group;
+}
+
+QGroupBox* AnalysisWidget::CreateNodeStatsGroup() {
+    QGroupBox* group = new QGroupBox(QString::fromUtf8("节点统计 (随筛选条件更新)"));
+    QGridLayout* layout = new QGridLayout(group);
+    layout->setSpacing(6);
+
+    depth_count_chart_ = new BarChartWidget();
+    depth_count_chart_->SetAxisTitles(QString::fromUtf8("深度"), QString::fromUtf8("节点数"));
+
+    depth_lb_chart_ = new LineChartWidget();
+    depth_lb_chart_->setMinimumHeight(120);
+    depth_lb_chart_->SetAxisTitles(QString::fromUtf8("深度"), QString::fromUtf8("下界"));
+
+    cg_iteration_chart_ = new BarChartWidget();
+    cg_iteration_chart_->SetBarColor(QColor(255, 127, 14));
+    cg_iteration_chart_->SetAxisTitles(QString::fromUtf8("CG迭代次数"), QString::fromUtf8("节点数"));
+
+    column_growth_chart_ = new LineChartWidget();
+    column_growth_chart_->setMinimumHeight(120);
+    column_growth_chart_->SetAxisTitles(QString::fromUtf8("深度"), QString::fromUtf8("平均列数"));
+
+    layout->addWidget(depth_count_chart_, 0, 0);
+    layout->addWidget(depth_lb_chart_, 0, 1);
+    layout->addWidget(cg_iteration_chart_, 1, 0);
+    layout->addWidget(column_growth_chart_, 1, 1);
+
+    // 分支类型结果占比
+    branch_outcome_table_ = new QTableWidget(3, 5);
+    branch_outcome_table_->setHorizontalHeaderLabels({
+        QString::fromUtf8("分支类型"),
+        QString::fromUtf8("节点数"),
+        QString::fromUtf8("剪枝"),
+        QString::fromUtf8("不可行"),
+        QString::fromUtf8("整数解")
+    });
+    branch_outcome_table_->verticalHeader()->setVisible(false);
+    branch_outcome_table_->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    branch_outcome_table_->setSelectionMode(QAbstractItemView::NoSelection);
+    branch_outcome_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    branch_outcome_table_->setMaximumHeight(110);
+    layout->addWidget(branch_outcome_table_, 2, 0, 1, 2);
+
+    node_stats_label_ = new QLabel("-");
+    node_stats_label_->setWordWrap(true);
+    layout->addWidget(node_stats_label_, 3, 0, 1, 2);
+
+    layout->setRowStretch(0, 1);
+    layout->setRowStretch(1, 1);
+    return group;
+}
+
 void AnalysisWidget::OnLoadFile() {
     QString file_path = QFileDialog::getOpenFileName(
         this, QString::fromUtf8("打开解文件"),
@@ -263,6 +390,54 @@ void AnalysisWidget::OnLoadFile() {
     }
 }
 
+void AnalysisWidget::OnCompareModeToggled(bool checked) {
+    view_stack_->setCurrentIndex(checked ? 1 : 0);
+    file_path_edit_->setEnabled(!checked);
+    load_file_button_->setEnabled(!checked);
+    export_button_->setEnabled(!checked && !export_watcher_->isRunning());
+}
+
+void AnalysisWidget::OnExportData() {
+    if (current_file_path_.isEmpty() || export_watcher_->isRunning()) return;
+
+    QFileInfo info(current_file_path_);
+    QString path = QFileDialog::getSaveFileName(
+        this, QString::fromUtf8("导出分析数据"),
+        info.dir().filePath(info.completeBaseName() + ".cs2a"),
+        QString::fromUtf8("列式二进制 (*.cs2a);;CSV 文件 (*.csv)"));
+    if (path.isEmpty()) return;
+
+    // 拷贝快照到工作线程, 界面数据在导出期间可继续变化
+    auto data = std::make_shared<AnalysisExportData>();
+    data->nodes = node_columns_;
+    data->convergence = convergence_data_;
+    data->time = time_breakdown_;
+    data->anytime = anytime_metrics_;
+    AnalysisExportFormat format = AnalysisExportFormatFromPath(path);
+
+    export_button_->setEnabled(false);
+    export_watcher_->setFuture(QtConcurrent::run([data, path, format]() {
+        return ExportAnalysisData(*data, path, format);
+    }));
+}
+
+void AnalysisWidget::OnExportFinished() {
+    export_button_->setEnabled(!compare_mode_button_->isChecked());
+
+    AnalysisExportResult result = export_watcher_->result();
+    if (!result.success) {
+        QMessageBox::warning(this, QString::fromUtf8("错误"), result.error);
+        return;
+    }
+
+    QMessageBox::information(this, QString::fromUtf8("导出完成"),
+        QString::fromUtf8("已写入 %1 个文件, 共 %2 KB, 用时 %3 ms\n\n%4")
+            .arg(result.files.size())
+            .arg(result.bytes / 1024)
+            .arg(result.elapsed_ms)
+            .arg(result.files.join("\n")));
+}
+
 bool AnalysisWidget::LoadAnalysisData(const QString& json_path) {
     QFile file(json_path);
     if (!file.open(QIODevice::ReadOnly)) {
@@ -298,12 +473,19 @@ bool AnalysisWidget::LoadAnalysisData(const QString& json_path) {
     UpdateSummary(summary, branch_stats);
 
     if (root.contains("time_breakdown")) {
-        UpdateTimeBreakdown(root["time_breakdown"].toObject());
+        time_breakdown_ = ParseTimeBreakdown(root["time_breakdown"].toObject());
+        UpdateTimeBreakdown(time_breakdown_);
+    } else {
+        time_breakdown_ = TimeBreakdown();
     }
 
     if (root.contains("convergence")) {
-        UpdateConvergenceTable(root["convergence"].toArray());
+        convergence_data_ = ParseConvergence(root["convergence"].toArray());
+    } else {
+        convergence_data_.clear();
     }
+    UpdateConvergenceTable();
+    UpdateAnytimeMetrics(summary["objective_value"].toDouble());
 
     if (root.contains("bp_tree")) {
         QJsonObject bp_tree = root["bp_tree"].toObject();
@@ -329,15 +511,25 @@ void AnalysisWidget::ClearAnalysisData() {
     pruned_nodes_label_->setText("-");
     infeasible_nodes_label_->setText("-");
     integer_nodes_label_->setText("-");
+    primal_integral_label_->setText("-");
+    dual_integral_label_->setText("-");
+    primal_dual_integral_label_->setText("-");
+    first_incumbent_label_->setText("-");
+    time_to_target_label_->setText("-");
 
     time_table_->setRowCount(0);
     total_time_label_->setText(QString::fromUtf8("总计: -"));
 
     convergence_table_->setRowCount(0);
     node_table_->setRowCount(0);
+    tree_widget_->Clear();
 
     all_nodes_.clear();
+    node_columns_ = NodeColumns();
+    UpdateNodeStatistics();
     convergence_data_.clear();
+    time_breakdown_ = TimeBreakdown();
+    anytime_metrics_ = AnytimeMetrics();
     current_file_path_.clear();
 }
 
@@ -383,54 +575,37 @@ void AnalysisWidget::UpdateSummary(const QJsonObject& summary, const QJsonObject
     integer_nodes_label_->setText(QString::number(summary["integer_nodes"].toInt()));
 }
 
-void AnalysisWidget::UpdateTimeBreakdown(const QJsonObject& time_breakdown) {
+void AnalysisWidget::UpdateTimeBreakdown(const TimeBreakdown& time) {
     time_table_->setRowCount(0);
 
-    struct TimeItem {
-        QString name;
-        QString key;
-    };
-
-    std::vector<TimeItem> items = {
-        {QString::fromUtf8("数据读取"), "data_loading"},
-        {QString::fromUtf8("网络构建"), "network_building"},
-        {QString::fromUtf8("启发式"), "heuristic"},
-        {QString::fromUtf8("根节点CG"), "root_cg"},
-        {QString::fromUtf8("分支定价"), "branch_and_price"},
-        {QString::fromUtf8("导出"), "output"}
-    };
-
-    double total = time_breakdown["total"].toDouble();
+    double total = time.total;
     total_time_label_->setText(QString::fromUtf8("总计: %1 秒").arg(total, 0, 'f', 2));
 
-    for (const auto& item : items) {
-        double value = time_breakdown[item.key].toDouble();
+    for (int i = 0; i < kTimeStageCount; i++) {
+        double value = time.stages[i];
         double percent = (total > 0) ? (value / total * 100) : 0;
 
         int row = time_table_->rowCount();
         time_table_->insertRow(row);
 
-        time_table_->setItem(row, 0, new QTableWidgetItem(item.name));
+        time_table_->setItem(row, 0, new QTableWidgetItem(QString::fromUtf8(kTimeStageNames[i])));
         time_table_->setItem(row, 1, new QTableWidgetItem(QString::number(value, 'f', 2)));
         time_table_->setItem(row, 2, new QTableWidgetItem(QString::number(percent, 'f', 1) + "%"));
     }
 }
 
-void AnalysisWidget::UpdateConvergenceTable(const QJsonArray& convergence) {
+void AnalysisWidget::UpdateConvergenceTable() {
     convergence_table_->setRowCount(0);
-    convergence_data_.clear();
-
-    for (const QJsonValue& val : convergence) {
-        QJsonObject ev = val.toObject();
 
+    for (const ConvergencePoint& point : convergence_data_) {
         int row = convergence_table_->rowCount();
         convergence_table_->insertRow(row);
 
-        double time = ev["time"].toDouble();
-        QString event = ev["event"].toString();
-        int node_id = ev["node_id"].toInt(-1);
-        double lb = ev["lb"].toDouble(-1);
-        double ub = ev["ub"].toDouble(-1);
+        double time = point.time;
+        const QString& event = point.event;
+        int node_id = point.node_id;
+        double lb = point.lb;
+        double ub = point.ub;
 
         convergence_table_->setItem(row, 0, new QTableWidgetItem(QString::number(time, 'f', 2)));
 
@@ -466,62 +641,78 @@ void AnalysisWidget::UpdateConvergenceTable(const QJsonArray& convergence) {
                 item->setBackground(bg_color);
             }
         }
-
-        ConvergencePoint point;
-        point.time = time;
-        point.event = event;
-        point.node_id = node_id;
-        point.lb = lb;
-        point.ub = ub;
-        convergence_data_.push_back(point);
     }
 }
 
-void AnalysisWidget::UpdateNodeTable(const QJsonArray& nodes) {
-    all_nodes_.clear();
+void AnalysisWidget::UpdateAnytimeMetrics(double objective_value) {
+    anytime_metrics_ = ComputeAnytimeMetrics(
+        convergence_data_, objective_value, time_breakdown_.total);
+    const AnytimeMetrics& metrics = anytime_metrics_;
+
+    if (!metrics.valid) {
+        primal_integral_label_->setText("-");
+        dual_integral_label_->setText("-");
+        primal_dual_integral_label_->setText("-");
+        first_incumbent_label_->setText("-");
+        time_to_target_label_->setText("-");
+        return;
+    }
 
-    for (const QJsonValue& val : nodes) {
-        QJsonObject node_obj = val.toObject();
-        NodeData node;
-        node.id = node_obj["id"].toInt();
-        node.parent_id = node_obj["parent_id"].toInt();
-        node.depth = node_obj["depth"].toInt();
-        node.lower_bound = node_obj["lower_bound"].toDouble(-1);
-        node.status = node_obj["status"].toString();
-        node.branch_type = node_obj["branch_type"].toString();
-        node.branch_dir = node_obj["branch_dir"].toString();
-        node.cg_iterations = node_obj["cg_iterations"].toInt();
-        node.final_y_cols = node_obj["final_y_cols"].toInt();
-        node.final_x_cols = node_obj["final_x_cols"].toInt();
-        node.is_integer = node_obj["is_integer"].toBool();
-
-        all_nodes_.push_back(node);
+    primal_integral_label_->setText(QString::number(metrics.primal_integral, 'f', 3));
+    dual_integral_label_->setText(QString::number(metrics.dual_integral, 'f', 3));
+    primal_dual_integral_label_->setText(QString::number(metrics.primal_dual_integral, 'f', 3));
+    first_incumbent_label_->setText(metrics.time_to_first_incumbent >= 0 ?
+        QString::fromUtf8("%1 秒").arg(metrics.time_to_first_incumbent, 0, 'f', 2) :
+        QString::fromUtf8("未找到"));
+
+    QStringList targets;
+    for (int k = 0; k < kTargetGapCount; k++) {
+        QString value = metrics.time_to_target[k] >= 0 ?
+            QString::number(metrics.time_to_target[k], 'f', 2) : QString("-");
+        targets << QString("%1%: %2").arg(kTargetGaps[k] * 100, 0, 'g', 3).arg(value);
     }
+    time_to_target_label_->setText(targets.join(" / ") + QString::fromUtf8(" 秒"));
+}
+
+void AnalysisWidget::UpdateNodeTable(const QJsonArray& nodes) {
+    all_nodes_ = ParseNodes(nodes);
+    node_columns_ = BuildNodeColumns(all_nodes_);
 
     FilterNodeTable();
+    UpdateNodeStatistics();
+    tree_widget_->SetNodes(all_nodes_);
 }
 
 void AnalysisWidget::OnNodeFilterChanged() {
     FilterNodeTable();
+    UpdateNodeStatistics();
+}
+
+NodeFilter AnalysisWidget::CurrentNodeFilter() const {
+    NodeFilter filter;
+    filter.status = status_filter_combo_->currentData().toInt();
+    filter.branch_type = branch_type_filter_combo_->currentData().toInt();
+    return filter;
 }
 
 void AnalysisWidget::FilterNodeTable() {
-    QString status_filter = status_filter_combo_->currentData().toString();
-    QString branch_filter = branch_type_filter_combo_->currentData().toString();
+    NodeFilter filter = CurrentNodeFilter();
+
+    // 先按编码列筛选, 再一次性设置行数
+    std::vector<size_t> matched;
+    matched.reserve(all_nodes_.size());
+    for (size_t i = 0; i < node_columns_.size(); i++) {
+        if (filter.Matches(node_columns_.status[i], node_columns_.branch_type[i])) {
+            matched.push_back(i);
+        }
+    }
 
+    node_table_->setUpdatesEnabled(false);
     node_table_->setRowCount(0);
+    node_table_->setRowCount(static_cast<int>(matched.size()));
 
-    for (const auto& node : all_nodes_) {
-        // 应用筛选器
-        if (!status_filter.isEmpty() && node.status != status_filter) {
-            continue;
-        }
-        if (!branch_filter.isEmpty() && node.branch_type != branch_filter) {
-            continue;
-        }
-
-        int row = node_table_->rowCount();
-        node_table_->insertRow(row);
+    for (int row = 0; row < static_cast<int>(matched.size()); row++) {
+        const NodeData& node = all_nodes_[matched[row]];
 
         node_table_->setItem(row, 0, new QTableWidgetItem(QString::number(node.id)));
         node_table_->setItem(row, 1, new QTableWidgetItem(
@@ -576,12 +767,124 @@ void AnalysisWidget::FilterNodeTable() {
         // 存储节点ID用于选择
         node_table_->item(row, 0)->setData(Qt::UserRole, node.id);
     }
+
+    node_table_->setUpdatesEnabled(true);
+}
+
+void AnalysisWidget::UpdateNodeStatistics() {
+    QElapsedTimer timer;
+    timer.start();
+    NodeStatistics stats = ComputeNodeStatistics(node_columns_, CurrentNodeFilter());
+    qint64 elapsed_ms = timer.elapsed();
+
+    if (stats.node_count == 0) {
+        depth_count_chart_->Clear();
+        depth_lb_chart_->Clear();
+        cg_iteration_chart_->Clear();
+        column_growth_chart_->Clear();
+        branch_outcome_table_->clearContents();
+        node_stats_label_->setText("-");
+        return;
+    }
+
+    // 每层节点数
+    std::vector<double> depth_counts;
+    std::vector<QString> depth_labels;
+    depth_counts.reserve(stats.per_depth.size());
+    depth_labels.reserve(stats.per_depth.size());
+    for (size_t d = 0; d < stats.per_depth.size(); d++) {
+        depth_counts.push_back(stats.per_depth[d].count);
+        depth_labels.push_back(QString::number(d));
+    }
+    depth_count_chart_->SetBars(std::move(depth_counts), std::move(depth_labels));
+
+    // 下界与列数随深度变化
+    ChartSeries lb_min{QString::fromUtf8("最小"), LineChartWidget::GetSeriesColor(0), Qt::DashLine};
+    ChartSeries lb_mean{QString::fromUtf8("平均"), LineChartWidget::GetSeriesColor(0)};
+    ChartSeries lb_max{QString::fromUtf8("最大"), LineChartWidget::GetSeriesColor(3), Qt::DashLine};
+    ChartSeries y_cols{QString::fromUtf8("Y列"), LineChartWidget::GetSeriesColor(2)};
+    ChartSeries x_cols{QString::fromUtf8("X列"), LineChartWidget::GetSeriesColor(4)};
+    for (size_t d = 0; d < stats.per_depth.size(); d++) {
+        const DepthStats& ds = stats.per_depth[d];
+        if (ds.count == 0) continue;
+        if (ds.lb_count > 0) {
+            lb_min.points.emplace_back(d, ds.lb_min);
+            lb_mean.points.emplace_back(d, ds.lb_sum / ds.lb_count);
+            lb_max.points.emplace_back(d, ds.lb_max);
+        }
+        y_cols.points.emplace_back(d, ds.y_cols_sum / ds.count);
+        x_cols.points.emplace_back(d, ds.x_cols_sum / ds.count);
+    }
+    depth_lb_chart_->SetSeries({lb_min, lb_mean, lb_max});
+    column_growth_chart_->SetSeries({y_cols, x_cols});
+
+    // CG 迭代分布 (按值域分箱, 最多 kMaxBins 根柱子)
+    constexpr int kMaxBins = 30;
+    int max_iter = stats.cg_iteration_counts.max_value();
+    int bin_width = std::max(1, (max_iter + kMaxBins) / kMaxBins);
+    std::vector<double> bins((max_iter / bin_width) + 1, 0.0);
+    std::vector<QString> bin_labels(bins.size());
+    stats.cg_iteration_counts.ForEachBucket([&](int lower, int count) {
+        bins[lower / bin_width] += count;
+    });
+    for (size_t b = 0; b < bins.size(); b++) {
+        bin_labels[b] = QString::number(static_cast<int>(b) * bin_width);
+    }
+    cg_iteration_chart_->SetBars(std::move(bins), std::move(bin_labels));
+
+    // 分支类型结果占比
+    const BranchTypeCode kOutcomeRows[] = {
+        BranchTypeCode::kSp1Arc, BranchTypeCode::kSp2Arc, BranchTypeCode::kNone
+    };
+    const char* const kOutcomeRowNames[] = {"SP1弧", "SP2弧", "根/其他"};
+    for (int row = 0; row < 3; row++) {
+        const int* counts = stats.outcome_counts[static_cast<int>(kOutcomeRows[row])];
+        int total = 0;
+        for (int s = 0; s < kNodeStatusCodeCount; s++) total += counts[s];
+        // 根/其他 行合并未识别的分支类型
+        if (kOutcomeRows[row] == BranchTypeCode::kNone) {
+            for (int s = 0; s < kNodeStatusCodeCount; s++) {
+                total += stats.outcome_counts[static_cast<int>(BranchTypeCode::kOther)][s];
+            }
+        }
+        auto share = [&](NodeStatusCode status) {
+            int count = counts[static_cast<int>(status)];
+            if (kOutcomeRows[row] == BranchTypeCode::kNone) {
+                count += stats.outcome_counts[static_cast<int>(BranchTypeCode::kOther)][static_cast<int>(status)];
+            }
+            return total > 0 ? QString::number(100.0 * count / total, 'f', 1) + "%" : QString("-");
+        };
+
+        branch_outcome_table_->setItem(row, 0, new QTableWidgetItem(QString::fromUtf8(kOutcomeRowNames[row])));
+        branch_outcome_table_->setItem(row, 1, new QTableWidgetItem(QString::number(total)));
+        branch_outcome_table_->setItem(row, 2, new QTableWidgetItem(share(NodeStatusCode::kPruned)));
+        branch_outcome_table_->setItem(row, 3, new QTableWidgetItem(share(NodeStatusCode::kInfeasible)));
+        branch_outcome_table_->setItem(row, 4, new QTableWidgetItem(share(NodeStatusCode::kInteger)));
+    }
+
+    // 分位数摘要
+    int n = stats.node_count;
+    node_stats_label_->setText(QString::fromUtf8(
+        "节点 %1 | CG迭代 均值 %2, P50/P90/P99/最大 %3/%4/%5/%6 | "
+        "Y列 P50/P90 %7/%8 | X列 P50/P90 %9/%10 | 统计用时 %11 ms")
+        .arg(n)
+        .arg(static_cast<double>(stats.cg_iteration_sum) / n, 0, 'f', 1)
+        .arg(stats.cg_iteration_counts.Quantile(0.5))
+        .arg(stats.cg_iteration_counts.Quantile(0.9))
+        .arg(stats.cg_iteration_counts.Quantile(0.99))
+        .arg(max_iter)
+        .arg(stats.y_cols_counts.Quantile(0.5))
+        .arg(stats.y_cols_counts.Quantile(0.9))
+        .arg(stats.x_cols_counts.Quantile(0.5))
+        .arg(stats.x_cols_counts.Quantile(0.9))
+        .arg(elapsed_ms));
 }
 
 void AnalysisWidget::OnNodeTableClicked(int row, int column) {
     Q_UNUSED(column);
     if (auto* item = node_table_->item(row, 0)) {
         int node_id = item->data(Qt::UserRole).toInt();
+        tree_widget_->SelectNode(node_id);
         emit NodeSelected(node_id);
     }
 }
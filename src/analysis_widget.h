@@ -7,7 +7,7 @@
 // ============================================================================
 
 // analysis_widget.h - 求解分析页面
-// 包含: 求解概要、时间统计、收敛历史、节点列表
+// 包含: 求解概要、时间统计、收敛历史、节点列表、分支树、节点统计
 
 #ifndef ANALYSIS_WIDGET_H_
 #define ANALYSIS_WIDGET_H_
@@ -16,7 +16,11 @@
 #include <QString>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QFutureWatcher>
 #include <vector>
+#include "analysis_data.h"
+#include "node_statistics.h"
+#include "analysis_export.h"
 
 class QLabel;
 class QPushButton;
@@ -25,30 +29,12 @@ class QComboBox;
 class QGroupBox;
 class QLineEdit;
 class QProgressBar;
-
-// 收敛事件数据
-struct ConvergencePoint {
-    double time;
-    QString event;
-    int node_id;
-    double lb;
-    double ub;
-};
-
-// 节点数据
-struct NodeData {
-    int id;
-    int parent_id;
-    int depth;
-    double lower_bound;
-    QString status;
-    QString branch_type;
-    QString branch_dir;
-    int cg_iterations;
-    int final_y_cols;
-    int final_x_cols;
-    bool is_integer;
-};
+class QStackedWidget;
+class QTabWidget;
+class BpTreeWidget;
+class BarChartWidget;
+class LineChartWidget;
+class RunComparisonWidget;
 
 class AnalysisWidget : public QWidget {
     Q_OBJECT
@@ -65,6 +51,9 @@ signals:
 
 private slots:
     void OnLoadFile();
+    void OnCompareModeToggled(bool checked);
+    void OnExportData();
+    void OnExportFinished();
     void OnNodeFilterChanged();
     void OnNodeTableClicked(int row, int column);
 
@@ -78,17 +67,29 @@ private:
     QGroupBox* CreateTimeBreakdownGroup();
     QGroupBox* CreateConvergenceGroup();
     QGroupBox* CreateNodeTableGroup();
+    QGroupBox* CreateTreeViewGroup();
+    QGroupBox* CreateNodeStatsGroup();
 
     // 数据更新
     void UpdateSummary(const QJsonObject& summary, const QJsonObject& branch_stats);
-    void UpdateTimeBreakdown(const QJsonObject& time_breakdown);
-    void UpdateConvergenceTable(const QJsonArray& convergence);
+    void UpdateTimeBreakdown(const TimeBreakdown& time);
+    void UpdateConvergenceTable();
+    void UpdateAnytimeMetrics(double objective_value);
     void UpdateNodeTable(const QJsonArray& nodes);
     void FilterNodeTable();
+    void UpdateNodeStatistics();
+    NodeFilter CurrentNodeFilter() const;
 
     // 文件加载
     QPushButton* load_file_button_;
     QLineEdit* file_path_edit_;
+    QPushButton* compare_mode_button_;
+    QPushButton* export_button_;
+    QFutureWatcher<AnalysisExportResult>* export_watcher_;
+
+    // 单文件分析 / 多解对比
+    QStackedWidget* view_stack_;
+    RunComparisonWidget* comparison_widget_;
 
     // 求解概要
     QLabel* solve_status_label_;
@@ -103,6 +104,13 @@ private:
     QLabel* infeasible_nodes_label_;
     QLabel* integer_nodes_label_;
 
+    // 随时性能指标
+    QLabel* primal_integral_label_;
+    QLabel* dual_integral_label_;
+    QLabel* primal_dual_integral_label_;
+    QLabel* first_incumbent_label_;
+    QLabel* time_to_target_label_;
+
     // 时间统计
     QTableWidget* time_table_;
     QLabel* total_time_label_;
@@ -115,9 +123,24 @@ private:
     QComboBox* status_filter_combo_;
     QComboBox* branch_type_filter_combo_;
 
+    // 分支树视图
+    BpTreeWidget* tree_widget_;
+
+    // 节点统计
+    QTabWidget* detail_tabs_;
+    BarChartWidget* depth_count_chart_;
+    LineChartWidget* depth_lb_chart_;
+    BarChartWidget* cg_iteration_chart_;
+    LineChartWidget* column_growth_chart_;
+    QTableWidget* branch_outcome_table_;
+    QLabel* node_stats_label_;
+
     // 数据存储
     std::vector<NodeData> all_nodes_;
+    NodeColumns node_columns_;
     std::vector<ConvergencePoint> convergence_data_;
+    TimeBreakdown time_breakdown_;
+    AnytimeMetrics anytime_metrics_;
     QString current_file_path_;
 };
 
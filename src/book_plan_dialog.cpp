@@ -0,0 +1,148 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// book_plan_dialog.cpp - 叠切计划对话框实现
+
+#include "book_plan_dialog.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QSpinBox>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTableWidgetItem>
+#include <QHeaderView>
+#include <QFileDialog>
+#include <QMessageBox>
+#include <QStringList>
+
+namespace {
+
+constexpr int kMaxListedSheetIds = 12;  // 表格中每叠列出的母板ID数 (完整列表见 CSV)
+
+}  // namespace
+
+BookPlanDialog::BookPlanDialog(std::shared_ptr<const CuttingSolution> solution,
+                               std::vector<SawSequence> sequences, QWidget* parent)
+    : QDialog(parent)
+    , solution_(std::move(solution))
+    , sequences_(std::move(sequences)) {
+    setWindowTitle(QString::fromUtf8("叠切计划"));
+    resize(760, 520);
+    SetupUi();
+    Replan();
+}
+
+void BookPlanDialog::SetupUi() {
+    auto* main_layout = new QVBoxLayout(this);
+
+    auto* option_layout = new QHBoxLayout();
+    option_layout->addWidget(new QLabel(QString::fromUtf8("每叠最多张数:"), this));
+    max_sheets_spin_ = new QSpinBox(this);
+    max_sheets_spin_->setRange(1, 20);
+    max_sheets_spin_->setValue(BookPlanOptions().max_sheets);
+    max_sheets_spin_->setToolTip(QString::fromUtf8("由锯片最大切割高度与板厚决定"));
+    connect(max_sheets_spin_, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &BookPlanDialog::Replan);
+    option_layout->addWidget(max_sheets_spin_);
+    option_layout->addStretch();
+    main_layout->addLayout(option_layout);
+
+    summary_label_ = new QLabel(this);
+    summary_label_->setWordWrap(true);
+    main_layout->addWidget(summary_label_);
+
+    book_table_ = new QTableWidget(this);
+    book_table_->setColumnCount(7);
+    book_table_->setHorizontalHeaderLabels({
+        QString::fromUtf8("叠"), QString::fromUtf8("方案"), QString::fromUtf8("张数"),
+        QString::fromUtf8("母板ID"), QString::fromUtf8("切割道数"),
+        QString::fromUtf8("锯切时间"), QString::fromUtf8("总时间")});
+    book_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    book_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    book_table_->verticalHeader()->setVisible(false);
+    book_table_->horizontalHeader()->setSectionResizeMode(3, QHeaderView::Stretch);
+    book_table_->setToolTip(QString::fromUtf8("双击一行在视图中打开该切割方式"));
+    connect(book_table_, &QTableWidget::cellDoubleClicked,
+            this, &BookPlanDialog::OnCellDoubleClicked);
+    main_layout->addWidget(book_table_);
+
+    auto* button_layout = new QHBoxLayout();
+    button_layout->addStretch();
+    auto* export_button = new QPushButton(QString::fromUtf8("导出 CSV..."), this);
+    connect(export_button, &QPushButton::clicked, this, &BookPlanDialog::ExportCsv);
+    auto* close_button = new QPushButton(QString::fromUtf8("关闭"), this);
+    connect(close_button, &QPushButton::clicked, this, &QDialog::accept);
+    button_layout->addWidget(export_button);
+    button_layout->addWidget(close_button);
+    main_layout->addLayout(button_layout);
+}
+
+void BookPlanDialog::Replan() {
+    BookPlanOptions options;
+    options.max_sheets = max_sheets_spin_->value();
+    plan_ = PlanBooks(*solution_, options, sequences_);
+
+    double saving = plan_.single_sheet_time > 0 ?
+        (plan_.single_sheet_time - plan_.total_time) / plan_.single_sheet_time * 100 : 0.0;
+    summary_label_->setText(QString::fromUtf8(
+        "%1 块母板分为 %2 叠; 切割道数 %3 (逐张切割 %4); 估计时间 %5 (逐张切割 %6, 节省 %7%)")
+        .arg(plan_.sheet_count)
+        .arg(plan_.books.size())
+        .arg(plan_.total_passes)
+        .arg(plan_.single_sheet_passes)
+        .arg(FormatSawTime(plan_.total_time), FormatSawTime(plan_.single_sheet_time))
+        .arg(saving, 0, 'f', 1));
+
+    book_table_->setUpdatesEnabled(false);
+    book_table_->setRowCount(static_cast<int>(plan_.books.size()));
+    for (int row = 0; row < static_cast<int>(plan_.books.size()); row++) {
+        const CuttingBook& book = plan_.books[row];
+
+        QStringList ids;
+        for (int k = 0; k < static_cast<int>(book.stock_ids.size()) && k < kMaxListedSheetIds; k++) {
+            ids << QString::number(book.stock_ids[k]);
+        }
+        if (static_cast<int>(book.stock_ids.size()) > kMaxListedSheetIds) ids << "...";
+
+        const QString cells[] = {
+            QString::number(row + 1),
+            QString::number(book.pattern_index + 1),
+            QString::number(book.sheets),
+            ids.join(", "),
+            QString::number(book.passes),
+            FormatSawTime(book.saw_time),
+            FormatSawTime(book.total_time())
+        };
+        for (int column = 0; column < 7; column++) {
+            auto* item = new QTableWidgetItem(cells[column]);
+            if (column != 3) item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            book_table_->setItem(row, column, item);
+        }
+    }
+    book_table_->setUpdatesEnabled(true);
+}
+
+void BookPlanDialog::ExportCsv() {
+    QString path = QFileDialog::getSaveFileName(this, QString::fromUtf8("导出叠切计划"), QString(),
+                                                QString::fromUtf8("CSV 文件 (*.csv)"));
+    if (path.isEmpty()) return;
+
+    QString error;
+    if (!ExportBookPlanCsv(plan_, path, &error)) {
+        QMessageBox::warning(this, QString::fromUtf8("导出错误"), error);
+    }
+}
+
+void BookPlanDialog::OnCellDoubleClicked(int row, int column) {
+    Q_UNUSED(column);
+    if (row >= 0 && row < static_cast<int>(plan_.books.size())) {
+        emit PatternActivated(plan_.books[row].pattern_index);
+    }
+}
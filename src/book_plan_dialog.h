@@ -0,0 +1,52 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// book_plan_dialog.h - 叠切计划对话框
+// 调整每叠最多张数后即时重新分叠; 表格列出每叠的切割方式、母板ID与时间, 可导出 CSV
+
+#ifndef BOOK_PLAN_DIALOG_H_
+#define BOOK_PLAN_DIALOG_H_
+
+#include <QDialog>
+#include <memory>
+#include <vector>
+#include "book_planner.h"
+
+class QLabel;
+class QSpinBox;
+class QTableWidget;
+
+class BookPlanDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    // sequences 为各切割方式的锯切顺序 (与 solution->stocks 一一对应)
+    BookPlanDialog(std::shared_ptr<const CuttingSolution> solution,
+                   std::vector<SawSequence> sequences, QWidget* parent = nullptr);
+
+signals:
+    void PatternActivated(int pattern_index);
+
+private slots:
+    void Replan();
+    void ExportCsv();
+    void OnCellDoubleClicked(int row, int column);
+
+private:
+    void SetupUi();
+
+    std::shared_ptr<const CuttingSolution> solution_;
+    std::vector<SawSequence> sequences_;
+    BookPlan plan_;
+
+    QSpinBox* max_sheets_spin_;
+    QLabel* summary_label_;
+    QTableWidget* book_table_;
+};
+
+#endif  // BOOK_PLAN_DIALOG_H_
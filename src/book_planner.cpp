@@ -0,0 +1,127 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// book_planner.cpp - 叠切计划实现
+
+#include "book_planner.h"
+
+#include <QFile>
+#include <algorithm>
+
+namespace {
+
+// 一叠 k 张的锯切时间: 进给随张数放慢, 空行程与落锯/旋转不变
+double BookSawTime(const SawSequence& sequence, int sheets, const BookPlanOptions& options) {
+    double feed_factor = 1.0 + options.feed_slowdown_per_sheet * (sheets - 1);
+    return sequence.cut_time * feed_factor + sequence.travel_time + sequence.overhead_time;
+}
+
+QByteArray CsvNumber(double value) {
+    return QByteArray::number(value, 'f', 1);
+}
+
+}  // namespace
+
+std::vector<int> BookPlan::SheetOrder() const {
+    std::vector<int> order;
+    order.reserve(sheet_count);
+    for (const auto& book : books) {
+        order.insert(order.end(), book.stock_ids.begin(), book.stock_ids.end());
+    }
+    return order;
+}
+
+BookPlan PlanBooks(const CuttingSolution& solution, const BookPlanOptions& options,
+                   const std::vector<SawSequence>& sequences) {
+    std::vector<SawSequence> computed;
+    const std::vector<SawSequence>* patterns = &sequences;
+    if (sequences.size() != solution.stocks.size()) {
+        computed = OptimizeSawSequences(solution, options.machine);
+        patterns = &computed;
+    }
+
+    const int max_sheets = std::max(1, options.max_sheets);
+    BookPlan plan;
+
+    for (int p = 0; p < static_cast<int>(solution.stocks.size()); p++) {
+        const StockData& stock = solution.stocks[p];
+        const SawSequence& sequence = (*patterns)[p];
+        const int count = std::max(1, stock.multiplicity);
+        const int passes = static_cast<int>(sequence.passes.size());
+
+        // 对照: 每张单独对齐、上下料并切割
+        plan.single_sheet_passes += static_cast<long long>(passes) * count;
+        plan.single_sheet_time += count * (BookSawTime(sequence, 1, options) +
+                                           options.book_setup_time + options.sheet_handling_time);
+
+        // 均衡分叠: 前 count % book_count 叠多一张
+        const int book_count = (count + max_sheets - 1) / max_sheets;
+        const int base = count / book_count;
+        const int extra = count % book_count;
+
+        int next_id = 0;
+        for (int b = 0; b < book_count; b++) {
+            CuttingBook book;
+            book.pattern_index = p;
+            book.sheets = base + (b < extra ? 1 : 0);
+            for (int k = 0; k < book.sheets; k++, next_id++) {
+                book.stock_ids.push_back(next_id < static_cast<int>(stock.stock_ids.size()) ?
+                                         stock.stock_ids[next_id] : stock.stock_id);
+            }
+            book.passes = passes;
+            book.saw_time = BookSawTime(sequence, book.sheets, options);
+            book.handling_time = options.book_setup_time +
+                                 book.sheets * options.sheet_handling_time;
+
+            plan.sheet_count += book.sheets;
+            plan.total_passes += book.passes;
+            plan.total_time += book.total_time();
+            plan.books.push_back(std::move(book));
+        }
+    }
+
+    return plan;
+}
+
+bool ExportBookPlanCsv(const BookPlan& plan, const QString& path, QString* error) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        if (error) *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+
+    QByteArray out;
+    out.reserve(static_cast<int>(plan.books.size()) * 64 + plan.sheet_count * 8 + 256);
+    out += "book,pattern,sheets,stock_ids,passes,saw_time_s,handling_time_s,total_time_s\n";
+    for (size_t i = 0; i < plan.books.size(); i++) {
+        const CuttingBook& book = plan.books[i];
+        out += QByteArray::number(static_cast<qulonglong>(i + 1)) + ',' +
+               QByteArray::number(book.pattern_index + 1) + ',' +
+               QByteArray::number(book.sheets) + ',';
+        for (size_t k = 0; k < book.stock_ids.size(); k++) {
+            if (k > 0) out += ' ';
+            out += QByteArray::number(book.stock_ids[k]);
+        }
+        out += ',' + QByteArray::number(book.passes) + ',' + CsvNumber(book.saw_time) + ',' +
+               CsvNumber(book.handling_time) + ',' + CsvNumber(book.total_time()) + '\n';
+    }
+    out += "# books " + QByteArray::number(static_cast<qulonglong>(plan.books.size())) +
+           ", sheets " + QByteArray::number(plan.sheet_count) +
+           ", passes " + QByteArray::number(plan.total_passes) +
+           ", time_s " + CsvNumber(plan.total_time) + '\n';
+    out += "# single sheet: passes " + QByteArray::number(plan.single_sheet_passes) +
+           ", time_s " + CsvNumber(plan.single_sheet_time) + '\n';
+
+    if (file.write(out) != out.size()) {
+        if (error) *error = QString::fromUtf8("写入失败: ") + path;
+        file.close();
+        file.remove();
+        return false;
+    }
+    return true;
+}
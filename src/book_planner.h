@@ -0,0 +1,62 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// book_planner.h - 叠切 (book cutting) 计划
+// 锯机可一次切割一叠母板; 相同切割方式的母板 (去重后的 multiplicity) 按最大叠放张数分为若干叠,
+// 每叠按该切割方式的锯切顺序 (saw_sequencer.h) 切割一次
+//
+// 分叠: 重复 n 次的切割方式分为 ceil(n / 最大张数) 叠, 各叠张数相差不超过 1 (例如 7 张、最多 6 张 → 4 + 3)
+// 时间: 每叠 = 锯切周期 (进给时间随张数放慢) + 整叠对齐 + 逐张上下料
+// 无界面依赖, 可在命令行中调用
+
+#ifndef BOOK_PLANNER_H_
+#define BOOK_PLANNER_H_
+
+#include <QString>
+#include <vector>
+#include "cutting_data.h"
+#include "saw_sequencer.h"
+
+struct BookPlanOptions {
+    int max_sheets = 5;                     // 每叠最多张数 (由锯片最大切割高度与板厚决定)
+    double feed_slowdown_per_sheet = 0.05;  // 每多一张, 进给时间增加的比例
+    double book_setup_time = 30.0;          // 每叠对齐与夹紧时间 (秒)
+    double sheet_handling_time = 20.0;      // 每张上料与下料时间 (秒)
+    SawMachineModel machine;
+};
+
+// 一叠: 同一切割方式的若干张母板
+struct CuttingBook {
+    int pattern_index = 0;          // 切割方式下标
+    int sheets = 0;
+    std::vector<int> stock_ids;     // 该叠的母板ID (自下而上)
+    int passes = 0;                 // 锯切道数
+    double saw_time = 0;            // 锯切时间 (含落锯与旋转)
+    double handling_time = 0;       // 对齐与上下料时间
+    double total_time() const { return saw_time + handling_time; }
+};
+
+struct BookPlan {
+    std::vector<CuttingBook> books;     // 执行顺序
+    int sheet_count = 0;
+    long long total_passes = 0;
+    double total_time = 0;
+    long long single_sheet_passes = 0;  // 对照: 逐张切割
+    double single_sheet_time = 0;
+
+    std::vector<int> SheetOrder() const;    // 全部母板ID的切割顺序
+};
+
+// 生成叠切计划; sequences 为各切割方式的锯切顺序 (为空时在线程池中计算)
+BookPlan PlanBooks(const CuttingSolution& solution, const BookPlanOptions& options,
+                   const std::vector<SawSequence>& sequences = std::vector<SawSequence>());
+
+// 导出为 CSV (每叠一行, 末尾附合计)
+bool ExportBookPlanCsv(const BookPlan& plan, const QString& path, QString* error);
+
+#endif  // BOOK_PLANNER_H_
@@ -0,0 +1,684 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// bp_tree_widget.cpp - 分支定价树可视化组件实现
+
+#include "bp_tree_widget.h"
+
+#include <QPainter>
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QLineF>
+#include <QMouseEvent>
+#include <QWheelEvent>
+#include <QtConcurrent>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double kSiblingDistance = 1.0;   // 相邻子树最小间距 (模型单位)
+constexpr double kCollapsePixels = 4.0;    // 子树宽度低于该像素数时折叠
+constexpr double kMinScaleY = 2.0;
+constexpr double kMaxScaleY = 80.0;
+constexpr double kMinScaleX = 1e-6;
+constexpr double kMaxScaleX = 200.0;
+constexpr int kViewMargin = 20;
+
+// Buchheim-Walker 算法状态
+// 下标 n 为虚拟根 (其子节点为所有实际根节点), 处理森林
+class TidyTreeWalker {
+public:
+    TidyTreeWalker(const std::vector<int>& child_start,
+                   const std::vector<int>& children,
+                   const std::vector<int>& parent)
+        : child_start_(child_start)
+        , children_(children)
+        , parent_(parent) {
+        size_t n = parent.size();
+        prelim_.assign(n, 0.0);
+        mod_.assign(n, 0.0);
+        shift_.assign(n, 0.0);
+        change_.assign(n, 0.0);
+        thread_.assign(n, -1);
+        ancestor_.resize(n);
+        number_.assign(n, 1);
+        for (size_t v = 0; v < n; v++) {
+            ancestor_[v] = static_cast<int>(v);
+            int begin = child_start_[v];
+            int end = child_start_[v + 1];
+            for (int i = begin; i < end; i++) {
+                number_[children_[i]] = i - begin + 1;
+            }
+        }
+    }
+
+    // 第一遍: 后序遍历计算初步坐标 (显式栈, 避免深树递归溢出)
+    void FirstWalk(int root) {
+        struct Frame {
+            int v;
+            int next;
+            int default_ancestor;
+        };
+        std::vector<Frame> stack;
+        stack.push_back({root, 0, ChildCount(root) > 0 ? LeftMost(root) : -1});
+
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            int v = frame.v;
+            if (frame.next < ChildCount(v)) {
+                int w = children_[child_start_[v] + frame.next];
+                stack.push_back({w, 0, ChildCount(w) > 0 ? LeftMost(w) : -1});
+                continue;
+            }
+
+            int left_sibling = LeftSibling(v);
+            if (ChildCount(v) > 0) {
+                ExecuteShifts(v);
+                double midpoint = (prelim_[LeftMost(v)] + prelim_[RightMost(v)]) / 2.0;
+                if (left_sibling >= 0) {
+                    prelim_[v] = prelim_[left_sibling] + kSiblingDistance;
+                    mod_[v] = prelim_[v] - midpoint;
+                } else {
+                    prelim_[v] = midpoint;
+                }
+            } else {
+                prelim_[v] = (left_sibling >= 0) ? prelim_[left_sibling] + kSiblingDistance : 0.0;
+            }
+
+            stack.pop_back();
+            if (!stack.empty()) {
+                Frame& parent_frame = stack.back();
+                parent_frame.default_ancestor = Apportion(v, parent_frame.default_ancestor);
+                parent_frame.next++;
+            }
+        }
+    }
+
+    // 第二遍: 先序遍历累加修正量得到最终坐标, 同时输出先序序列与深度
+    void SecondWalk(int root, std::vector<double>& x, std::vector<int>& depth,
+                    std::vector<int>& preorder) const {
+        struct Item {
+            int v;
+            double m;
+            int d;
+        };
+        std::vector<Item> stack;
+        stack.push_back({root, -prelim_[root], -1});
+
+        while (!stack.empty()) {
+            Item item = stack.back();
+            stack.pop_back();
+
+            x[item.v] = prelim_[item.v] + item.m;
+            depth[item.v] = item.d;
+            preorder.push_back(item.v);
+
+            // 逆序压栈以保证从左到右访问
+            int begin = child_start_[item.v];
+            for (int i = child_start_[item.v + 1] - 1; i >= begin; i--) {
+                stack.push_back({children_[i], item.m + mod_[item.v], item.d + 1});
+            }
+        }
+    }
+
+private:
+    int ChildCount(int v) const { return child_start_[v + 1] - child_start_[v]; }
+    int LeftMost(int v) const { return children_[child_start_[v]]; }
+    int RightMost(int v) const { return children_[child_start_[v + 1] - 1]; }
+
+    int LeftSibling(int v) const {
+        int p = parent_[v];
+        if (p < 0 || number_[v] <= 1) return -1;
+        return children_[child_start_[p] + number_[v] - 2];
+    }
+
+    int LeftMostSibling(int v) const {
+        int p = parent_[v];
+        return (p < 0) ? v : children_[child_start_[p]];
+    }
+
+    int NextLeft(int v) const { return ChildCount(v) > 0 ? LeftMost(v) : thread_[v]; }
+    int NextRight(int v) const { return ChildCount(v) > 0 ? RightMost(v) : thread_[v]; }
+
+    void MoveSubtree(int wm, int wp, double shift) {
+        double subtrees = number_[wp] - number_[wm];
+        if (subtrees <= 0) subtrees = 1;
+        change_[wp] -= shift / subtrees;
+        shift_[wp] += shift;
+        change_[wm] += shift / subtrees;
+        prelim_[wp] += shift;
+        mod_[wp] += shift;
+    }
+
+    void ExecuteShifts(int v) {
+        double shift = 0.0;
+        double change = 0.0;
+        int begin = child_start_[v];
+        for (int i = child_start_[v + 1] - 1; i >= begin; i--) {
+            int w = children_[i];
+            prelim_[w] += shift;
+            mod_[w] += shift;
+            change += change_[w];
+            shift += shift_[w] + change;
+        }
+    }
+
+    int Ancestor(int vim, int v, int default_ancestor) const {
+        int a = ancestor_[vim];
+        return (parent_[a] == parent_[v]) ? a : default_ancestor;
+    }
+
+    int Apportion(int v, int default_ancestor) {
+        int w = LeftSibling(v);
+        if (w < 0) return default_ancestor;
+
+        int vip = v;
+        int vop = v;
+        int vim = w;
+        int vom = LeftMostSibling(vip);
+        double sip = mod_[vip];
+        double sop = mod_[vop];
+        double sim = mod_[vim];
+        double som = mod_[vom];
+
+        int next_right = NextRight(vim);
+        int next_left = NextLeft(vip);
+        while (next_right >= 0 && next_left >= 0) {
+            vim = next_right;
+            vip = next_left;
+            vom = NextLeft(vom);
+            vop = NextRight(vop);
+            if (vom < 0 || vop < 0) break;
+
+            ancestor_[vop] = v;
+            double shift = (prelim_[vim] + sim) - (prelim_[vip] + sip) + kSiblingDistance;
+            if (shift > 0) {
+                MoveSubtree(Ancestor(vim, v, default_ancestor), v, shift);
+                sip += shift;
+                sop += shift;
+            }
+            sim += mod_[vim];
+            sip += mod_[vip];
+            som += mod_[vom];
+            sop += mod_[vop];
+
+            next_right = NextRight(vim);
+            next_left = NextLeft(vip);
+        }
+
+        if (vom < 0 || vop < 0) return default_ancestor;
+
+        if (next_right >= 0 && NextRight(vop) < 0) {
+            thread_[vop] = next_right;
+            mod_[vop] += sim - sop;
+        }
+        if (next_left >= 0 && NextLeft(vom) < 0) {
+            thread_[vom] = next_left;
+            mod_[vom] += sip - som;
+            default_ancestor = v;
+        }
+        return default_ancestor;
+    }
+
+    const std::vector<int>& child_start_;
+    const std::vector<int>& children_;
+    const std::vector<int>& parent_;
+
+    std::vector<double> prelim_;
+    std::vector<double> mod_;
+    std::vector<double> shift_;
+    std::vector<double> change_;
+    std::vector<int> thread_;
+    std::vector<int> ancestor_;
+    std::vector<int> number_;
+};
+
+}  // namespace
+
+std::shared_ptr<BpTreeLayout> BuildBpTreeLayout(const BpTreeInput& input) {
+    auto layout = std::make_shared<BpTreeLayout>();
+    const int n = static_cast<int>(input.ids.size());
+    layout->node_count = n;
+    layout->node_ids = input.ids;
+    layout->status = input.status;
+
+    layout->index_of_id.reserve(n);
+    for (int i = 0; i < n; i++) {
+        layout->index_of_id.emplace(input.ids[i], i);
+    }
+
+    // 父节点下标 (未知父节点视为根, 挂到虚拟根 n 下)
+    const int virtual_root = n;
+    std::vector<int> parent(n + 1, -1);
+    for (int i = 0; i < n; i++) {
+        auto it = layout->index_of_id.find(input.parent_ids[i]);
+        bool has_parent = (input.parent_ids[i] >= 0 && it != layout->index_of_id.end()
+                           && it->second != i);
+        parent[i] = has_parent ? it->second : virtual_root;
+    }
+
+    // 子节点 CSR (保持输入顺序, 即先左后右)
+    std::vector<int> child_start(n + 2, 0);
+    for (int i = 0; i < n; i++) {
+        child_start[parent[i] + 1]++;
+    }
+    for (int v = 0; v <= n; v++) {
+        child_start[v + 1] += child_start[v];
+    }
+    std::vector<int> children(n);
+    std::vector<int> fill(child_start.begin(), child_start.end() - 1);
+    for (int i = 0; i < n; i++) {
+        children[fill[parent[i]]++] = i;
+    }
+
+    std::vector<double> x(n + 1, 0.0);
+    std::vector<int> depth(n + 1, -1);
+    std::vector<int> preorder;
+    preorder.reserve(n + 1);
+
+    {
+        TidyTreeWalker walker(child_start, children, parent);
+        walker.FirstWalk(virtual_root);
+        walker.SecondWalk(virtual_root, x, depth, preorder);
+    }
+
+    // 输出 (去掉虚拟根; 环上不可达节点保持 depth = -1)
+    layout->child_start.assign(child_start.begin(), child_start.begin() + n + 1);
+    layout->children = children;
+    layout->roots.assign(children.begin() + child_start[virtual_root],
+                         children.begin() + child_start[virtual_root + 1]);
+    layout->children.resize(child_start[n]);  // 去掉虚拟根的子节点段
+    layout->depth.assign(depth.begin(), depth.begin() + n);
+    layout->x.assign(x.begin(), x.begin() + n);
+
+    // 子树包围盒: 逆先序聚合
+    layout->subtree_min_x = layout->x;
+    layout->subtree_max_x = layout->x;
+    layout->subtree_max_depth = layout->depth;
+    layout->subtree_size.assign(n, 1);
+    for (auto it = preorder.rbegin(); it != preorder.rend(); ++it) {
+        int v = *it;
+        if (v == virtual_root) continue;
+        int p = parent[v];
+        if (p == virtual_root) continue;
+        layout->subtree_min_x[p] = std::min(layout->subtree_min_x[p], layout->subtree_min_x[v]);
+        layout->subtree_max_x[p] = std::max(layout->subtree_max_x[p], layout->subtree_max_x[v]);
+        layout->subtree_max_depth[p] = std::max(layout->subtree_max_depth[p],
+                                                layout->subtree_max_depth[v]);
+        layout->subtree_size[p] += layout->subtree_size[v];
+    }
+
+    // 全局范围
+    bool first = true;
+    for (int v : layout->roots) {
+        if (first) {
+            layout->min_x = layout->subtree_min_x[v];
+            layout->max_x = layout->subtree_max_x[v];
+            first = false;
+        }
+        layout->min_x = std::min(layout->min_x, layout->subtree_min_x[v]);
+        layout->max_x = std::max(layout->max_x, layout->subtree_max_x[v]);
+        layout->max_depth = std::max(layout->max_depth, layout->subtree_max_depth[v]);
+    }
+
+    // 深度行索引: 先序遍历中同一深度的节点按从左到右出现, 行内天然有序
+    layout->row_start.assign(layout->max_depth + 2, 0);
+    for (int v = 0; v < n; v++) {
+        if (layout->depth[v] >= 0) layout->row_start[layout->depth[v] + 1]++;
+    }
+    for (int d = 0; d <= layout->max_depth; d++) {
+        layout->row_start[d + 1] += layout->row_start[d];
+    }
+    layout->row_nodes.resize(layout->row_start.back());
+    std::vector<int> row_fill(layout->row_start.begin(), layout->row_start.end() - 1);
+    for (int v : preorder) {
+        if (v == virtual_root || layout->depth[v] < 0) continue;
+        layout->row_nodes[row_fill[layout->depth[v]]++] = v;
+    }
+
+    return layout;
+}
+
+BpTreeWidget::BpTreeWidget(QWidget* parent)
+    : QWidget(parent)
+    , layout_watcher_(new QFutureWatcher<std::shared_ptr<BpTreeLayout>>(this))
+    , layout_pending_(false)
+    , scale_x_(20.0)
+    , scale_y_(40.0)
+    , offset_(kViewMargin, kViewMargin)
+    , dragging_(false)
+    , selected_index_(-1)
+    , pending_select_id_(-1) {
+    setMinimumHeight(200);
+    setMouseTracking(false);
+    connect(layout_watcher_, &QFutureWatcher<std::shared_ptr<BpTreeLayout>>::finished,
+            this, &BpTreeWidget::OnLayoutFinished);
+}
+
+void BpTreeWidget::SetNodes(const std::vector<NodeData>& nodes) {
+    BpTreeInput input;
+    input.ids.reserve(nodes.size());
+    input.parent_ids.reserve(nodes.size());
+    input.status.reserve(nodes.size());
+    for (const auto& node : nodes) {
+        input.ids.push_back(node.id);
+        input.parent_ids.push_back(node.parent_id);
+        input.status.push_back(ParseNodeStatus(node.status));
+    }
+
+    layout_.reset();
+    selected_index_ = -1;
+    layout_pending_ = true;
+    layout_watcher_->setFuture(QtConcurrent::run([input = std::move(input)]() {
+        return BuildBpTreeLayout(input);
+    }));
+    update();
+}
+
+void BpTreeWidget::Clear() {
+    // 丢弃进行中的布局结果
+    layout_watcher_->setFuture(QFuture<std::shared_ptr<BpTreeLayout>>());
+    layout_.reset();
+    layout_pending_ = false;
+    selected_index_ = -1;
+    pending_select_id_ = -1;
+    update();
+}
+
+void BpTreeWidget::OnLayoutFinished() {
+    QFuture<std::shared_ptr<BpTreeLayout>> future = layout_watcher_->future();
+    if (future.resultCount() == 0) return;
+
+    layout_ = future.result();
+    layout_pending_ = false;
+    FitToView();
+
+    if (pending_select_id_ >= 0) {
+        int id = pending_select_id_;
+        pending_select_id_ = -1;
+        SelectNode(id);
+    }
+}
+
+void BpTreeWidget::FitToView() {
+    if (!layout_ || layout_->roots.empty()) {
+        update();
+        return;
+    }
+
+    double span_x = std::max(1.0, layout_->max_x - layout_->min_x);
+    double span_y = std::max(1, layout_->max_depth);
+    double avail_w = std::max(1, width() - 2 * kViewMargin);
+    double avail_h = std::max(1, height() - 2 * kViewMargin);
+
+    scale_x_ = std::clamp(avail_w / span_x, kMinScaleX, kMaxScaleX);
+    scale_y_ = std::clamp(avail_h / span_y, kMinScaleY, kMaxScaleY);
+
+    double tree_w = (layout_->max_x - layout_->min_x) * scale_x_;
+    offset_.setX((width() - tree_w) / 2.0 - layout_->min_x * scale_x_);
+    offset_.setY(kViewMargin);
+    update();
+}
+
+void BpTreeWidget::SelectNode(int node_id) {
+    if (!layout_) {
+        pending_select_id_ = node_id;
+        return;
+    }
+
+    auto it = layout_->index_of_id.find(node_id);
+    if (it == layout_->index_of_id.end() || layout_->depth[it->second] < 0) return;
+
+    selected_index_ = it->second;
+
+    // 居中显示
+    double sx = layout_->x[selected_index_] * scale_x_;
+    double sy = layout_->depth[selected_index_] * scale_y_;
+    offset_ = QPointF(width() / 2.0 - sx, height() / 2.0 - sy);
+    update();
+}
+
+double BpTreeWidget::NodeRadius() const {
+    return std::clamp(std::min(scale_x_, scale_y_) * 0.35, 1.5, 6.0);
+}
+
+QColor BpTreeWidget::GetStatusColor(NodeStatusCode status) {
+    // 与节点表格的状态配色保持一致 (加深以便小尺寸可见)
+    switch (status) {
+        case NodeStatusCode::kInteger:    return QColor(60, 170, 60);
+        case NodeStatusCode::kPruned:     return QColor(150, 150, 150);
+        case NodeStatusCode::kInfeasible: return QColor(210, 70, 70);
+        case NodeStatusCode::kBranched:   return QColor(70, 110, 190);
+        case NodeStatusCode::kActive:     return QColor(230, 160, 40);
+        default:                          return QColor(120, 120, 160);
+    }
+}
+
+void BpTreeWidget::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(250, 250, 250));
+    painter.setPen(QPen(Qt::gray, 1));
+    painter.drawRect(rect().adjusted(0, 0, -1, -1));
+
+    if (!layout_ || layout_->roots.empty()) {
+        painter.setPen(Qt::gray);
+        painter.drawText(rect(), Qt::AlignCenter, layout_pending_ ?
+            QString::fromUtf8("正在计算布局...") :
+            QString::fromUtf8("暂无分支树"));
+        return;
+    }
+
+    DrawTree(painter);
+
+    // 左上角信息
+    painter.setPen(Qt::darkGray);
+    painter.drawText(8, 16, QString::fromUtf8("节点: %1  深度: %2  (滚轮缩放, 拖动平移, 双击适配)")
+        .arg(layout_->node_count).arg(layout_->max_depth));
+}
+
+void BpTreeWidget::DrawTree(QPainter& painter) {
+    const BpTreeLayout& t = *layout_;
+    const double radius = NodeRadius();
+
+    // 可见模型区域 (留出节点半径余量)
+    const double view_x0 = (-offset_.x() - radius) / scale_x_;
+    const double view_x1 = (width() - offset_.x() + radius) / scale_x_;
+    const double view_d0 = (-offset_.y() - radius) / scale_y_;
+    const double view_d1 = (height() - offset_.y() + radius) / scale_y_;
+
+    auto to_screen = [this](double x, double d) {
+        return QPointF(offset_.x() + x * scale_x_, offset_.y() + d * scale_y_);
+    };
+
+    std::vector<QLineF> edges;
+    std::vector<QRectF> node_rects[kNodeStatusCodeCount];
+    std::vector<int> collapsed;
+
+    // 子树层次即空间索引: 包围盒与视口不相交则整棵子树跳过
+    std::vector<int> stack(t.roots.rbegin(), t.roots.rend());
+    while (!stack.empty()) {
+        int v = stack.back();
+        stack.pop_back();
+
+        if (t.subtree_max_x[v] < view_x0 || t.subtree_min_x[v] > view_x1 ||
+            t.subtree_max_depth[v] < view_d0 || t.depth[v] > view_d1) {
+            continue;
+        }
+
+        int begin = t.child_start[v];
+        int end = t.child_start[v + 1];
+
+        // 细节层次: 子树过窄时折叠为聚合图元
+        double subtree_px = (t.subtree_max_x[v] - t.subtree_min_x[v]) * scale_x_;
+        if (end > begin && subtree_px < kCollapsePixels && scale_x_ < kCollapsePixels) {
+            collapsed.push_back(v);
+            continue;
+        }
+
+        QPointF p = to_screen(t.x[v], t.depth[v]);
+        node_rects[static_cast<int>(t.status[v])].emplace_back(
+            p.x() - radius, p.y() - radius, 2 * radius, 2 * radius);
+
+        for (int i = end - 1; i >= begin; i--) {
+            int c = t.children[i];
+            double ex0 = std::min(t.x[v], t.x[c]);
+            double ex1 = std::max(t.x[v], t.x[c]);
+            if (ex1 >= view_x0 && ex0 <= view_x1) {
+                edges.emplace_back(p, to_screen(t.x[c], t.depth[c]));
+            }
+            stack.push_back(c);
+        }
+    }
+
+    // 边
+    painter.setRenderHint(QPainter::Antialiasing, scale_x_ >= kCollapsePixels);
+    painter.setPen(QPen(QColor(170, 170, 170), 1));
+    if (!edges.empty()) {
+        painter.drawLines(edges.data(), static_cast<int>(edges.size()));
+    }
+
+    // 聚合图元: 从子树根到最深层的三角形
+    painter.setPen(QPen(QColor(120, 120, 150), 1));
+    painter.setBrush(QColor(170, 170, 200, 140));
+    for (int v : collapsed) {
+        QPointF apex = to_screen(t.x[v], t.depth[v]);
+        QPointF left = to_screen(t.subtree_min_x[v], t.subtree_max_depth[v]);
+        QPointF right = to_screen(t.subtree_max_x[v], t.subtree_max_depth[v]);
+        if (right.x() - left.x() < 1.0) {
+            painter.drawLine(apex, QPointF(apex.x(), left.y()));
+        } else {
+            QPolygonF triangle;
+            triangle << apex << right << left;
+            painter.drawPolygon(triangle);
+        }
+    }
+
+    // 节点 (按状态批量绘制)
+    painter.setPen(Qt::NoPen);
+    for (int s = 0; s < kNodeStatusCodeCount; s++) {
+        if (node_rects[s].empty()) continue;
+        painter.setBrush(GetStatusColor(static_cast<NodeStatusCode>(s)));
+        if (radius >= 3.0) {
+            for (const QRectF& r : node_rects[s]) painter.drawEllipse(r);
+        } else {
+            painter.drawRects(node_rects[s].data(), static_cast<int>(node_rects[s].size()));
+        }
+    }
+
+    // 折叠子树的节点数标注 (空间足够时)
+    painter.setPen(Qt::darkGray);
+    for (int v : collapsed) {
+        QPointF left = to_screen(t.subtree_min_x[v], t.subtree_max_depth[v]);
+        QPointF right = to_screen(t.subtree_max_x[v], t.subtree_max_depth[v]);
+        if (right.x() - left.x() > 30) {
+            painter.drawText(QRectF(left.x(), left.y() + 2, right.x() - left.x(), 14),
+                             Qt::AlignCenter, QString::number(t.subtree_size[v]));
+        }
+    }
+
+    // 选中节点
+    if (selected_index_ >= 0) {
+        QPointF p = to_screen(t.x[selected_index_], t.depth[selected_index_]);
+        painter.setBrush(Qt::NoBrush);
+        painter.setPen(QPen(QColor(220, 40, 40), 2));
+        double r = radius + 3;
+        painter.drawEllipse(p, r, r);
+    }
+}
+
+int BpTreeWidget::PickNode(const QPointF& pos) const {
+    if (!layout_) return -1;
+    const BpTreeLayout& t = *layout_;
+
+    int d = static_cast<int>(std::lround((pos.y() - offset_.y()) / scale_y_));
+    if (d < 0 || d > t.max_depth) return -1;
+
+    double tolerance_px = std::max(6.0, NodeRadius() + 2);
+    if (std::abs(offset_.y() + d * scale_y_ - pos.y()) > tolerance_px) return -1;
+
+    // 行内按 x 有序, 二分查找最近节点
+    double mx = (pos.x() - offset_.x()) / scale_x_;
+    const int row_begin = t.row_start[d];
+    const int row_end = t.row_start[d + 1];
+    auto it = std::lower_bound(t.row_nodes.begin() + row_begin, t.row_nodes.begin() + row_end, mx,
+        [&t](int v, double value) { return t.x[v] < value; });
+    int pos_in_row = static_cast<int>(it - t.row_nodes.begin());
+
+    int best = -1;
+    double best_dist = tolerance_px;
+    for (int k : {pos_in_row - 1, pos_in_row}) {
+        if (k < row_begin || k >= row_end) continue;
+        int v = t.row_nodes[k];
+        double dist = std::abs((t.x[v] - mx) * scale_x_);
+        if (dist <= best_dist) {
+            best_dist = dist;
+            best = v;
+        }
+    }
+    return best;
+}
+
+void BpTreeWidget::wheelEvent(QWheelEvent* event) {
+    if (!layout_) return;
+
+    QPointF pos = event->position();
+    double factor = std::pow(1.0015, event->angleDelta().y());
+
+    double mx = (pos.x() - offset_.x()) / scale_x_;
+    double md = (pos.y() - offset_.y()) / scale_y_;
+
+    scale_x_ = std::clamp(scale_x_ * factor, kMinScaleX, kMaxScaleX);
+    scale_y_ = std::clamp(scale_y_ * factor, kMinScaleY, kMaxScaleY);
+
+    // 保持光标下的模型点不动
+    offset_ = QPointF(pos.x() - mx * scale_x_, pos.y() - md * scale_y_);
+    update();
+    event->accept();
+}
+
+void BpTreeWidget::mousePressEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton) {
+        dragging_ = true;
+        press_pos_ = event->position().toPoint();
+        last_mouse_pos_ = event->position().toPoint();
+        setCursor(Qt::ClosedHandCursor);
+    }
+}
+
+void BpTreeWidget::mouseMoveEvent(QMouseEvent* event) {
+    if (dragging_) {
+        QPoint delta = event->position().toPoint() - last_mouse_pos_;
+        last_mouse_pos_ = event->position().toPoint();
+        offset_ += delta;
+        update();
+    }
+}
+
+void BpTreeWidget::mouseReleaseEvent(QMouseEvent* event) {
+    if (event->button() != Qt::LeftButton || !dragging_) return;
+    dragging_ = false;
+    unsetCursor();
+
+    // 未发生拖动时视为点击
+    if ((event->position().toPoint() - press_pos_).manhattanLength() < 4) {
+        int v = PickNode(event->position());
+        if (v >= 0) {
+            selected_index_ = v;
+            update();
+            emit NodeSelected(layout_->node_ids[v]);
+        }
+    }
+}
+
+void BpTreeWidget::mouseDoubleClickEvent(QMouseEvent* event) {
+    Q_UNUSED(event);
+    FitToView();
+}
@@ -0,0 +1,117 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// bp_tree_widget.h - 分支定价树可视化组件
+// 布局在后台线程一次性计算 (Buchheim-Walker 整齐树布局, 线性时间),
+// 绘制时按子树包围盒裁剪视口外节点, 像素宽度低于阈值的子树折叠为聚合图元
+
+#ifndef BP_TREE_WIDGET_H_
+#define BP_TREE_WIDGET_H_
+
+#include <QWidget>
+#include <QPoint>
+#include <QPointF>
+#include <QFutureWatcher>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "analysis_data.h"
+
+// 布局输入 (从 NodeData 中提取的精简列, 可廉价拷贝到后台线程)
+struct BpTreeInput {
+    std::vector<int> ids;
+    std::vector<int> parent_ids;
+    std::vector<NodeStatusCode> status;
+};
+
+// 分支树布局 (模型坐标: x 以兄弟节点间距为单位, y 为深度层级)
+struct BpTreeLayout {
+    int node_count = 0;
+    std::vector<int> node_ids;              // 原始节点ID
+    std::vector<NodeStatusCode> status;
+    std::vector<int> child_start;           // 子节点 CSR 偏移 (node_count + 1)
+    std::vector<int> children;              // 子节点下标
+    std::vector<int> roots;                 // 根节点下标
+    std::vector<int> depth;                 // 布局深度 (-1 表示不可达)
+    std::vector<double> x;                  // 横坐标
+
+    // 子树包围盒 (视口裁剪与细节层次)
+    std::vector<double> subtree_min_x;
+    std::vector<double> subtree_max_x;
+    std::vector<int> subtree_max_depth;
+    std::vector<int> subtree_size;
+
+    // 按深度分行的空间索引, 行内按 x 升序 (点击拾取)
+    std::vector<int> row_start;             // max_depth + 2
+    std::vector<int> row_nodes;
+
+    std::unordered_map<int, int> index_of_id;
+
+    double min_x = 0.0;
+    double max_x = 0.0;
+    int max_depth = 0;
+};
+
+// 计算整齐树布局 (线程安全, 无界面依赖)
+std::shared_ptr<BpTreeLayout> BuildBpTreeLayout(const BpTreeInput& input);
+
+class BpTreeWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit BpTreeWidget(QWidget* parent = nullptr);
+
+    // 设置节点数据 (后台计算布局, 完成后自动适配视图)
+    void SetNodes(const std::vector<NodeData>& nodes);
+    void Clear();
+
+    // 选中并居中显示节点
+    void SelectNode(int node_id);
+
+public slots:
+    void FitToView();
+
+signals:
+    void NodeSelected(int node_id);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+
+private slots:
+    void OnLayoutFinished();
+
+private:
+    void DrawTree(QPainter& painter);
+    int PickNode(const QPointF& pos) const;
+    double NodeRadius() const;
+    static QColor GetStatusColor(NodeStatusCode status);
+
+    // 布局
+    std::shared_ptr<BpTreeLayout> layout_;
+    QFutureWatcher<std::shared_ptr<BpTreeLayout>>* layout_watcher_;
+    bool layout_pending_;
+
+    // 视图变换: 屏幕 = offset + 模型 * scale
+    double scale_x_;
+    double scale_y_;
+    QPointF offset_;
+
+    // 交互状态
+    bool dragging_;
+    QPoint press_pos_;
+    QPoint last_mouse_pos_;
+    int selected_index_;
+    int pending_select_id_;
+};
+
+#endif  // BP_TREE_WIDGET_H_
@@ -0,0 +1,285 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// chart_widget.cpp - 轻量图表组件实现
+
+#include "chart_widget.h"
+
+#include <QPainter>
+#include <QPolygonF>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr int kMarginLeft = 56;
+constexpr int kMarginRight = 12;
+constexpr int kMarginTop = 12;
+constexpr int kMarginBottom = 36;
+constexpr int kTickCount = 5;
+constexpr int kMaxLegendItems = 12;
+
+}  // namespace
+
+LineChartWidget::LineChartWidget(QWidget* parent)
+    : QWidget(parent) {
+    setMinimumHeight(160);
+}
+
+void LineChartWidget::SetSeries(std::vector<ChartSeries> series) {
+    series_ = std::move(series);
+    update();
+}
+
+void LineChartWidget::SetAxisTitles(const QString& x_title, const QString& y_title) {
+    x_title_ = x_title;
+    y_title_ = y_title;
+    update();
+}
+
+void LineChartWidget::Clear() {
+    series_.clear();
+    update();
+}
+
+QColor LineChartWidget::GetSeriesColor(int index) {
+    static const QColor palette[] = {
+        QColor(31, 119, 180),
+        QColor(255, 127, 14),
+        QColor(44, 160, 44),
+        QColor(214, 39, 40),
+        QColor(148, 103, 189),
+        QColor(140, 86, 75),
+        QColor(227, 119, 194),
+        QColor(127, 127, 127),
+        QColor(188, 189, 34),
+        QColor(23, 190, 207),
+    };
+    return palette[index % 10];
+}
+
+void LineChartWidget::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), Qt::white);
+
+    QRect plot(kMarginLeft, kMarginTop,
+               width() - kMarginLeft - kMarginRight,
+               height() - kMarginTop - kMarginBottom);
+    if (plot.width() < 20 || plot.height() < 20) return;
+
+    // 数据范围
+    double x_min = 0, x_max = 0, y_min = 0, y_max = 0;
+    bool has_data = false;
+    for (const auto& s : series_) {
+        for (const QPointF& p : s.points) {
+            if (!has_data) {
+                x_min = x_max = p.x();
+                y_min = y_max = p.y();
+                has_data = true;
+            }
+            x_min = std::min(x_min, p.x());
+            x_max = std::max(x_max, p.x());
+            y_min = std::min(y_min, p.y());
+            y_max = std::max(y_max, p.y());
+        }
+    }
+
+    painter.setPen(QPen(Qt::gray, 1));
+    painter.drawRect(plot);
+
+    if (!has_data) {
+        painter.drawText(plot, Qt::AlignCenter, QString::fromUtf8("暂无数据"));
+        return;
+    }
+
+    if (x_max - x_min < 1e-12) x_max = x_min + 1.0;
+    if (y_max - y_min < 1e-12) {
+        y_min -= 0.5;
+        y_max += 0.5;
+    }
+    double y_pad = (y_max - y_min) * 0.05;
+    y_min -= y_pad;
+    y_max += y_pad;
+
+    auto map = [&](const QPointF& p) {
+        return QPointF(plot.left() + (p.x() - x_min) / (x_max - x_min) * plot.width(),
+                       plot.bottom() - (p.y() - y_min) / (y_max - y_min) * plot.height());
+    };
+
+    // 网格与刻度
+    QFont font = painter.font();
+    font.setPointSize(8);
+    painter.setFont(font);
+    for (int i = 0; i <= kTickCount; i++) {
+        double fx = static_cast<double>(i) / kTickCount;
+        int px = plot.left() + static_cast<int>(fx * plot.width());
+        int py = plot.bottom() - static_cast<int>(fx * plot.height());
+
+        painter.setPen(QPen(QColor(235, 235, 235), 1));
+        painter.drawLine(px, plot.top(), px, plot.bottom());
+        painter.drawLine(plot.left(), py, plot.right(), py);
+
+        painter.setPen(Qt::darkGray);
+        painter.drawText(px - 30, plot.bottom() + 2, 60, 14, Qt::AlignCenter,
+                         QString::number(x_min + fx * (x_max - x_min), 'g', 4));
+        painter.drawText(0, py - 7, kMarginLeft - 4, 14, Qt::AlignRight | Qt::AlignVCenter,
+                         QString::number(y_min + fx * (y_max - y_min), 'g', 5));
+    }
+
+    painter.setPen(Qt::darkGray);
+    painter.drawText(plot.left(), height() - 16, plot.width(), 14, Qt::AlignCenter, x_title_);
+    if (!y_title_.isEmpty()) {
+        painter.drawText(4, 0, kMarginLeft, kMarginTop, Qt::AlignLeft | Qt::AlignVCenter, y_title_);
+    }
+
+    // 曲线
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setClipRect(plot.adjusted(1, 1, 0, 0));
+    for (const auto& s : series_) {
+        if (s.points.empty()) continue;
+
+        QPolygonF poly;
+        poly.reserve(static_cast<int>(s.points.size() * (s.step ? 2 : 1) + 1));
+        for (size_t i = 0; i < s.points.size(); i++) {
+            if (s.step && i > 0) {
+                poly << map(QPointF(s.points[i].x(), s.points[i - 1].y()));
+            }
+            poly << map(s.points[i]);
+        }
+        // 阶梯线延伸到右边界
+        if (s.step) {
+            poly << map(QPointF(x_max, s.points.back().y()));
+        }
+
+        painter.setPen(QPen(s.color, 1.5, s.style));
+        painter.drawPolyline(poly);
+    }
+    painter.setClipping(false);
+
+    // 图例
+    int legend_y = plot.top() + 4;
+    int shown = 0;
+    for (const auto& s : series_) {
+        if (s.name.isEmpty()) continue;
+        if (shown++ >= kMaxLegendItems) {
+            painter.setPen(Qt::darkGray);
+            painter.drawText(plot.right() - 150, legend_y, 146, 12, Qt::AlignRight, "...");
+            break;
+        }
+        painter.setPen(QPen(s.color, 2, s.style));
+        painter.drawLine(plot.right() - 170, legend_y + 6, plot.right() - 150, legend_y + 6);
+        painter.setPen(Qt::black);
+        painter.drawText(plot.right() - 146, legend_y, 142, 12, Qt::AlignLeft | Qt::AlignVCenter,
+                         painter.fontMetrics().elidedText(s.name, Qt::ElideMiddle, 142));
+        legend_y += 13;
+    }
+}
+
+BarChartWidget::BarChartWidget(QWidget* parent)
+    : QWidget(parent),
+      bar_color_(31, 119, 180) {
+    setMinimumHeight(120);
+}
+
+void BarChartWidget::SetBars(std::vector<double> values, std::vector<QString> labels) {
+    values_ = std::move(values);
+    labels_ = std::move(labels);
+    labels_.resize(values_.size());
+    update();
+}
+
+void BarChartWidget::SetAxisTitles(const QString& x_title, const QString& y_title) {
+    x_title_ = x_title;
+    y_title_ = y_title;
+    update();
+}
+
+void BarChartWidget::SetBarColor(const QColor& color) {
+    bar_color_ = color;
+    update();
+}
+
+void BarChartWidget::Clear() {
+    values_.clear();
+    labels_.clear();
+    update();
+}
+
+void BarChartWidget::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), Qt::white);
+
+    QRect plot(kMarginLeft, kMarginTop,
+               width() - kMarginLeft - kMarginRight,
+               height() - kMarginTop - kMarginBottom);
+    if (plot.width() < 20 || plot.height() < 20) return;
+
+    painter.setPen(QPen(Qt::gray, 1));
+    painter.drawRect(plot);
+
+    if (values_.empty()) {
+        painter.drawText(plot, Qt::AlignCenter, QString::fromUtf8("暂无数据"));
+        return;
+    }
+
+    double y_max = *std::max_element(values_.begin(), values_.end());
+    if (y_max <= 0) y_max = 1.0;
+    y_max *= 1.05;
+
+    // 网格与纵轴刻度
+    QFont font = painter.font();
+    font.setPointSize(8);
+    painter.setFont(font);
+    for (int i = 0; i <= kTickCount; i++) {
+        double fy = static_cast<double>(i) / kTickCount;
+        int py = plot.bottom() - static_cast<int>(fy * plot.height());
+
+        painter.setPen(QPen(QColor(235, 235, 235), 1));
+        painter.drawLine(plot.left(), py, plot.right(), py);
+
+        painter.setPen(Qt::darkGray);
+        painter.drawText(0, py - 7, kMarginLeft - 4, 14, Qt::AlignRight | Qt::AlignVCenter,
+                         QString::number(fy * y_max, 'g', 4));
+    }
+
+    // 柱子 (一次批量绘制)
+    int count = static_cast<int>(values_.size());
+    double slot = static_cast<double>(plot.width()) / count;
+    double bar_width = std::max(1.0, slot * 0.8);
+
+    std::vector<QRectF> bars;
+    bars.reserve(values_.size());
+    for (int i = 0; i < count; i++) {
+        double h = values_[i] / y_max * plot.height();
+        if (h <= 0) continue;
+        bars.emplace_back(plot.left() + i * slot + (slot - bar_width) / 2,
+                          plot.bottom() - h, bar_width, h);
+    }
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(bar_color_);
+    painter.drawRects(bars.data(), static_cast<int>(bars.size()));
+
+    // 横轴标签 (按可用宽度间隔显示)
+    int label_width = painter.fontMetrics().horizontalAdvance("00000");
+    int label_step = std::max(1, static_cast<int>(std::ceil(label_width / slot)));
+    painter.setPen(Qt::darkGray);
+    for (int i = 0; i < count; i += label_step) {
+        int cx = plot.left() + static_cast<int>((i + 0.5) * slot);
+        painter.drawText(cx - label_width, plot.bottom() + 2, label_width * 2, 14,
+                         Qt::AlignCenter, labels_[i]);
+    }
+
+    painter.drawText(plot.left(), height() - 16, plot.width(), 14, Qt::AlignCenter, x_title_);
+    if (!y_title_.isEmpty()) {
+        painter.drawText(4, 0, kMarginLeft, kMarginTop, Qt::AlignLeft | Qt::AlignVCenter, y_title_);
+    }
+}
@@ -0,0 +1,75 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// chart_widget.h - 轻量图表组件 (QPainter 绘制, 不依赖 Qt Charts)
+// 包含: 折线图 (收敛曲线叠加)、柱状图 (分布直方图)
+
+#ifndef CHART_WIDGET_H_
+#define CHART_WIDGET_H_
+
+#include <QWidget>
+#include <QString>
+#include <QColor>
+#include <QPointF>
+#include <vector>
+
+// 折线数据系列
+struct ChartSeries {
+    QString name;
+    QColor color;
+    Qt::PenStyle style = Qt::SolidLine;
+    bool step = false;              // 阶梯线 (适合上下界随时间变化)
+    std::vector<QPointF> points;    // 按 x 升序
+};
+
+class LineChartWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit LineChartWidget(QWidget* parent = nullptr);
+
+    void SetSeries(std::vector<ChartSeries> series);
+    void SetAxisTitles(const QString& x_title, const QString& y_title);
+    void Clear();
+
+    // 调色板 (按序号循环取色)
+    static QColor GetSeriesColor(int index);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    std::vector<ChartSeries> series_;
+    QString x_title_;
+    QString y_title_;
+};
+
+// 柱状图 (每根柱子一个标签, 标签过密时自动间隔显示)
+class BarChartWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit BarChartWidget(QWidget* parent = nullptr);
+
+    void SetBars(std::vector<double> values, std::vector<QString> labels);
+    void SetAxisTitles(const QString& x_title, const QString& y_title);
+    void SetBarColor(const QColor& color);
+    void Clear();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    std::vector<double> values_;
+    std::vector<QString> labels_;
+    QString x_title_;
+    QString y_title_;
+    QColor bar_color_;
+};
+
+#endif  // CHART_WIDGET_H_
@@ -0,0 +1,369 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// cut_program_export.cpp - DXF 与两阶段切割程序导出实现
+
+#include "cut_program_export.h"
+
+#include <QFile>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <iterator>
+#include <string>
+
+namespace {
+
+constexpr size_t kFlushBytes = 1 << 20;     // 缓冲区达到 1 MB 时写入文件
+constexpr int kProgressInterval = 64;       // 每写出若干块母板报告一次进度
+constexpr int kMaxListedStockIds = 20;      // 程序注释中列出的母板ID数
+
+// 顺序写出的缓冲区: 数字用 to_chars 直接格式化, 不产生临时字符串
+class BufferedWriter {
+public:
+    explicit BufferedWriter(QFile& file) : file_(file) {
+        buffer_.reserve(kFlushBytes + 4096);
+    }
+
+    BufferedWriter& operator<<(const char* text) {
+        buffer_.append(text);
+        return MaybeFlush();
+    }
+
+    BufferedWriter& operator<<(const std::string& text) {
+        buffer_.append(text);
+        return MaybeFlush();
+    }
+
+    BufferedWriter& operator<<(long long value) {
+        char digits[24];
+        auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        buffer_.append(digits, end);
+        return MaybeFlush();
+    }
+
+    BufferedWriter& operator<<(int value) { return *this << static_cast<long long>(value); }
+
+    // 定点小数 (DXF 文字高度等非整数值)
+    BufferedWriter& Fixed(double value, int decimals) {
+        char digits[48];
+        int size = std::snprintf(digits, sizeof(digits), "%.*f", decimals, value);
+        buffer_.append(digits, static_cast<size_t>(std::max(0, size)));
+        return MaybeFlush();
+    }
+
+    bool Flush() {
+        if (!buffer_.empty()) {
+            qint64 size = static_cast<qint64>(buffer_.size());
+            if (file_.write(buffer_.data(), size) != size) ok_ = false;
+            buffer_.clear();
+        }
+        return ok_;
+    }
+
+    bool ok() const { return ok_; }
+
+private:
+    BufferedWriter& MaybeFlush() {
+        if (buffer_.size() >= kFlushBytes) Flush();
+        return *this;
+    }
+
+    QFile& file_;
+    std::string buffer_;
+    bool ok_ = true;
+};
+
+// 导出骨架: 打开文件, 按母板顺序调用 write_stock, 定期报告进度; 取消或失败时删除文件
+template <typename WriteHeader, typename WriteStock, typename WriteFooter>
+StockExportResult StreamStocks(const CuttingSolution& solution, const QString& path,
+                               const StockExportProgress& progress, WriteHeader write_header,
+                               WriteStock write_stock, WriteFooter write_footer) {
+    StockExportResult result;
+    const int count = static_cast<int>(solution.stocks.size());
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        result.error = QString::fromUtf8("无法写入文件: ") + path;
+        return result;
+    }
+
+    BufferedWriter out(file);
+    write_header(out);
+    for (int i = 0; i < count && out.ok(); i++) {
+        write_stock(out, i);
+
+        bool report = (i + 1) % kProgressInterval == 0 || i + 1 == count;
+        if (report && progress && !progress(i + 1, count)) {
+            file.close();
+            file.remove();
+            result.cancelled = true;
+            return result;
+        }
+    }
+    write_footer(out);
+    out.Flush();
+    file.close();
+
+    if (!out.ok() || file.error() != QFileDevice::NoError) {
+        file.remove();
+        result.error = QString::fromUtf8("写入失败: ") + path;
+        return result;
+    }
+
+    result.success = true;
+    result.files << path;
+    return result;
+}
+
+// ----- DXF -----
+
+// 子板颜色: 与界面调色板 (GetItemTypeColor, 12 色) 色相相近的 AutoCAD 浅色索引
+constexpr int kAciPalette[12] = {11, 31, 51, 91, 151, 191, 211, 131, 241, 71, 171, 41};
+
+int DxfStockPitch(const CuttingSolution& solution) {
+    return solution.stock_width + std::max(1, solution.stock_width / 4);
+}
+
+// 组码按 R12 习惯右对齐为 3 位
+void DxfCode(BufferedWriter& out, int code) {
+    out << (code < 10 ? "  " : code < 100 ? " " : "") << code << "\n";
+}
+
+void DxfGroup(BufferedWriter& out, int code, const char* value) {
+    DxfCode(out, code);
+    out << value << "\n";
+}
+
+void DxfGroup(BufferedWriter& out, int code, long long value) {
+    DxfCode(out, code);
+    out << value << "\n";
+}
+
+void DxfGroup(BufferedWriter& out, int code, int value) {
+    DxfGroup(out, code, static_cast<long long>(value));
+}
+
+void DxfLine(BufferedWriter& out, const char* layer, long long x0, long long y0,
+             long long x1, long long y1) {
+    DxfGroup(out, 0, "LINE");
+    DxfGroup(out, 8, layer);
+    DxfGroup(out, 10, x0);
+    DxfGroup(out, 20, y0);
+    DxfGroup(out, 11, x1);
+    DxfGroup(out, 21, y1);
+}
+
+// 闭合矩形 (R12 POLYLINE + 4 个 VERTEX)
+void DxfRect(BufferedWriter& out, const char* layer, int color, long long x, long long y,
+             long long length, long long width) {
+    DxfGroup(out, 0, "POLYLINE");
+    DxfGroup(out, 8, layer);
+    if (color > 0) DxfGroup(out, 62, color);
+    DxfGroup(out, 66, 1);
+    DxfGroup(out, 10, 0LL);
+    DxfGroup(out, 20, 0LL);
+    DxfGroup(out, 70, 1);
+    const long long xs[4] = {x, x + length, x + length, x};
+    const long long ys[4] = {y, y, y + width, y + width};
+    for (int k = 0; k < 4; k++) {
+        DxfGroup(out, 0, "VERTEX");
+        DxfGroup(out, 8, layer);
+        DxfGroup(out, 10, xs[k]);
+        DxfGroup(out, 20, ys[k]);
+    }
+    DxfGroup(out, 0, "SEQEND");
+    DxfGroup(out, 8, layer);
+}
+
+void DxfText(BufferedWriter& out, const char* layer, double x, double y, double height,
+             const std::string& text) {
+    DxfGroup(out, 0, "TEXT");
+    DxfGroup(out, 8, layer);
+    DxfCode(out, 10);
+    out.Fixed(x, 2) << "\n";
+    DxfCode(out, 20);
+    out.Fixed(y, 2) << "\n";
+    DxfCode(out, 40);
+    out.Fixed(height, 2) << "\n";
+    DxfGroup(out, 1, text.c_str());
+}
+
+void DxfHeader(BufferedWriter& out, const CuttingSolution& solution) {
+    const long long extent_y =
+        static_cast<long long>(DxfStockPitch(solution)) * static_cast<long long>(solution.stocks.size());
+
+    DxfGroup(out, 0, "SECTION");
+    DxfGroup(out, 2, "HEADER");
+    DxfGroup(out, 9, "$ACADVER");
+    DxfGroup(out, 1, "AC1009");
+    DxfGroup(out, 9, "$EXTMIN");
+    DxfGroup(out, 10, 0LL);
+    DxfGroup(out, 20, 0LL);
+    DxfGroup(out, 9, "$EXTMAX");
+    DxfGroup(out, 10, solution.stock_length);
+    DxfGroup(out, 20, extent_y);
+    DxfGroup(out, 0, "ENDSEC");
+
+    DxfGroup(out, 0, "SECTION");
+    DxfGroup(out, 2, "TABLES");
+    DxfGroup(out, 0, "TABLE");
+    DxfGroup(out, 2, "LTYPE");
+    DxfGroup(out, 70, 1);
+    DxfGroup(out, 0, "LTYPE");
+    DxfGroup(out, 2, "CONTINUOUS");
+    DxfGroup(out, 70, 0);
+    DxfGroup(out, 3, "Solid line");
+    DxfGroup(out, 72, 65);
+    DxfGroup(out, 73, 0);
+    DxfGroup(out, 40, "0.0");
+    DxfGroup(out, 0, "ENDTAB");
+
+    struct Layer { const char* name; int color; };
+    const Layer layers[] = {
+        {"STOCK", 8}, {"ITEMS", 7}, {"CUT1", 1}, {"CUT2", 5}, {"LABELS", 7}
+    };
+    DxfGroup(out, 0, "TABLE");
+    DxfGroup(out, 2, "LAYER");
+    DxfGroup(out, 70, static_cast<int>(std::size(layers)));
+    for (const Layer& layer : layers) {
+        DxfGroup(out, 0, "LAYER");
+        DxfGroup(out, 2, layer.name);
+        DxfGroup(out, 70, 0);
+        DxfGroup(out, 62, layer.color);
+        DxfGroup(out, 6, "CONTINUOUS");
+    }
+    DxfGroup(out, 0, "ENDTAB");
+    DxfGroup(out, 0, "ENDSEC");
+
+    DxfGroup(out, 0, "SECTION");
+    DxfGroup(out, 2, "ENTITIES");
+}
+
+// 一块母板: 第 index 块的原点在 (0, index * 间距)
+void DxfStock(BufferedWriter& out, const CuttingSolution& solution, int index) {
+    const StockData& stock = solution.stocks[index];
+    const int w = solution.stock_width;
+    const int l = solution.stock_length;
+    const long long oy = static_cast<long long>(DxfStockPitch(solution)) * index;
+
+    double title_height = std::max(1, solution.stock_width / 4) * 0.4;
+    char title[128];
+    std::snprintf(title, sizeof(title), "PATTERN %d/%d  x%d  UTIL %.1f%%  ITEMS %d",
+                  index + 1, static_cast<int>(solution.stocks.size()), stock.multiplicity,
+                  stock.utilization * 100, static_cast<int>(stock.items.size()));
+    DxfText(out, "LABELS", 0, oy + w + title_height * 0.5, title_height, title);
+
+    DxfRect(out, "STOCK", 0, 0, oy, l, w);
+
+    double label_height = std::max(1.0, std::min(l, w) / 40.0);
+    for (const auto& item : stock.items) {
+        int palette = ((item.item_type - 1) % 12 + 12) % 12;
+        DxfRect(out, "ITEMS", kAciPalette[palette], item.x, oy + item.y, item.length, item.width);
+        if (item.length >= label_height * 3 && item.width >= label_height * 1.5) {
+            DxfText(out, "LABELS", item.x + label_height * 0.3,
+                    oy + item.y + label_height * 0.3, label_height,
+                    "T" + std::to_string(item.item_type));
+        }
+    }
+
+    const CutGeometry& cuts = stock.cuts;
+    for (int y : cuts.stage1_y) {
+        DxfLine(out, "CUT1", 0, oy + y, l, oy + y);
+    }
+    for (size_t i = 0; i < cuts.stage2_x.size(); i++) {
+        DxfLine(out, "CUT2", cuts.stage2_x[i], oy + cuts.stage2_y0[i],
+                cuts.stage2_x[i], oy + cuts.stage2_y1[i]);
+    }
+}
+
+// ----- 切割程序 -----
+
+void ProgramHeader(BufferedWriter& out, const CuttingSolution& solution) {
+    out << "%\n(CS-2D-GUI TWO-STAGE CUT PROGRAM)\n"
+        << "(STOCK L" << solution.stock_length << " W" << solution.stock_width
+        << ", PATTERNS " << static_cast<int>(solution.stocks.size())
+        << ", STOCKS " << std::max(solution.physical_stock_count,
+                                   static_cast<int>(solution.stocks.size())) << ")\n"
+        << "(ORIGIN LOWER LEFT, X ALONG LENGTH, Y ALONG WIDTH)\n";
+}
+
+// 一种切割方式一个程序段; 往返交替切割方向, 减少空行程
+void ProgramStock(BufferedWriter& out, const CuttingSolution& solution, int index) {
+    const StockData& stock = solution.stocks[index];
+    const CutGeometry& cuts = stock.cuts;
+    const int l = solution.stock_length;
+
+    char line[160];
+    std::snprintf(line, sizeof(line), "O%04d (PATTERN %d/%d REPEAT %d UTIL %.1f%% ITEMS %d)\n",
+                  (index % 9999) + 1, index + 1, static_cast<int>(solution.stocks.size()),
+                  stock.multiplicity, stock.utilization * 100,
+                  static_cast<int>(stock.items.size()));
+    out << line;
+
+    if (!stock.stock_ids.empty()) {
+        out << "(STOCK IDS";
+        int listed = std::min(static_cast<int>(stock.stock_ids.size()), kMaxListedStockIds);
+        for (int k = 0; k < listed; k++) out << " " << stock.stock_ids[k];
+        if (listed < static_cast<int>(stock.stock_ids.size())) out << " ...";
+        out << ")\n";
+    }
+    out << "G90 G17\n";
+
+    // 第一阶段: 沿 X 贯穿母板全长的纵切, 按 y 升序
+    out << "(STAGE 1 RIPS " << cuts.Stage1Count() << ")\n";
+    bool forward = true;
+    for (int y : cuts.stage1_y) {
+        out << "G0 X" << (forward ? 0 : l) << " Y" << y << "\n"
+            << "G1 X" << (forward ? l : 0) << "\n";
+        forward = !forward;
+    }
+
+    // 第二阶段: 逐条带沿 Y 横切, 条带按 y 升序, 条带内按 x 升序
+    out << "(STAGE 2 CROSSCUTS " << cuts.Stage2Count() << ")\n";
+    int run_count = static_cast<int>(cuts.stage2_run_start.size()) - 1;
+    for (int run = 0; run < run_count; run++) {
+        int begin = cuts.stage2_run_start[run];
+        int end = cuts.stage2_run_start[run + 1];
+        if (begin == end) continue;
+
+        int y0 = cuts.stage2_y0[begin];
+        int y1 = cuts.stage2_y1[begin];
+        out << "(STRIP Y" << y0 << "-" << y1 << ")\n";
+        bool upward = true;
+        for (int i = begin; i < end; i++) {
+            out << "G0 X" << cuts.stage2_x[i] << " Y" << (upward ? y0 : y1) << "\n"
+                << "G1 Y" << (upward ? y1 : y0) << "\n";
+            upward = !upward;
+        }
+    }
+    out << "M30\n";
+}
+
+}  // namespace
+
+StockExportResult ExportStocksDxf(const CuttingSolution& solution, const QString& path,
+                                  const StockExportProgress& progress) {
+    return StreamStocks(
+        solution, path, progress,
+        [&solution](BufferedWriter& out) { DxfHeader(out, solution); },
+        [&solution](BufferedWriter& out, int index) { DxfStock(out, solution, index); },
+        [](BufferedWriter& out) {
+            DxfGroup(out, 0, "ENDSEC");
+            DxfGroup(out, 0, "EOF");
+        });
+}
+
+StockExportResult ExportStocksCutProgram(const CuttingSolution& solution, const QString& path,
+                                         const StockExportProgress& progress) {
+    return StreamStocks(
+        solution, path, progress,
+        [&solution](BufferedWriter& out) { ProgramHeader(out, solution); },
+        [&solution](BufferedWriter& out, int index) { ProgramStock(out, solution, index); },
+        [](BufferedWriter& out) { out << "%\n"; });
+}
@@ -0,0 +1,34 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// cut_program_export.h - 切割方案导出为 DXF 图形与两阶段切割程序 (G 代码)
+// 供锯切设备软件直接导入, 不再根据截图手工录入
+//
+// DXF: AutoCAD R12 ASCII, 母板沿 Y 方向依次排列 (DXF 与模型同为左下角原点, 无需翻转);
+//      图层 STOCK (母板轮廓) / ITEMS (子板) / CUT1 (第一阶段) / CUT2 (第二阶段) / LABELS (标注)
+// G 代码: 每种切割方式一个程序段 O0001 ...; 先第一阶段纵切 (贯穿母板全长),
+//      再逐条带第二阶段横切; 注释只使用 ASCII, 兼容常见控制器
+//
+// 两种格式都按母板顺序直接写入缓冲区, 不为母板构建中间对象, 导出耗时由磁盘写入决定
+
+#ifndef CUT_PROGRAM_EXPORT_H_
+#define CUT_PROGRAM_EXPORT_H_
+
+#include <QString>
+#include "cutting_data.h"
+#include "stock_export.h"
+
+// 导出 DXF (阻塞, 取消或失败时删除输出文件)
+StockExportResult ExportStocksDxf(const CuttingSolution& solution, const QString& path,
+                                  const StockExportProgress& progress = StockExportProgress());
+
+// 导出两阶段切割程序 (阻塞, 取消或失败时删除输出文件)
+StockExportResult ExportStocksCutProgram(const CuttingSolution& solution, const QString& path,
+                                         const StockExportProgress& progress = StockExportProgress());
+
+#endif  // CUT_PROGRAM_EXPORT_H_
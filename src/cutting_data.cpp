@@ -0,0 +1,537 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// cutting_data.cpp - 切割方案数据处理实现
+
+#include "cutting_data.h"
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+bool LoadCuttingSolution(const QString& json_path, CuttingSolution* solution, QString* error) {
+    QFile file(json_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (error) *error = QString::fromUtf8("无法打开文件: ") + json_path;
+        return false;
+    }
+
+    QByteArray data = file.readAll();
+    QJsonDocument doc = QJsonDocument::fromJson(data);
+    if (doc.isNull()) {
+        if (error) *error = QString::fromUtf8("JSON 解析错误: ") + json_path;
+        return false;
+    }
+
+    return ParseCuttingSolution(doc.object(), solution);
+}
+
+bool ParseCuttingSolution(const QJsonObject& root, CuttingSolution* solution) {
+    CuttingSolution result;
+
+    // 读取母板尺寸
+    QJsonObject stock = root["stock"].toObject();
+    result.stock_width = stock["width"].toInt();
+    result.stock_length = stock["length"].toInt();
+
+    // 子板类型 (类型编号缺省为数组下标 + 1)
+    QJsonArray item_types = root["item_types"].toArray();
+    result.item_type_count = item_types.size();
+    result.item_types.reserve(item_types.size());
+    for (int i = 0; i < item_types.size(); i++) {
+        QJsonObject type_obj = item_types[i].toObject();
+        ItemTypeSpec spec;
+        spec.type_id = type_obj["type_id"].toInt(type_obj["id"].toInt(i + 1));
+        spec.width = type_obj["width"].toInt();
+        spec.length = type_obj["length"].toInt();
+        spec.demand = type_obj["demand"].toInt(-1);
+        result.item_types.push_back(spec);
+    }
+
+    // 读取所有母板 (一块连续存储)
+    result.stocks = ParseStocks(root["stocks"].toArray());
+    result.physical_stock_count = static_cast<int>(result.stocks.size());
+
+    // 相同切割方式只保留一份, 几何与索引按切割方式计算一次
+    DeduplicatePatterns(result.stocks);
+    if (static_cast<int>(result.stocks.size()) < result.physical_stock_count) {
+        PackStocks(result.stocks);
+    }
+    for (auto& stock : result.stocks) {
+        BuildCutGeometry(stock, result.stock_width, result.stock_length);
+        BuildItemIndex(stock, result.stock_width, result.stock_length);
+    }
+
+    *solution = std::move(result);
+    return true;
+}
+
+std::vector<StockData> ParseStocks(const QJsonArray& stocks_array) {
+    // 先统计条带与子板总数, 一次分配扁平存储, 再按顺序填充
+    size_t strip_total = 0;
+    size_t item_total = 0;
+    for (const auto& stock_val : stocks_array) {
+        QJsonObject stock_obj = stock_val.toObject();
+        strip_total += stock_obj["strips"].toArray().size();
+        item_total += stock_obj["items"].toArray().size();
+    }
+
+    auto arena = std::make_shared<SolutionArena>();
+    arena->strips.reserve(strip_total);
+    arena->items.reserve(item_total);
+
+    std::vector<std::pair<size_t, size_t>> strip_ranges;   // (起点, 数量)
+    std::vector<std::pair<size_t, size_t>> item_ranges;
+    strip_ranges.reserve(stocks_array.size());
+    item_ranges.reserve(stocks_array.size());
+    std::vector<StockData> stocks;
+    stocks.reserve(stocks_array.size());
+
+    for (const auto& stock_val : stocks_array) {
+        QJsonObject stock_obj = stock_val.toObject();
+
+        StockData stock;
+        stock.stock_id = stock_obj["stock_id"].toInt();
+        stock.utilization = stock_obj["utilization"].toDouble();
+
+        // 读取条带信息
+        QJsonArray strips_array = stock_obj["strips"].toArray();
+        strip_ranges.emplace_back(arena->strips.size(), strips_array.size());
+        for (const auto& strip_val : strips_array) {
+            QJsonObject strip_obj = strip_val.toObject();
+
+            StripRect strip;
+            strip.strip_id = strip_obj["strip_id"].toInt();
+            strip.y = strip_obj["y"].toInt();
+            strip.width = strip_obj["width"].toInt();
+
+            arena->strips.push_back(strip);
+        }
+
+        // 读取子板信息
+        QJsonArray items_array = stock_obj["items"].toArray();
+        item_ranges.emplace_back(arena->items.size(), items_array.size());
+        for (const auto& item_val : items_array) {
+            QJsonObject item_obj = item_val.toObject();
+
+            ItemRect item;
+            item.item_type = item_obj["item_type"].toInt();
+            item.x = item_obj["x"].toInt();
+            item.y = item_obj["y"].toInt();
+            item.width = item_obj["width"].toInt();
+            item.length = item_obj["length"].toInt();
+            item.strip_id = item_obj["strip_id"].toInt(-1);  // 兼容旧格式
+
+            arena->items.push_back(item);
+        }
+
+        stocks.push_back(std::move(stock));
+    }
+
+    // 存储填充完毕后再建立区段 (期间数组不再重新分配)
+    for (size_t i = 0; i < stocks.size(); i++) {
+        StockData& stock = stocks[i];
+        stock.strips = ArraySpan<StripRect>(arena->strips.data() + strip_ranges[i].first,
+                                            strip_ranges[i].second);
+        stock.items = ArraySpan<ItemRect>(arena->items.data() + item_ranges[i].first,
+                                          item_ranges[i].second);
+        stock.arena = arena;
+    }
+    return stocks;
+}
+
+namespace {
+
+// 规范顺序: 条带按 (y, 宽度), 子板按 (y, x, 宽度, 长度, 类型)
+void CanonicalizeStock(StockData& stock) {
+    std::sort(stock.strips.begin(), stock.strips.end(),
+              [](const StripRect& a, const StripRect& b) {
+                  return a.y != b.y ? a.y < b.y : a.width < b.width;
+              });
+    std::sort(stock.items.begin(), stock.items.end(),
+              [](const ItemRect& a, const ItemRect& b) {
+                  if (a.y != b.y) return a.y < b.y;
+                  if (a.x != b.x) return a.x < b.x;
+                  if (a.width != b.width) return a.width < b.width;
+                  if (a.length != b.length) return a.length < b.length;
+                  return a.item_type < b.item_type;
+              });
+}
+
+// FNV-1a 64 位
+void HashInt(unsigned long long& h, int value) {
+    unsigned int v = static_cast<unsigned int>(value);
+    for (int i = 0; i < 4; i++) {
+        h ^= (v >> (i * 8)) & 0xFFu;
+        h *= 1099511628211ULL;
+    }
+}
+
+unsigned long long PatternHash(const StockData& stock) {
+    unsigned long long h = 14695981039346656037ULL;
+    HashInt(h, static_cast<int>(stock.strips.size()));
+    for (const auto& strip : stock.strips) {
+        HashInt(h, strip.y);
+        HashInt(h, strip.width);
+    }
+    HashInt(h, static_cast<int>(stock.items.size()));
+    for (const auto& item : stock.items) {
+        HashInt(h, item.item_type);
+        HashInt(h, item.x);
+        HashInt(h, item.y);
+        HashInt(h, item.width);
+        HashInt(h, item.length);
+    }
+    return h;
+}
+
+bool SamePattern(const ArraySpan<StripRect>& strips, const ArraySpan<ItemRect>& items,
+                 const StockData& b) {
+    if (strips.size() != b.strips.size() || items.size() != b.items.size()) return false;
+    for (size_t i = 0; i < strips.size(); i++) {
+        if (strips[i].y != b.strips[i].y || strips[i].width != b.strips[i].width) return false;
+    }
+    for (size_t i = 0; i < items.size(); i++) {
+        const ItemRect& p = items[i];
+        const ItemRect& q = b.items[i];
+        if (p.item_type != q.item_type || p.x != q.x || p.y != q.y ||
+            p.width != q.width || p.length != q.length) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+void PatternTable::Reserve(size_t count) {
+    patterns_.reserve(count);
+    by_hash_.reserve(count);
+}
+
+int PatternTable::Insert(StockData& stock) {
+    CanonicalizeStock(stock);
+    unsigned long long h = PatternHash(stock);
+
+    auto range = by_hash_.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Pattern& pattern = patterns_[it->second];
+        if (SamePattern(pattern.strips, pattern.items, stock)) return it->second;
+    }
+
+    by_hash_.emplace(h, size());
+    patterns_.push_back(Pattern{stock.strips, stock.items});
+    return -1;
+}
+
+void PatternTable::Add(const StockData& stock) {
+    by_hash_.emplace(PatternHash(stock), size());
+    patterns_.push_back(Pattern{stock.strips, stock.items});
+}
+
+int PatternTable::Find(const StockData& stock) const {
+    auto range = by_hash_.equal_range(PatternHash(stock));
+    for (auto it = range.first; it != range.second; ++it) {
+        const Pattern& pattern = patterns_[it->second];
+        if (SamePattern(pattern.strips, pattern.items, stock)) return it->second;
+    }
+    return -1;
+}
+
+void PatternTable::Rebind(int index, const StockData& stock) {
+    patterns_[index] = Pattern{stock.strips, stock.items};
+}
+
+void DeduplicatePatterns(std::vector<StockData>& stocks) {
+    std::vector<StockData> patterns;
+    PatternTable table;
+    table.Reserve(stocks.size());
+
+    for (auto& stock : stocks) {
+        int found = table.Insert(stock);
+        if (found >= 0) {
+            StockData& pattern = patterns[found];
+            pattern.multiplicity += stock.multiplicity;
+            pattern.stock_ids.insert(pattern.stock_ids.end(),
+                                     stock.stock_ids.begin(), stock.stock_ids.end());
+            if (stock.stock_ids.empty()) pattern.stock_ids.push_back(stock.stock_id);
+            continue;
+        }
+
+        if (stock.stock_ids.empty()) stock.stock_ids.push_back(stock.stock_id);
+        patterns.push_back(std::move(stock));
+    }
+
+    stocks = std::move(patterns);
+}
+
+void PackStocks(std::vector<StockData>& stocks) {
+    size_t strip_total = 0;
+    size_t item_total = 0;
+    for (const auto& stock : stocks) {
+        strip_total += stock.strips.size();
+        item_total += stock.items.size();
+    }
+
+    auto arena = std::make_shared<SolutionArena>();
+    arena->strips.reserve(strip_total);
+    arena->items.reserve(item_total);
+    for (const auto& stock : stocks) {
+        arena->strips.insert(arena->strips.end(), stock.strips.begin(), stock.strips.end());
+        arena->items.insert(arena->items.end(), stock.items.begin(), stock.items.end());
+    }
+
+    StripRect* strip_ptr = arena->strips.data();
+    ItemRect* item_ptr = arena->items.data();
+    for (auto& stock : stocks) {
+        stock.strips = ArraySpan<StripRect>(strip_ptr, stock.strips.size());
+        stock.items = ArraySpan<ItemRect>(item_ptr, stock.items.size());
+        strip_ptr += stock.strips.size();
+        item_ptr += stock.items.size();
+        stock.arena = arena;   // 旧存储在最后一个引用释放时回收
+    }
+}
+
+void BuildCutGeometry(StockData& stock, int stock_width, int stock_length) {
+    CutGeometry cuts;
+
+    // 第一阶段切割线 (条带上边界, 母板上边缘除外)
+    for (const auto& strip : stock.strips) {
+        int strip_top = strip.y + strip.width;
+        if (strip_top < stock_width) {
+            cuts.stage1_y.push_back(strip_top);
+        }
+    }
+    std::sort(cuts.stage1_y.begin(), cuts.stage1_y.end());
+    cuts.stage1_y.erase(std::unique(cuts.stage1_y.begin(), cuts.stage1_y.end()),
+                        cuts.stage1_y.end());
+    cuts.stage1_length = static_cast<long long>(cuts.stage1_y.size()) * stock_length;
+
+    auto has_stage1_at = [&cuts](int y) {
+        return std::binary_search(cuts.stage1_y.begin(), cuts.stage1_y.end(), y);
+    };
+
+    // 第二阶段切割线 (同一条带内子板右边界, 母板右边缘除外)
+    std::unordered_map<int, std::vector<int>> strip_boundaries;
+    for (const auto& item : stock.items) {
+        int right_x = item.x + item.length;
+        if (right_x < stock_length) {
+            strip_boundaries[item.strip_id].push_back(right_x);
+        }
+    }
+
+    // 条带按 y 排序, 使第二阶段切割线按 (y, x) 有序, 可按视口二分查找
+    std::vector<const StripRect*> strips_by_y;
+    strips_by_y.reserve(stock.strips.size());
+    for (const auto& strip : stock.strips) strips_by_y.push_back(&strip);
+    std::stable_sort(strips_by_y.begin(), strips_by_y.end(),
+                     [](const StripRect* a, const StripRect* b) { return a->y < b->y; });
+
+    for (const StripRect* strip_ptr : strips_by_y) {
+        const StripRect& strip = *strip_ptr;
+        auto it = strip_boundaries.find(strip.strip_id);
+        if (it == strip_boundaries.end()) continue;
+
+        std::vector<int>& xs = it->second;
+        std::sort(xs.begin(), xs.end());
+        xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+
+        int y0 = strip.y;
+        int y1 = strip.y + strip.width;
+        unsigned char trim = 0;
+        if (has_stage1_at(y0)) trim |= kCutTrimBottom;
+        if (has_stage1_at(y1)) trim |= kCutTrimTop;
+
+        cuts.stage2_run_start.push_back(static_cast<int>(cuts.stage2_x.size()));
+        for (int x : xs) {
+            cuts.stage2_x.push_back(x);
+            cuts.stage2_y0.push_back(y0);
+            cuts.stage2_y1.push_back(y1);
+            cuts.stage2_trim.push_back(trim);
+            cuts.stage2_length += y1 - y0;
+        }
+    }
+
+    cuts.stage2_run_start.push_back(static_cast<int>(cuts.stage2_x.size()));
+
+    stock.cuts = std::move(cuts);
+}
+
+void BuildItemIndex(StockData& stock, int stock_width, int stock_length) {
+    ItemGridIndex index;
+    if (stock_width <= 0 || stock_length <= 0 || stock.items.empty()) {
+        stock.index = std::move(index);
+        return;
+    }
+
+    // 格子边长: 母板面积平均分给 items / kItemsPerGridCell 个格子
+    double area = static_cast<double>(stock_width) * stock_length;
+    double cells = std::max(1.0, static_cast<double>(stock.items.size()) / kItemsPerGridCell);
+    index.cell_size = std::max(1, static_cast<int>(std::ceil(std::sqrt(area / cells))));
+    index.cols = (stock_length + index.cell_size - 1) / index.cell_size;
+    index.rows = (stock_width + index.cell_size - 1) / index.cell_size;
+
+    int cell_count = index.cols * index.rows;
+    auto cell_range = [&](const ItemRect& item, int& cx0, int& cy0, int& cx1, int& cy1) {
+        cx0 = std::clamp(item.x / index.cell_size, 0, index.cols - 1);
+        cy0 = std::clamp(item.y / index.cell_size, 0, index.rows - 1);
+        cx1 = std::clamp((item.x + std::max(1, item.length) - 1) / index.cell_size, 0, index.cols - 1);
+        cy1 = std::clamp((item.y + std::max(1, item.width) - 1) / index.cell_size, 0, index.rows - 1);
+    };
+
+    // 两遍扫描构建 CSR: 先计数, 再填充
+    index.cell_start.assign(cell_count + 1, 0);
+    for (const auto& item : stock.items) {
+        int cx0, cy0, cx1, cy1;
+        cell_range(item, cx0, cy0, cx1, cy1);
+        for (int cy = cy0; cy <= cy1; cy++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                index.cell_start[cy * index.cols + cx + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < cell_count; i++) {
+        index.cell_start[i + 1] += index.cell_start[i];
+    }
+
+    index.cell_items.resize(index.cell_start[cell_count]);
+    std::vector<int> fill(index.cell_start.begin(), index.cell_start.end() - 1);
+    std::vector<double> covered(cell_count, 0.0);
+    std::vector<double> dominant_area(cell_count, 0.0);
+    index.cell_dominant_type.assign(cell_count, 0);
+
+    // 按类型累计面积需要逐格统计, 这里用 (格子, 类型) -> 面积的稀疏表
+    std::unordered_map<long long, double> type_area;
+
+    for (int i = 0; i < static_cast<int>(stock.items.size()); i++) {
+        const ItemRect& item = stock.items[i];
+        int cx0, cy0, cx1, cy1;
+        cell_range(item, cx0, cy0, cx1, cy1);
+        for (int cy = cy0; cy <= cy1; cy++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                int cell = cy * index.cols + cx;
+                index.cell_items[fill[cell]++] = i;
+
+                // 子板与格子的交集面积
+                int ix0 = std::max(item.x, cx * index.cell_size);
+                int ix1 = std::min(item.x + item.length, (cx + 1) * index.cell_size);
+                int iy0 = std::max(item.y, cy * index.cell_size);
+                int iy1 = std::min(item.y + item.width, (cy + 1) * index.cell_size);
+                double overlap = static_cast<double>(std::max(0, ix1 - ix0)) * std::max(0, iy1 - iy0);
+                if (overlap <= 0) continue;
+
+                covered[cell] += overlap;
+                double& acc = type_area[static_cast<long long>(cell) * 65536 + item.item_type];
+                acc += overlap;
+                if (acc > dominant_area[cell]) {
+                    dominant_area[cell] = acc;
+                    index.cell_dominant_type[cell] = item.item_type;
+                }
+            }
+        }
+    }
+
+    // 覆盖率按格子在母板内的实际面积计算 (边缘格子可能不完整)
+    index.cell_coverage.resize(cell_count);
+    for (int cy = 0; cy < index.rows; cy++) {
+        int h = std::min(stock_width, (cy + 1) * index.cell_size) - cy * index.cell_size;
+        for (int cx = 0; cx < index.cols; cx++) {
+            int w = std::min(stock_length, (cx + 1) * index.cell_size) - cx * index.cell_size;
+            int cell = cy * index.cols + cx;
+            double cell_area = static_cast<double>(w) * h;
+            index.cell_coverage[cell] = cell_area > 0
+                ? static_cast<float>(std::min(1.0, covered[cell] / cell_area)) : 0.0f;
+        }
+    }
+
+    stock.index = std::move(index);
+}
+
+void QueryItems(const StockData& stock, int x0, int y0, int x1, int y1,
+                std::vector<int>& result) {
+    result.clear();
+    const ItemGridIndex& index = stock.index;
+    if (index.empty() || x1 <= x0 || y1 <= y0) return;
+
+    int cs = index.cell_size;
+    int cx0 = std::clamp(x0 / cs, 0, index.cols - 1);
+    int cy0 = std::clamp(y0 / cs, 0, index.rows - 1);
+    int cx1 = std::clamp((x1 - 1) / cs, 0, index.cols - 1);
+    int cy1 = std::clamp((y1 - 1) / cs, 0, index.rows - 1);
+
+    for (int cy = cy0; cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            int cell = cy * index.cols + cx;
+            for (int k = index.cell_start[cell]; k < index.cell_start[cell + 1]; k++) {
+                int i = index.cell_items[k];
+                const ItemRect& item = stock.items[i];
+                if (item.x >= x1 || item.x + item.length <= x0 ||
+                    item.y >= y1 || item.y + item.width <= y0) {
+                    continue;
+                }
+                // 跨格子的子板只在 "交集左下角所在格子" 中报告一次, 无需去重表
+                int rx = std::max(item.x, x0) / cs;
+                int ry = std::max(item.y, y0) / cs;
+                if (std::min(rx, index.cols - 1) == cx && std::min(ry, index.rows - 1) == cy) {
+                    result.push_back(i);
+                }
+            }
+        }
+    }
+}
+
+void QueryStage2Cuts(const CutGeometry& cuts, int x0, int y0, int x1, int y1,
+                     std::vector<std::pair<int, int>>& ranges) {
+    ranges.clear();
+    int run_count = static_cast<int>(cuts.stage2_run_start.size()) - 1;
+    if (run_count <= 0) return;
+
+    // 条带互不重叠且按 y 有序: 先二分找到第一个上端 >= y0 的条带
+    int lo = 0, hi = run_count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (cuts.stage2_y1[cuts.stage2_run_start[mid]] < y0) lo = mid + 1;
+        else hi = mid;
+    }
+
+    for (int run = lo; run < run_count; run++) {
+        int begin = cuts.stage2_run_start[run];
+        int end = cuts.stage2_run_start[run + 1];
+        if (begin == end) continue;
+        if (cuts.stage2_y0[begin] > y1) break;
+
+        // 条带内按 x 有序
+        auto first = std::lower_bound(cuts.stage2_x.begin() + begin, cuts.stage2_x.begin() + end, x0);
+        auto last = std::upper_bound(first, cuts.stage2_x.begin() + end, x1);
+        if (first != last) {
+            ranges.emplace_back(static_cast<int>(first - cuts.stage2_x.begin()),
+                                static_cast<int>(last - cuts.stage2_x.begin()));
+        }
+    }
+}
+
+void AssignItemsToStrips(const StockData& stock, std::vector<int>& item_strip) {
+    std::vector<int> strip_order(stock.strips.size());
+    for (size_t i = 0; i < strip_order.size(); i++) strip_order[i] = static_cast<int>(i);
+    std::sort(strip_order.begin(), strip_order.end(),
+              [&stock](int a, int b) { return stock.strips[a].y < stock.strips[b].y; });
+
+    item_strip.assign(stock.items.size(), -1);
+    for (size_t i = 0; i < stock.items.size(); i++) {
+        const ItemRect& item = stock.items[i];
+        auto it = std::upper_bound(strip_order.begin(), strip_order.end(), item.y,
+                                   [&stock](int y, int s) { return y < stock.strips[s].y; });
+        if (it == strip_order.begin()) continue;
+        const StripRect& strip = stock.strips[*(it - 1)];
+        if (item.y < strip.y + strip.width) item_strip[i] = *(it - 1);
+    }
+}
@@ -0,0 +1,203 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// cutting_data.h - 切割方案数据结构
+// (不依赖界面, 可在后台线程读取与渲染)
+
+#ifndef CUTTING_DATA_H_
+#define CUTTING_DATA_H_
+
+#include <QString>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class QJsonArray;
+class QJsonObject;
+
+// 条带绘制信息
+struct StripRect {
+    int strip_id;    // 条带ID (从0开始)
+    int y;           // Y起始位置
+    int width;       // 条带宽度
+};
+
+// 子板绘制信息
+struct ItemRect {
+    int item_type;   // 子板类型 (从1开始)
+    int x, y;        // 左下角位置
+    int width;       // 宽度
+    int length;      // 长度
+    int strip_id;    // 所属条带ID
+};
+
+// 连续数组中的一段 (指针 + 长度, 不拥有数据); 用法与 std::vector 的只读接口相同
+template <typename T>
+class ArraySpan {
+public:
+    ArraySpan() = default;
+    ArraySpan(T* data, size_t size) : data_(data), size_(size) {}
+
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+    T& operator[](size_t i) { return data_[i]; }
+    const T& operator[](size_t i) const { return data_[i]; }
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// 扁平存储: 一个解文件全部母板的条带与子板各占一个连续数组 (加载时按总数一次分配)
+struct SolutionArena {
+    std::vector<StripRect> strips;
+    std::vector<ItemRect> items;
+};
+
+// 两阶段切割线几何 (模型坐标, 加载时计算一次, 绘制与导出共用)
+struct CutGeometry {
+    // 第一阶段: 水平切割线, 贯穿母板全长, 按 y 升序
+    std::vector<int> stage1_y;
+
+    // 第二阶段: 垂直切割线, 位于条带内 [y0, y1], 按 (条带 y, x) 排序
+    std::vector<int> stage2_x;
+    std::vector<int> stage2_y0;
+    std::vector<int> stage2_y1;
+    std::vector<unsigned char> stage2_trim;   // 端点与红线相接: bit0 下端, bit1 上端
+    std::vector<int> stage2_run_start;        // 每个条带的切割线区段起点 (条带数 + 1)
+
+    long long stage1_length = 0;    // 第一阶段切割总长
+    long long stage2_length = 0;    // 第二阶段切割总长
+
+    int Stage1Count() const { return static_cast<int>(stage1_y.size()); }
+    int Stage2Count() const { return static_cast<int>(stage2_x.size()); }
+};
+
+constexpr unsigned char kCutTrimBottom = 1;
+constexpr unsigned char kCutTrimTop = 2;
+
+// 子板均匀网格索引 (视口裁剪与缩小时的聚合绘制)
+// 网格边长按每格约 kItemsPerGridCell 个子板选取; 子板登记到其覆盖的所有格子 (CSR 存储)
+struct ItemGridIndex {
+    int cell_size = 0;                      // 格子边长 (模型单位)
+    int cols = 0;                           // X 方向格数
+    int rows = 0;                           // Y 方向格数
+    std::vector<int> cell_start;            // cols * rows + 1
+    std::vector<int> cell_items;            // 子板下标
+
+    // 每格聚合信息: 子板覆盖率与占面积最大的子板类型
+    std::vector<float> cell_coverage;
+    std::vector<int> cell_dominant_type;
+
+    bool empty() const { return cols == 0 || rows == 0; }
+};
+
+constexpr int kItemsPerGridCell = 4;
+
+// 母板数据 (相同切割方式的母板只保存一份, multiplicity 为重复次数)
+// 条带与子板是 arena 中的区段, 复制 StockData 只复制区段与存储引用; 加载完成后只读
+struct StockData {
+    int stock_id;
+    double utilization;
+    ArraySpan<StripRect> strips;
+    ArraySpan<ItemRect> items;
+    CutGeometry cuts;
+    ItemGridIndex index;
+    int multiplicity = 1;
+    std::vector<int> stock_ids;         // 使用该切割方式的全部母板ID
+    std::shared_ptr<SolutionArena> arena;   // 条带与子板的存储 (多块母板共享)
+};
+
+// 子板类型需求 (解文件 item_types)
+struct ItemTypeSpec {
+    int type_id = 0;        // 子板类型 (从1开始)
+    int width = 0;
+    int length = 0;
+    int demand = -1;        // 需求量 (-1 表示文件中未给出)
+};
+
+// 完整切割方案 (解文件中的母板尺寸与去重后的切割方式)
+struct CuttingSolution {
+    int stock_width = 0;
+    int stock_length = 0;
+    int item_type_count = 0;
+    std::vector<ItemTypeSpec> item_types;
+    int physical_stock_count = 0;       // 去重前的母板数
+    std::vector<StockData> stocks;      // 互不相同的切割方式, 按首次出现顺序
+};
+
+// 读取 JSON 解文件并预计算切割线几何与网格索引 (不依赖界面, 可在命令行中调用)
+bool LoadCuttingSolution(const QString& json_path, CuttingSolution* solution, QString* error);
+
+// 由已解析的 JSON 根对象构建切割方案 (LoadCuttingSolution 与逐批加载共用)
+bool ParseCuttingSolution(const QJsonObject& root, CuttingSolution* solution);
+
+// 读取 JSON 母板数组, 条带与子板存入一块新分配的连续存储 (不去重, 不计算几何与索引)
+std::vector<StockData> ParseStocks(const QJsonArray& stocks_array);
+
+// 合并相同的切割方式: 条带与子板排序为规范顺序后计算哈希, 哈希相同再逐项比较
+// (条带与子板ID不参与比较); 保留首次出现的母板, 累加 multiplicity 与 stock_ids
+void DeduplicatePatterns(std::vector<StockData>& stocks);
+
+// 逐个登记切割方式的去重表 (DeduplicatePatterns 与逐批加载共用)
+// 表中只保存条带与子板区段, 调用方保证其存储在表的生命周期内有效
+class PatternTable {
+public:
+    void Reserve(size_t count);
+    int size() const { return static_cast<int>(patterns_.size()); }
+
+    // 将 stock 排序为规范顺序并查找相同的切割方式: 找到时返回其序号,
+    // 否则登记为第 size() 个切割方式并返回 -1
+    int Insert(StockData& stock);
+
+    // 登记已是规范顺序且互不相同的切割方式 (如上一次加载的结果), 不查找重复
+    void Add(const StockData& stock);
+
+    // 查找已是规范顺序的切割方式 (不修改 stock), 未找到返回 -1
+    int Find(const StockData& stock) const;
+
+    // 切割方式搬到新的存储后 (如 PackStocks) 更新登记的区段
+    void Rebind(int index, const StockData& stock);
+
+private:
+    struct Pattern {
+        ArraySpan<StripRect> strips;
+        ArraySpan<ItemRect> items;
+    };
+    std::vector<Pattern> patterns_;
+    std::unordered_multimap<unsigned long long, int> by_hash_;
+};
+
+// 将母板的条带与子板复制到一块新的连续存储 (去重后释放被丢弃母板占用的空间)
+void PackStocks(std::vector<StockData>& stocks);
+
+// 根据条带与子板计算切割线几何 (写入 stock.cuts)
+void BuildCutGeometry(StockData& stock, int stock_width, int stock_length);
+
+// 构建子板网格索引 (写入 stock.index)
+void BuildItemIndex(StockData& stock, int stock_width, int stock_length);
+
+// 查询与模型矩形 [x0, x1) x [y0, y1) 相交的子板下标 (每个子板只返回一次)
+void QueryItems(const StockData& stock, int x0, int y0, int x1, int y1,
+                std::vector<int>& result);
+
+// 第二阶段切割线中与 [x0, x1] x [y0, y1] 相交的下标, 按条带分段返回 [begin, end) 区间
+void QueryStage2Cuts(const CutGeometry& cuts, int x0, int y0, int x1, int y1,
+                     std::vector<std::pair<int, int>>& ranges);
+
+// 每个子板所在条带在 stock.strips 中的下标 (按子板的 y 归入条带, 兼容无 strip_id 的旧格式), -1 表示位于条带之外
+void AssignItemsToStrips(const StockData& stock, std::vector<int>& item_strip);
+
+#endif  // CUTTING_DATA_H_
@@ -9,27 +9,147 @@
 // cutting_view_widget.cpp - 切割方案可视化组件实现
 
 #include "cutting_view_widget.h"
+#include "stock_overview_widget.h"
+#include "book_plan_dialog.h"
+#include "waste_report_dialog.h"
+#include "solution_diff_dialog.h"
+#include "utilization_heatmap_widget.h"
+#include "tiled_export.h"
+#include "remnant_inventory.h"
+#include "machine_params_dialog.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QPushButton>
 #include <QLabel>
 #include <QComboBox>
+#include <QLineEdit>
 #include <QPainter>
-#include <QFile>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonArray>
+#include <QFontMetrics>
+#include <QLineF>
 #include <QFileInfo>
+#include <QFileDialog>
+#include <QInputDialog>
+#include <QMessageBox>
+#include <QProgressDialog>
+#include <QTimer>
+#include <QtConcurrent>
+#include <QWheelEvent>
+#include <QMouseEvent>
 #include <algorithm>
-#include <set>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+namespace {
+
+constexpr double kMaxPixelsPerUnit = 64.0;  // 最大放大: 每模型单位 64 像素
+constexpr double kWheelZoomBase = 1.0015;   // 每 1/8 度滚轮的缩放倍数
+constexpr double kReplayDuration = 20.0;    // 回放时长上限 (秒), 更长的周期按比例加速
+constexpr int kReplayFrameMs = 33;
+constexpr int kNavigationHeight = 40;       // 导航栏高度
+constexpr int kHeatmapHeight = 12;          // 利用率热力条高度
+
+}  // namespace
 
 CuttingViewWidget::CuttingViewWidget(QWidget* parent)
     : QWidget(parent)
     , current_stock_index_(0)
     , stock_width_(0)
-    , stock_length_(0) {
+    , stock_length_(0)
+    , physical_stock_count_(0)
+    , overview_dirty_(true)
+    , view_zoom_(1.0)
+    , view_center_(-1.0, -1.0)
+    , panning_(false)
+    , cache_stock_index_(-1)
+    , cache_dpr_(0.0) {
+    export_progress_ = nullptr;
+    export_watcher_ = new QFutureWatcher<StockExportResult>(this);
+    connect(export_watcher_, &QFutureWatcher<StockExportResult>::finished,
+            this, &CuttingViewWidget::OnExportAllFinished);
+
+    saw_generation_ = 0;
+    saw_pending_generation_ = -1;
+    book_plan_pending_ = false;
+    saw_watcher_ = new QFutureWatcher<std::vector<SawSequence>>(this);
+    connect(saw_watcher_, &QFutureWatcher<std::vector<SawSequence>>::finished,
+            this, &CuttingViewWidget::OnSawSequenceFinished);
+
+    machine_params_ = LoadMachineParameters();
+    replay_stock_index_ = -1;
+    replay_speed_ = 1.0;
+    replay_timer_ = new QTimer(this);
+    replay_timer_->setInterval(kReplayFrameMs);
+    connect(replay_timer_, &QTimer::timeout, this, &CuttingViewWidget::OnReplayTick);
+
+    type_search_slot_ = -1;
+    type_search_pos_ = -1;
+
+    remnant_generation_ = 0;
+    remnant_pending_generation_ = -1;
+    remnant_watcher_ = new QFutureWatcher<RemnantReport>(this);
+    connect(remnant_watcher_, &QFutureWatcher<RemnantReport>::finished,
+            this, &CuttingViewWidget::OnRemnantsFinished);
+
+    stack_generation_ = 0;
+    stack_pending_generation_ = -1;
+    stack_watcher_ = new QFutureWatcher<StackSequenceResult>(this);
+    connect(stack_watcher_, &QFutureWatcher<StackSequenceResult>::finished,
+            this, &CuttingViewWidget::OnStackOrderFinished);
+
+    load_total_ = -1;
+    load_watcher_ = new QFutureWatcher<std::shared_ptr<SolutionChunk>>(this);
+    connect(load_watcher_, &QFutureWatcher<std::shared_ptr<SolutionChunk>>::resultsReadyAt,
+            this, &CuttingViewWidget::OnLoadChunksReady);
+    connect(load_watcher_, &QFutureWatcher<std::shared_ptr<SolutionChunk>>::finished,
+            this, &CuttingViewWidget::OnLoadFinished);
+
+    fingerprint_ = std::make_shared<SolutionFingerprint>();
+    reload_generation_ = 0;
+    reload_pending_generation_ = -1;
+    reload_again_ = false;
+    removed_stock_count_ = 0;
+    reload_watcher_ = new QFutureWatcher<std::shared_ptr<SolutionReload>>(this);
+    connect(reload_watcher_, &QFutureWatcher<std::shared_ptr<SolutionReload>>::finished,
+            this, &CuttingViewWidget::OnReloadFinished);
+
     SetupUi();
+
+    // 翻页时从头回放新的切割方式
+    connect(this, &CuttingViewWidget::StockChanged, this, [this]() {
+        if (replay_button_->isChecked()) StartReplay();
+    });
+}
+
+CuttingViewWidget::~CuttingViewWidget() {
+    // 后台导出持有方案快照, 这里只需取消并等待其删除未完成的文件
+    if (export_watcher_->isRunning()) {
+        export_watcher_->disconnect(this);
+        export_watcher_->cancel();
+        export_watcher_->waitForFinished();
+    }
+    if (saw_watcher_->isRunning()) {
+        saw_watcher_->disconnect(this);
+        saw_watcher_->waitForFinished();
+    }
+    if (stack_watcher_->isRunning()) {
+        stack_watcher_->disconnect(this);
+        stack_watcher_->waitForFinished();
+    }
+    if (remnant_watcher_->isRunning()) {
+        remnant_watcher_->disconnect(this);
+        remnant_watcher_->waitForFinished();
+    }
+    if (load_watcher_->isRunning()) {
+        load_watcher_->disconnect(this);
+        load_watcher_->cancel();
+        load_watcher_->waitForFinished();
+    }
+    if (reload_watcher_->isRunning()) {
+        reload_watcher_->disconnect(this);
+        reload_watcher_->waitForFinished();
+    }
 }
 
 void CuttingViewWidget::SetupUi() {
@@ -54,13 +174,141 @@ void CuttingViewWidget::SetupUi() {
     next_button_->setEnabled(false);
     connect(next_button_, &QPushButton::clicked, this, &CuttingViewWidget::ShowNextStock);
 
+    overview_button_ = new QPushButton(QString::fromUtf8("总览"), this);
+    overview_button_->setCheckable(true);
+    overview_button_->setFixedWidth(60);
+    overview_button_->setEnabled(false);
+    overview_button_->setToolTip(QString::fromUtf8("以缩略图显示全部母板, 点击缩略图打开"));
+    connect(overview_button_, &QPushButton::toggled, this, &CuttingViewWidget::OnOverviewToggled);
+
+    export_all_button_ = new QPushButton(QString::fromUtf8("导出全部..."), this);
+    export_all_button_->setEnabled(false);
+    export_all_button_->setToolTip(QString::fromUtf8("导出全部母板为 PNG (每块一个文件) / PDF (多页) / SVG / DXF / 切割程序"));
+    connect(export_all_button_, &QPushButton::clicked, this, &CuttingViewWidget::ExportAllStocks);
+
+    export_print_button_ = new QPushButton(QString::fromUtf8("大幅面..."), this);
+    export_print_button_->setEnabled(false);
+    export_print_button_->setToolTip(QString::fromUtf8("按打印分辨率分块导出当前母板 (分块 TIFF 或 PNG 分块 + 索引), 内存占用与分辨率无关"));
+    connect(export_print_button_, &QPushButton::clicked, this, &CuttingViewWidget::ExportLargePrint);
+
+    // 校验徽章: 点击跳到下一个含违规子板的切割方式
+    validation_badge_ = new QPushButton(this);
+    validation_badge_->setFlat(true);
+    validation_badge_->setVisible(false);
+    connect(validation_badge_, &QPushButton::clicked, this, &CuttingViewWidget::OnValidationBadgeClicked);
+
+    // 重新加载后的变化标记: 点击跳到下一个新内容的切割方式
+    changes_badge_ = new QPushButton(this);
+    changes_badge_->setFlat(true);
+    changes_badge_->setVisible(false);
+    changes_badge_->setStyleSheet("QPushButton { color: #e67800; font-weight: bold; }");
+    connect(changes_badge_, &QPushButton::clicked, this, &CuttingViewWidget::OnChangesBadgeClicked);
+
+    saw_sequence_button_ = new QPushButton(QString::fromUtf8("切割顺序"), this);
+    saw_sequence_button_->setCheckable(true);
+    saw_sequence_button_->setEnabled(false);
+    saw_sequence_button_->setToolTip(QString::fromUtf8("优化锯切顺序, 标注每道切割的序号与方向并估计周期时间"));
+    connect(saw_sequence_button_, &QPushButton::toggled, this, &CuttingViewWidget::OnSawSequenceToggled);
+
+    replay_button_ = new QPushButton(QString::fromUtf8("回放"), this);
+    replay_button_->setCheckable(true);
+    replay_button_->setEnabled(false);
+    replay_button_->setToolTip(QString::fromUtf8("按估计的机器时间动画回放当前切割方式的锯切过程"));
+    connect(replay_button_, &QPushButton::toggled, this, &CuttingViewWidget::OnReplayToggled);
+
+    book_plan_button_ = new QPushButton(QString::fromUtf8("叠切计划..."), this);
+    book_plan_button_->setEnabled(false);
+    book_plan_button_->setToolTip(QString::fromUtf8("将相同切割方式的母板按最大叠放张数分叠, 估计切割道数与时间"));
+    connect(book_plan_button_, &QPushButton::clicked, this, &CuttingViewWidget::ShowBookPlan);
+
+    waste_report_button_ = new QPushButton(QString::fromUtf8("利用率分布..."), this);
+    waste_report_button_->setEnabled(false);
+    waste_report_button_->setToolTip(QString::fromUtf8("全部母板的利用率分布、浪费面积与利用率最低的切割方式"));
+    connect(waste_report_button_, &QPushButton::clicked, this, &CuttingViewWidget::ShowWasteReport);
+
+    diff_button_ = new QPushButton(QString::fromUtf8("对比..."), this);
+    diff_button_->setEnabled(false);
+    diff_button_->setToolTip(QString::fromUtf8("与同一算例的另一个解文件对比: 匹配切割方式并并排显示差异"));
+    connect(diff_button_, &QPushButton::clicked, this, &CuttingViewWidget::ShowSolutionDiff);
+
+    // 利用率热力条: 位于导航栏与绘图区之间, 加载方案后显示
+    heatmap_widget_ = new UtilizationHeatmapWidget(this);
+    heatmap_widget_->hide();
+    connect(heatmap_widget_, &UtilizationHeatmapWidget::StockClicked, this, [this](int index) {
+        overview_button_->setChecked(false);
+        ShowStock(index);
+    });
+
+    remnant_button_ = new QPushButton(QString::fromUtf8("余料"), this);
+    remnant_button_->setCheckable(true);
+    remnant_button_->setEnabled(false);
+    remnant_button_->setToolTip(QString::fromUtf8("标出可复用的余料 (切割后的空白区域中不小于母板宽度与长度 10% 的矩形)"));
+    connect(remnant_button_, &QPushButton::toggled, this, &CuttingViewWidget::OnRemnantsToggled);
+
+    stack_order_button_ = new QPushButton(QString::fromUtf8("堆栈排序"), this);
+    stack_order_button_->setCheckable(true);
+    stack_order_button_->setEnabled(false);
+    stack_order_button_->setToolTip(QString::fromUtf8("按最少开放堆栈重排切割方式 (每种子板从首次产出到最后一次产出占用一个堆栈)"));
+    connect(stack_order_button_, &QPushButton::toggled, this, &CuttingViewWidget::OnStackOrderToggled);
+
+    // 子板类型搜索: 回车或 ">" 跳到下一处摆放位置
+    type_search_edit_ = new QLineEdit(this);
+    type_search_edit_->setFixedWidth(80);
+    type_search_edit_->setPlaceholderText(QString::fromUtf8("子板类型"));
+    type_search_edit_->setClearButtonEnabled(true);
+    type_search_edit_->setEnabled(false);
+    type_search_edit_->setToolTip(QString::fromUtf8("输入子板类型 (如 17 或 T17), 标出全部摆放位置"));
+    connect(type_search_edit_, &QLineEdit::textChanged, this, &CuttingViewWidget::OnTypeSearchChanged);
+    connect(type_search_edit_, &QLineEdit::returnPressed, this, &CuttingViewWidget::ShowNextPlacement);
+
+    type_prev_button_ = new QPushButton("<", this);
+    type_prev_button_->setFixedWidth(28);
+    type_prev_button_->setEnabled(false);
+    connect(type_prev_button_, &QPushButton::clicked, this, &CuttingViewWidget::ShowPrevPlacement);
+
+    type_next_button_ = new QPushButton(">", this);
+    type_next_button_->setFixedWidth(28);
+    type_next_button_->setEnabled(false);
+    connect(type_next_button_, &QPushButton::clicked, this, &CuttingViewWidget::ShowNextPlacement);
+
+    type_search_label_ = new QLabel(this);
+
+    // 加载进度 (仅在加载过程中显示)
+    load_label_ = new QLabel(this);
+    load_label_->hide();
+
     utilization_label_ = new QLabel(QString::fromUtf8("利用率: --"), this);
     utilization_label_->setAlignment(Qt::AlignRight);
 
+    // 总览覆盖在绘图区域上, 仅在总览模式下显示
+    overview_widget_ = new StockOverviewWidget(this);
+    overview_widget_->hide();
+    connect(overview_widget_, &StockOverviewWidget::StockClicked,
+            this, &CuttingViewWidget::OnOverviewStockClicked);
+    connect(overview_widget_, &StockOverviewWidget::RenderProgress,
+            this, &CuttingViewWidget::OnOverviewProgress);
+
     nav_layout->addWidget(prev_button_);
     nav_layout->addWidget(stock_combo_);
     nav_layout->addWidget(next_button_);
+    nav_layout->addWidget(load_label_);
+    nav_layout->addWidget(overview_button_);
+    nav_layout->addWidget(export_all_button_);
+    nav_layout->addWidget(export_print_button_);
+    nav_layout->addWidget(saw_sequence_button_);
+    nav_layout->addWidget(replay_button_);
+    nav_layout->addWidget(book_plan_button_);
+    nav_layout->addWidget(waste_report_button_);
+    nav_layout->addWidget(diff_button_);
+    nav_layout->addWidget(remnant_button_);
+    nav_layout->addWidget(stack_order_button_);
     nav_layout->addStretch();
+    nav_layout->addWidget(type_search_edit_);
+    nav_layout->addWidget(type_prev_button_);
+    nav_layout->addWidget(type_next_button_);
+    nav_layout->addWidget(type_search_label_);
+    nav_layout->addWidget(validation_badge_);
+    nav_layout->addWidget(changes_badge_);
     nav_layout->addWidget(utilization_label_);
 
     main_layout->addLayout(nav_layout);
@@ -70,84 +318,332 @@ void CuttingViewWidget::SetupUi() {
 }
 
 bool CuttingViewWidget::LoadSolution(const QString& json_path) {
-    QFile file(json_path);
-    if (!file.open(QIODevice::ReadOnly)) {
+    QFileInfo info(json_path);
+    if (!info.isFile() || !info.isReadable()) {
         return false;
     }
 
-    QByteArray data = file.readAll();
-    QJsonDocument doc = QJsonDocument::fromJson(data);
-    if (doc.isNull()) {
-        return false;
+    // 同一解文件被改写 (求解器输出新的解): 只重新解析与渲染变化的部分
+    if (!IsLoading() && !stocks_.empty() &&
+        info.absoluteFilePath() == QFileInfo(solution_path_).absoluteFilePath()) {
+        ReloadSolution();
+        return true;
     }
 
-    QJsonObject root = doc.object();
+    // 丢弃当前方案 (正在进行的加载随之取消); 各开关保持原状态, 加载完成后重新计算
+    if (load_watcher_->isRunning()) load_watcher_->cancel();
+    DiscardSolution();
+    solution_path_ = json_path;
+    load_total_ = -1;
+    load_error_.clear();
+    load_clock_.start();
+
+    load_watcher_->setFuture(QtConcurrent::run(
+        [json_path](QPromise<std::shared_ptr<SolutionChunk>>& promise) {
+            LoadCuttingSolutionChunked(json_path, [&promise](SolutionChunk&& chunk) {
+                promise.addResult(std::make_shared<SolutionChunk>(std::move(chunk)));
+                return !promise.isCanceled();
+            });
+        }));
+    UpdateLoadLabel();
+    UpdateNavigation();
+    update();
+    return true;
+}
 
-    // 读取母板尺寸
-    QJsonObject stock = root["stock"].toObject();
-    stock_width_ = stock["width"].toInt();
-    stock_length_ = stock["length"].toInt();
+void CuttingViewWidget::OnLoadChunksReady(int begin, int end) {
+    if (load_watcher_->isCanceled()) return;
 
-    // 读取子板类型 (用于颜色映射)
-    QJsonArray item_types = root["item_types"].toArray();
-    color_map_.clear();
-    for (int i = 0; i < item_types.size(); i++) {
-        color_map_[i + 1] = GetItemColor(i + 1);
+    const bool first = stocks_.empty();
+    for (int i = begin; i < end; i++) {
+        std::shared_ptr<SolutionChunk> chunk = load_watcher_->resultAt(i);
+        if (!chunk->error.isEmpty()) {
+            load_error_ = chunk->error;     // 在 OnLoadFinished 中报告
+            continue;
+        }
+        ApplyLoadChunk(*chunk);
     }
+    if (!load_error_.isEmpty()) return;
 
-    // 读取所有母板
-    stocks_.clear();
-    QJsonArray stocks_array = root["stocks"].toArray();
-    for (const auto& stock_val : stocks_array) {
-        QJsonObject stock_obj = stock_val.toObject();
+    UpdateLoadLabel();
+    UpdateNavigation();
+    if (first && !stocks_.empty()) {
+        // 第一批到达即显示第一个切割方式
+        ResetView();
+        update();
+    }
+}
 
-        StockData stock;
-        stock.stock_id = stock_obj["stock_id"].toInt();
-        stock.utilization = stock_obj["utilization"].toDouble();
+void CuttingViewWidget::ApplyLoadChunk(SolutionChunk& chunk) {
+    if (chunk.has_header) {
+        stock_width_ = chunk.stock_width;
+        stock_length_ = chunk.stock_length;
+        item_types_ = std::move(chunk.item_types);
 
-        // 读取条带信息
-        QJsonArray strips_array = stock_obj["strips"].toArray();
-        for (const auto& strip_val : strips_array) {
-            QJsonObject strip_obj = strip_val.toObject();
+        // 子板类型颜色映射
+        color_map_.clear();
+        for (int i = 0; i < static_cast<int>(item_types_.size()); i++) {
+            color_map_[i + 1] = GetItemTypeColor(i + 1);
+        }
+    }
 
-            StripRect strip;
-            strip.strip_id = strip_obj["strip_id"].toInt();
-            strip.y = strip_obj["y"].toInt();
-            strip.width = strip_obj["width"].toInt();
+    // 已到达的切割方式又出现相同的母板: 重复次数变化, 同步下拉框中的文字
+    for (const auto& [index, stock_id] : chunk.repeats) {
+        StockData& stock = stocks_[index];
+        stock.multiplicity++;
+        stock.stock_ids.push_back(stock_id);
+        if (index < stock_combo_->count()) stock_combo_->setItemText(index, StockComboText(index));
+    }
 
-            stock.strips.push_back(strip);
-        }
+    stocks_.insert(stocks_.end(), std::make_move_iterator(chunk.stocks.begin()),
+                   std::make_move_iterator(chunk.stocks.end()));
+    physical_stock_count_ = chunk.loaded;
+    load_total_ = chunk.total;
+    for (const auto& [hash, fingerprint] : chunk.fingerprints) (*fingerprint_)[hash] = fingerprint;
+}
 
-        // 读取子板信息
-        QJsonArray items_array = stock_obj["items"].toArray();
-        for (const auto& item_val : items_array) {
-            QJsonObject item_obj = item_val.toObject();
+void CuttingViewWidget::OnLoadFinished() {
+    if (load_watcher_->isCanceled()) return;
+    load_label_->hide();
+    if (!load_error_.isEmpty()) {
+        QString error = load_error_;
+        Clear();
+        emit SolutionLoaded(false, error);
+        return;
+    }
 
-            ItemRect item;
-            item.item_type = item_obj["item_type"].toInt();
-            item.x = item_obj["x"].toInt();
-            item.y = item_obj["y"].toInt();
-            item.width = item_obj["width"].toInt();
-            item.length = item_obj["length"].toInt();
-            item.strip_id = item_obj["strip_id"].toInt(-1);  // 兼容旧格式
+    RebuildSolutionState();
+    emit SolutionLoaded(true, QString::fromUtf8("方案已加载: %1 块母板, %2 种切割方式 (%3 ms)")
+        .arg(physical_stock_count_)
+        .arg(stocks_.size())
+        .arg(load_clock_.elapsed()));
+}
 
-            stock.items.push_back(item);
-        }
+void CuttingViewWidget::RebuildSolutionState() {
+    // 每个加载的解都先校验 (按切割方式进行, O(n log n)); 借用 stocks_ 与 item_types_ 避免复制,
+    // 类型、尺寸与需求检查依赖 item_types, 与命令行 --validate 的结果一致
+    CuttingSolution solution;
+    solution.stock_width = stock_width_;
+    solution.stock_length = stock_length_;
+    solution.item_type_count = static_cast<int>(item_types_.size());
+    solution.physical_stock_count = physical_stock_count_;
+    solution.stocks = std::move(stocks_);
+    solution.item_types = std::move(item_types_);
+    validation_ = ValidateSolution(solution);
+    stocks_ = std::move(solution.stocks);
+    item_types_ = std::move(solution.item_types);
+
+    CollectFlaggedItems();
+    type_index_ = BuildItemTypeIndex(stocks_);
+    type_search_pos_ = -1;
+    RefreshWasteStatistics();
+    heatmap_widget_->show();
+    UpdateChildGeometry();
+    stock_order_.resize(stocks_.size());
+    std::iota(stock_order_.begin(), stock_order_.end(), 0);
+
+    // 总数确定后重建下拉框 ("方案 i/N")
+    stock_combo_->blockSignals(true);
+    stock_combo_->clear();
+    stock_combo_->blockSignals(false);
 
-        stocks_.push_back(stock);
+    if (saw_sequence_button_->isChecked() || book_plan_pending_) {
+        StartSawSequencing();
+    }
+    if (remnant_button_->isChecked() || !remnant_store_path_.isEmpty()) {
+        StartRemnantExtraction();
+    }
+    if (stack_order_button_->isChecked()) {
+        StartStackOrdering();
     }
-
-    current_stock_index_ = 0;
     UpdateNavigation();
+    OnTypeSearchChanged();
     update();
-    return true;
 }
 
-void CuttingViewWidget::Clear() {
+void CuttingViewWidget::ReloadSolution() {
+    // 上一次重新加载仍在运行时等其结束, 在 OnReloadFinished 中再次开始
+    if (reload_watcher_->isRunning()) {
+        reload_again_ = true;
+        return;
+    }
+    if (IsLoading() || stocks_.empty()) return;
+
+    // 当前方案按解文件中的顺序作为比较基准 (拷贝到工作线程)
+    auto previous = std::make_shared<CuttingSolution>();
+    previous->stock_width = stock_width_;
+    previous->stock_length = stock_length_;
+    previous->physical_stock_count = physical_stock_count_;
+    previous->stocks.resize(stocks_.size());
+    for (size_t k = 0; k < stocks_.size(); k++) previous->stocks[stock_order_[k]] = stocks_[k];
+
+    reload_pending_generation_ = reload_generation_;
+    load_clock_.start();
+    load_label_->setText(QString::fromUtf8("正在重新加载..."));
+    load_label_->show();
+    QString path = solution_path_;
+    std::shared_ptr<const SolutionFingerprint> fingerprint = fingerprint_;
+    reload_watcher_->setFuture(QtConcurrent::run([path, previous, fingerprint]() {
+        return std::make_shared<SolutionReload>(ReloadCuttingSolution(path, *previous, *fingerprint));
+    }));
+}
+
+void CuttingViewWidget::OnReloadFinished() {
+    // 计算期间加载了其他方案或已清空时丢弃结果
+    if (reload_pending_generation_ == reload_generation_) {
+        load_label_->hide();
+        std::shared_ptr<SolutionReload> reload = reload_watcher_->result();
+        if (!reload->error.isEmpty()) {
+            // 保留当前方案 (文件可能仍在写入, 之后的请求会再次尝试)
+            emit SolutionLoaded(false, reload->error);
+        } else {
+            ApplyReload(*reload);
+        }
+    }
+    if (reload_again_) {
+        reload_again_ = false;
+        ReloadSolution();
+    }
+}
+
+void CuttingViewWidget::ApplyReload(SolutionReload& reload) {
+    CuttingSolution& solution = reload.solution;
+    const int total = static_cast<int>(solution.stocks.size());
+
+    // 旧切割方式 (解文件中的顺序) -> 当前显示位置; from[i] 为新切割方式 i 在当前显示中的位置
+    std::vector<int> position(stock_order_.size());
+    for (size_t k = 0; k < stock_order_.size(); k++) position[stock_order_[k]] = static_cast<int>(k);
+    std::vector<int> from(total, -1);
+    changed_stocks_.assign(total, 0);
+    int current = -1;
+    for (int i = 0; i < total; i++) {
+        if (reload.previous[i] < 0) {
+            changed_stocks_[i] = 1;
+            continue;
+        }
+        from[i] = position[reload.previous[i]];
+        if (from[i] == current_stock_index_) current = i;
+    }
+    removed_stock_count_ = reload.removed;
+
+    // 当前切割方式内容未变时继续显示 (沿用渲染缓存与视图), 否则停在相同序号
+    if (current >= 0) {
+        cache_stock_index_ = cache_stock_index_ == current_stock_index_ ? current : -1;
+        current_stock_index_ = current;
+    } else {
+        current_stock_index_ = std::min(current_stock_index_, std::max(0, total - 1));
+        ResetView();
+    }
+
+    stocks_ = std::move(solution.stocks);
+    stock_width_ = solution.stock_width;
+    stock_length_ = solution.stock_length;
+    physical_stock_count_ = solution.physical_stock_count;
+    item_types_ = std::move(solution.item_types);
+    color_map_.clear();
+    for (int i = 0; i < static_cast<int>(item_types_.size()); i++) {
+        color_map_[i + 1] = GetItemTypeColor(i + 1);
+    }
+    fingerprint_ = std::make_shared<SolutionFingerprint>(std::move(reload.fingerprint));
+
+    // 锯切顺序、余料与堆栈排序依赖全部切割方式, 按新方案重新计算
+    saw_generation_++;
+    saw_sequences_.clear();
+    replay_timer_->stop();
+    replay_stock_index_ = -1;
+    remnant_generation_++;
+    remnant_report_ = RemnantReport();
+    stack_generation_++;
+    stack_result_ = StackSequenceResult();
+
+    // 已渲染的总览只渲染新内容的缩略图
+    if (!overview_dirty_) {
+        overview_widget_->SetStocks(std::make_shared<const std::vector<StockData>>(stocks_),
+                                    stock_width_, stock_length_, from);
+        overview_widget_->SetChangedFlags(changed_stocks_);
+    }
+
+    RebuildSolutionState();
+    UpdateChangesBadge();
+    emit StockChanged(current_stock_index_, total);
+    emit SolutionLoaded(true, QString::fromUtf8(
+        "方案已重新加载: %1 种切割方式中 %2 种为新内容, 移除 %3 种; 重新解析 %4 / %5 块母板 (%6 ms)")
+        .arg(total)
+        .arg(reload.changed)
+        .arg(reload.removed)
+        .arg(reload.reparsed)
+        .arg(physical_stock_count_)
+        .arg(load_clock_.elapsed()));
+}
+
+void CuttingViewWidget::UpdateLoadLabel() {
+    if (!IsLoading()) {
+        load_label_->hide();
+        return;
+    }
+    load_label_->setText(load_total_ >= 0
+        ? QString::fromUtf8("已加载 %1 / %2").arg(physical_stock_count_).arg(load_total_)
+        : QString::fromUtf8("已加载 %1 / ...").arg(physical_stock_count_));
+    load_label_->show();
+}
+
+void CuttingViewWidget::DiscardSolution() {
     stocks_.clear();
     current_stock_index_ = 0;
     stock_width_ = 0;
     stock_length_ = 0;
+    physical_stock_count_ = 0;
+    item_types_.clear();
+    color_map_.clear();
+    solution_path_.clear();
+    validation_ = ValidationReport();
+    flagged_items_.clear();
+    UpdateValidationBadge();
+    type_index_ = ItemTypeIndex();
+    type_search_pos_ = -1;
+    waste_stats_.reset();
+    heatmap_widget_->Clear();
+    heatmap_widget_->hide();
+    UpdateChildGeometry();
+    saw_generation_++;
+    saw_sequences_.clear();
+    replay_timer_->stop();
+    replay_stock_index_ = -1;
+    book_plan_pending_ = false;
+    book_plan_button_->setText(QString::fromUtf8("叠切计划..."));
+    remnant_generation_++;
+    remnant_report_ = RemnantReport();
+    if (!remnant_store_path_.isEmpty()) {
+        remnant_store_path_.clear();
+        emit RemnantsStored(false, QString::fromUtf8("切割方案已关闭, 余料未入库"));
+    }
+    stack_generation_++;
+    stack_result_ = StackSequenceResult();
+    stock_order_.clear();
+    reload_generation_++;
+    reload_again_ = false;
+    fingerprint_ = std::make_shared<SolutionFingerprint>();
+    changed_stocks_.clear();
+    removed_stock_count_ = 0;
+    UpdateChangesBadge();
+    ResetView();
+    overview_dirty_ = true;
+    overview_widget_->Clear();
+    overview_button_->setChecked(false);
+    stock_combo_->blockSignals(true);
+    stock_combo_->clear();
+    stock_combo_->blockSignals(false);
+}
+
+void CuttingViewWidget::Clear() {
+    if (load_watcher_->isRunning()) load_watcher_->cancel();
+    load_label_->hide();
+    DiscardSolution();
+    type_search_edit_->clear();
+    OnTypeSearchChanged();
+    saw_sequence_button_->setChecked(false);
+    remnant_button_->setChecked(false);
+    stack_order_button_->setChecked(false);
     UpdateNavigation();
     update();
 }
@@ -155,6 +651,7 @@ void CuttingViewWidget::Clear() {
 void CuttingViewWidget::ShowPrevStock() {
     if (current_stock_index_ > 0) {
         current_stock_index_--;
+        ResetView();
         UpdateNavigation();
         update();
         emit StockChanged(current_stock_index_, static_cast<int>(stocks_.size()));
@@ -164,6 +661,7 @@ void CuttingViewWidget::ShowPrevStock() {
 void CuttingViewWidget::ShowNextStock() {
     if (current_stock_index_ < static_cast<int>(stocks_.size()) - 1) {
         current_stock_index_++;
+        ResetView();
         UpdateNavigation();
         update();
         emit StockChanged(current_stock_index_, static_cast<int>(stocks_.size()));
@@ -173,31 +671,59 @@ void CuttingViewWidget::ShowNextStock() {
 void CuttingViewWidget::ShowStock(int index) {
     if (index >= 0 && index < static_cast<int>(stocks_.size())) {
         current_stock_index_ = index;
+        ResetView();
         UpdateNavigation();
         update();
         emit StockChanged(current_stock_index_, static_cast<int>(stocks_.size()));
     }
 }
 
+QString CuttingViewWidget::StockComboText(int index) const {
+    // 加载过程中总数未定, 只显示序号
+    QString text = IsLoading()
+        ? QString::fromUtf8("方案 %1").arg(index + 1)
+        : QString::fromUtf8("方案 %1/%2").arg(index + 1).arg(stocks_.size());
+    if (stocks_[index].multiplicity > 1) {
+        text += QString::fromUtf8("  ×%1").arg(stocks_[index].multiplicity);
+    }
+    if (index < static_cast<int>(changed_stocks_.size()) && changed_stocks_[index]) {
+        text += QString::fromUtf8("  [新]");
+    }
+    return text;
+}
+
 void CuttingViewWidget::UpdateNavigation() {
     int total = static_cast<int>(stocks_.size());
+    // 加载过程中只能浏览已到达的切割方式, 依赖全部切割方式的功能在加载完成后启用
+    bool complete = total > 0 && !IsLoading();
 
     prev_button_->setEnabled(current_stock_index_ > 0);
     next_button_->setEnabled(current_stock_index_ < total - 1);
 
-    // 更新下拉框 (阻止信号循环)
+    // 更新下拉框 (阻止信号循环); 逐批加载时只追加新到达的切割方式
     stock_combo_->blockSignals(true);
-    if (stock_combo_->count() != total) {
+    if (stock_combo_->count() > total) {
         stock_combo_->clear();
-        for (int i = 0; i < total; i++) {
-            stock_combo_->addItem(QString::fromUtf8("母板 %1/%2").arg(i + 1).arg(total));
-        }
     }
+    for (int i = stock_combo_->count(); i < total; i++) {
+        stock_combo_->addItem(StockComboText(i));
+    }
+    overview_button_->setEnabled(complete);
+    export_all_button_->setEnabled(complete && !export_watcher_->isRunning());
+    export_print_button_->setEnabled(total > 0 && !export_watcher_->isRunning());
+    saw_sequence_button_->setEnabled(complete);
+    replay_button_->setEnabled(complete);
+    book_plan_button_->setEnabled(complete);
+    waste_report_button_->setEnabled(complete);
+    diff_button_->setEnabled(complete);
+    heatmap_widget_->SetCurrentIndex(total > 0 ? current_stock_index_ : -1);
+    stack_order_button_->setEnabled(complete);
+    remnant_button_->setEnabled(complete);
+    type_search_edit_->setEnabled(complete);
     if (total > 0) {
         stock_combo_->setCurrentIndex(current_stock_index_);
         stock_combo_->setEnabled(true);
-        utilization_label_->setText(QString::fromUtf8("利用率: %1%")
-            .arg(stocks_[current_stock_index_].utilization * 100, 0, 'f', 1));
+        UpdateStockInfoLabel();
     } else {
         stock_combo_->setEnabled(false);
         utilization_label_->setText(QString::fromUtf8("利用率: --"));
@@ -208,210 +734,1280 @@ void CuttingViewWidget::UpdateNavigation() {
 void CuttingViewWidget::OnStockComboChanged(int index) {
     if (index >= 0 && index < static_cast<int>(stocks_.size())) {
         current_stock_index_ = index;
+        ResetView();
         prev_button_->setEnabled(current_stock_index_ > 0);
         next_button_->setEnabled(current_stock_index_ < static_cast<int>(stocks_.size()) - 1);
-        utilization_label_->setText(QString::fromUtf8("利用率: %1%")
-            .arg(stocks_[current_stock_index_].utilization * 100, 0, 'f', 1));
+        UpdateStockInfoLabel();
         update();
         emit StockChanged(current_stock_index_, static_cast<int>(stocks_.size()));
     }
 }
 
-QColor CuttingViewWidget::GetItemColor(int item_type) {
-    // 使用预定义的调色板
-    static const QColor palette[] = {
-        QColor(255, 179, 186),  // 粉红
-        QColor(255, 223, 186),  // 橙色
-        QColor(255, 255, 186),  // 黄色
-        QColor(186, 255, 201),  // 浅绿
-        QColor(186, 225, 255),  // 浅蓝
-        QColor(218, 186, 255),  // 紫色
-        QColor(255, 186, 255),  // 粉紫
-        QColor(186, 255, 255),  // 青色
-        QColor(255, 200, 200),  // 浅红
-        QColor(200, 255, 200),  // 浅绿2
-        QColor(200, 200, 255),  // 浅蓝2
-        QColor(255, 230, 200),  // 浅橙
-    };
-    int idx = (item_type - 1) % 12;
-    return palette[idx];
+void CuttingViewWidget::OnOverviewToggled(bool checked) {
+    if (checked) {
+        // 首次进入或数据变化后才重新渲染缩略图
+        if (overview_dirty_) {
+            overview_widget_->SetStocks(
+                std::make_shared<const std::vector<StockData>>(stocks_),
+                stock_width_, stock_length_);
+            overview_widget_->SetChangedFlags(changed_stocks_);
+            overview_dirty_ = false;
+        }
+        overview_widget_->setGeometry(GetDrawRect());
+        overview_widget_->show();
+        overview_widget_->EnsureVisible(current_stock_index_);
+    } else {
+        overview_widget_->hide();
+        if (!stocks_.empty()) UpdateStockInfoLabel();
+    }
+    update();
 }
 
-void CuttingViewWidget::paintEvent(QPaintEvent* event) {
-    Q_UNUSED(event);
+void CuttingViewWidget::OnOverviewStockClicked(int index) {
+    overview_button_->setChecked(false);
+    ShowStock(index);
+}
 
-    QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
+void CuttingViewWidget::OnOverviewProgress(int done, int total, qint64 elapsed_ms) {
+    if (!overview_button_->isChecked()) return;
+    utilization_label_->setText(QString::fromUtf8("总览: 已渲染 %1 / %2 (%3 ms)")
+        .arg(done).arg(total).arg(elapsed_ms));
+}
+
+void CuttingViewWidget::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    UpdateChildGeometry();
+}
+
+void CuttingViewWidget::UpdateChildGeometry() {
+    heatmap_widget_->setGeometry(10, kNavigationHeight + 4, width() - 20, kHeatmapHeight);
+    overview_widget_->setGeometry(GetDrawRect());
+}
+
+void CuttingViewWidget::UpdateStockInfoLabel() {
+    const StockData& stock = stocks_[current_stock_index_];
+    bool changed = current_stock_index_ < static_cast<int>(changed_stocks_.size()) &&
+                   changed_stocks_[current_stock_index_];
+    utilization_label_->setText((changed ? QString::fromUtf8("[新] ") : QString()) +
+        QString::fromUtf8("×%1 | 利用率: %2% | 子板: %3 | 切割线: 一阶段 %4, 二阶段 %5")
+        .arg(stock.multiplicity)
+        .arg(stock.utilization * 100, 0, 'f', 1)
+        .arg(stock.items.size())
+        .arg(stock.cuts.Stage1Count())
+        .arg(stock.cuts.Stage2Count()) +
+        (view_zoom_ > 1.0 ? QString::fromUtf8(" | 缩放 %1%").arg(qRound(view_zoom_ * 100)) : QString()));
+
+    bool has_sequence = saw_sequence_button_->isChecked() &&
+                        current_stock_index_ < static_cast<int>(saw_sequences_.size());
+    if (has_sequence) {
+        const SawSequence& sequence = saw_sequences_[current_stock_index_];
+        utilization_label_->setText(utilization_label_->text() +
+            QString::fromUtf8(" | 周期 %1 (原顺序 %2)")
+                .arg(FormatSawTime(sequence.total_time), FormatSawTime(sequence.baseline_time)));
+    }
+
+    long long total_stage1 = 0;
+    long long total_stage2 = 0;
+    for (const auto& s : stocks_) {
+        total_stage1 += static_cast<long long>(s.cuts.Stage1Count()) * s.multiplicity;
+        total_stage2 += static_cast<long long>(s.cuts.Stage2Count()) * s.multiplicity;
+    }
+
+    // 使用该切割方式的母板ID (过多时截断)
+    constexpr int kMaxListedIds = 20;
+    QStringList ids;
+    for (int i = 0; i < static_cast<int>(stock.stock_ids.size()) && i < kMaxListedIds; i++) {
+        ids << QString::number(stock.stock_ids[i]);
+    }
+    if (static_cast<int>(stock.stock_ids.size()) > kMaxListedIds) ids << "...";
+
+    utilization_label_->setToolTip(QString::fromUtf8(
+        "当前方案切割总长: 一阶段 %1, 二阶段 %2\n全部母板切割线: 一阶段 %3 条, 二阶段 %4 条\n"
+        "%5 种切割方式 / %6 块母板; 当前方案母板ID: %7")
+        .arg(stock.cuts.stage1_length)
+        .arg(stock.cuts.stage2_length)
+        .arg(total_stage1)
+        .arg(total_stage2)
+        .arg(stocks_.size())
+        .arg(physical_stock_count_)
+        .arg(ids.join(", ")) +
+        (has_sequence ? QString::fromUtf8("\n当前方案: %1 道切割, 进给 %2 s, 空行程 %3 s, 落锯/旋转 %4 s")
+                            .arg(saw_sequences_[current_stock_index_].passes.size())
+                            .arg(saw_sequences_[current_stock_index_].cut_time, 0, 'f', 1)
+                            .arg(saw_sequences_[current_stock_index_].travel_time, 0, 'f', 1)
+                            .arg(saw_sequences_[current_stock_index_].overhead_time, 0, 'f', 1)
+                      : QString()));
+}
+
+void CuttingViewWidget::CollectFlaggedItems() {
+    // 按切割方式收集违规子板 (供高亮)
+    flagged_items_.assign(stocks_.size(), std::vector<int>());
+    for (const Violation& v : validation_.violations) {
+        if (v.stock_index < 0 || v.stock_index >= static_cast<int>(stocks_.size())) continue;
+        int count = static_cast<int>(stocks_[v.stock_index].items.size());
+        auto& flagged = flagged_items_[v.stock_index];
+        if (v.item_index >= 0 && v.item_index < count) flagged.push_back(v.item_index);
+        if (v.kind != ViolationKind::kStripInvalid && v.kind != ViolationKind::kStripMismatch &&
+            v.other_index >= 0 && v.other_index < count) {
+            flagged.push_back(v.other_index);
+        }
+    }
+    for (auto& flagged : flagged_items_) {
+        std::sort(flagged.begin(), flagged.end());
+        flagged.erase(std::unique(flagged.begin(), flagged.end()), flagged.end());
+    }
+    UpdateValidationBadge();
+}
+
+void CuttingViewWidget::UpdateValidationBadge() {
+    if (stocks_.empty()) {
+        validation_badge_->setVisible(false);
+        return;
+    }
+
+    QString color;
+    if (validation_.error_count > 0) {
+        validation_badge_->setText(QString::fromUtf8("✗ 校验: %1 错误").arg(validation_.error_count) +
+            (validation_.warning_count > 0 ?
+             QString::fromUtf8(", %1 警告").arg(validation_.warning_count) : QString()));
+        color = "#c62828";
+    } else if (validation_.warning_count > 0) {
+        validation_badge_->setText(QString::fromUtf8("! 校验: %1 警告").arg(validation_.warning_count));
+        color = "#ef6c00";
+    } else {
+        validation_badge_->setText(QString::fromUtf8("✓ 校验通过"));
+        color = "#2e7d32";
+    }
+    validation_badge_->setStyleSheet(QString("QPushButton { color: %1; font-weight: bold; }").arg(color));
+
+    // 悬停提示列出前若干条违规
+    constexpr int kMaxTooltipLines = 15;
+    QStringList lines;
+    lines << QString::fromUtf8("%1 个子板, 校验用时 %2 ms")
+                 .arg(validation_.item_count)
+                 .arg(validation_.elapsed_us / 1000.0, 0, 'f', 1);
+    int shown = 0;
+    for (const Violation& v : validation_.violations) {
+        if (shown++ >= kMaxTooltipLines) {
+            lines << QString::fromUtf8("... (共 %1 条)")
+                         .arg(validation_.error_count + validation_.warning_count);
+            break;
+        }
+        lines << (v.error ? QString::fromUtf8("[错误] ") : QString::fromUtf8("[警告] ")) +
+                 DescribeViolation(v, stocks_);
+    }
+    validation_badge_->setToolTip(lines.join("\n"));
+    validation_badge_->setVisible(true);
+}
+
+void CuttingViewWidget::OnValidationBadgeClicked() {
+    int total = static_cast<int>(flagged_items_.size());
+    for (int k = 1; k <= total; k++) {
+        int index = (current_stock_index_ + k) % total;
+        if (!flagged_items_[index].empty()) {
+            overview_button_->setChecked(false);
+            ShowStock(index);
+            return;
+        }
+    }
+}
+
+void CuttingViewWidget::UpdateChangesBadge() {
+    if (changed_stocks_.empty() || stocks_.empty()) {
+        changes_badge_->setVisible(false);
+        return;
+    }
+    int changed = static_cast<int>(std::count(changed_stocks_.begin(), changed_stocks_.end(), 1));
+    QString text = changed > 0 ? QString::fromUtf8("△ 变化: %1 种新切割方式").arg(changed)
+                               : QString::fromUtf8("△ 变化: 无新切割方式");
+    if (removed_stock_count_ > 0) text += QString::fromUtf8(", 移除 %1 种").arg(removed_stock_count_);
+    changes_badge_->setText(text);
+    changes_badge_->setToolTip(QString::fromUtf8(
+        "与重新加载前相比: %1 / %2 种切割方式为新内容 (下拉框与总览中标为 [新]), %3 种不再使用\n"
+        "点击跳到下一个新内容的切割方式")
+        .arg(changed)
+        .arg(stocks_.size())
+        .arg(removed_stock_count_));
+    changes_badge_->setVisible(true);
+}
 
+void CuttingViewWidget::OnChangesBadgeClicked() {
+    int total = static_cast<int>(changed_stocks_.size());
+    for (int k = 1; k <= total; k++) {
+        int index = (current_stock_index_ + k) % total;
+        if (changed_stocks_[index]) {
+            overview_button_->setChecked(false);
+            ShowStock(index);
+            return;
+        }
+    }
+}
+
+void CuttingViewWidget::InvalidateCache() {
+    stock_cache_ = QImage();
+    cache_stock_index_ = -1;
+}
+
+void CuttingViewWidget::ResetView() {
+    view_zoom_ = 1.0;
+    view_center_ = QPointF(-1.0, -1.0);
+    panning_ = false;
+    unsetCursor();
+    InvalidateCache();
+}
+
+StockRenderOptions CuttingViewWidget::GetViewOptions() const {
+    StockRenderOptions options;
+    options.zoom = view_zoom_;
+    options.center_x = view_center_.x();
+    options.center_y = view_center_.y();
+    return options;
+}
+
+StockTransform CuttingViewWidget::GetViewTransform() const {
+    return ComputeStockTransform(stock_width_, stock_length_,
+                                 QRect(QPoint(0, 0), GetDrawRect().size()), GetViewOptions());
+}
+
+void CuttingViewWidget::ClampViewCenter() {
+    view_center_.setX(std::clamp(view_center_.x(), 0.0, static_cast<double>(stock_length_)));
+    view_center_.setY(std::clamp(view_center_.y(), 0.0, static_cast<double>(stock_width_)));
+}
+
+QRect CuttingViewWidget::GetDrawRect() const {
     // 绘图区域 (排除导航栏)
     QRect draw_rect = rect();
-    draw_rect.setTop(40);  // 留出导航栏空间
+    // 留出导航栏 (与热力条) 空间
+    draw_rect.setTop(kNavigationHeight + (heatmap_widget_->isHidden() ? 0 : kHeatmapHeight + 8));
     draw_rect.adjust(10, 10, -10, -10);  // 边距
+    return draw_rect;
+}
 
-    // 绘制背景
-    painter.fillRect(draw_rect, QColor(250, 250, 250));
-    painter.setPen(QPen(Qt::gray, 1));
-    painter.drawRect(draw_rect);
+void CuttingViewWidget::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+
+    // 总览模式下绘图区被缩略图网格覆盖
+    if (overview_button_->isChecked()) return;
+
+    QPainter painter(this);
+    QRect draw_rect = GetDrawRect();
+    if (draw_rect.width() <= 0 || draw_rect.height() <= 0) return;
 
     if (stocks_.empty() || stock_width_ <= 0 || stock_length_ <= 0) {
         // 无数据时显示提示
-        painter.setPen(Qt::gray);
+        painter.fillRect(draw_rect, QColor(250, 250, 250));
+        painter.setPen(QPen(Qt::gray, 1));
+        painter.drawRect(draw_rect);
         painter.drawText(draw_rect, Qt::AlignCenter,
-            QString::fromUtf8("暂无切割方案"));
+            IsLoading() ? QString::fromUtf8("正在加载切割方案...") : QString::fromUtf8("暂无切割方案"));
         return;
     }
 
-    // 绘制当前母板
-    DrawStock(painter, stocks_[current_stock_index_], draw_rect);
-}
-
-void CuttingViewWidget::DrawStock(QPainter& painter, const StockData& stock, const QRect& rect) {
-    // 计算缩放比例 (保持宽高比)
-    double scale_x = static_cast<double>(rect.width()) / stock_length_;
-    double scale_y = static_cast<double>(rect.height()) / stock_width_;
-    double scale = std::min(scale_x, scale_y) * 0.95;  // 留 5% 边距
-
-    int offset_x = rect.x() + (rect.width() - static_cast<int>(stock_length_ * scale)) / 2;
-    int offset_y = rect.y() + (rect.height() - static_cast<int>(stock_width_ * scale)) / 2;
-
-    // 绘制母板背景
-    QRect stock_rect(offset_x, offset_y,
-                     static_cast<int>(stock_length_ * scale),
-                     static_cast<int>(stock_width_ * scale));
-    painter.fillRect(stock_rect, QColor(220, 220, 220));
-    painter.setPen(QPen(Qt::black, 2));
-    painter.drawRect(stock_rect);
-
-    // 绘制每个子板
-    for (const auto& item : stock.items) {
-        int draw_x = offset_x + static_cast<int>(item.x * scale);
-        // Y 坐标翻转 (屏幕 Y 轴向下，切割 Y 轴向上)
-        int draw_y = offset_y + static_cast<int>((stock_width_ - item.y - item.width) * scale);
-        int draw_w = static_cast<int>(item.length * scale);
-        int draw_h = static_cast<int>(item.width * scale);
-
-        QRect item_rect(draw_x, draw_y, draw_w, draw_h);
-
-        // 填充颜色
-        QColor color = GetItemColor(item.item_type);
-        painter.fillRect(item_rect, color);
-
-        // 边框
-        painter.setPen(QPen(Qt::black, 1));
-        painter.drawRect(item_rect);
-
-        // 子板类型标签 (仅当足够大时显示)
-        if (draw_w > 30 && draw_h > 20) {
-            painter.setPen(Qt::black);
-            QFont font = painter.font();
-            font.setPointSize(8);
-            painter.setFont(font);
-            QString label = QString("T%1").arg(item.item_type);
-            painter.drawText(item_rect, Qt::AlignCenter, label);
-        }
+    // 仅在母板、尺寸或设备像素比变化时重新渲染, 否则直接贴图
+    qreal dpr = devicePixelRatioF();
+    if (stock_cache_.isNull() || cache_stock_index_ != current_stock_index_ ||
+        cache_size_ != draw_rect.size() || cache_dpr_ != dpr) {
+        stock_cache_ = RenderStockImage(stocks_[current_stock_index_], stock_width_, stock_length_,
+                                        draw_rect.size(), dpr, QColor(250, 250, 250),
+                                        GetViewOptions());
+        cache_stock_index_ = current_stock_index_;
+        cache_size_ = draw_rect.size();
+        cache_dpr_ = dpr;
     }
 
-    // ===== 绘制两阶段切割轨迹 =====
-    // 关闭抗锯齿以获得锐利的像素级线条
-    painter.setRenderHint(QPainter::Antialiasing, false);
+    painter.drawImage(draw_rect.topLeft(), stock_cache_);
+    DrawViolationHighlights(painter, draw_rect);
+    DrawRemnants(painter, draw_rect);
+    DrawTypeHighlights(painter, draw_rect);
+    if (replay_stock_index_ == current_stock_index_) {
+        DrawReplay(painter, draw_rect);
+    } else {
+        DrawSawSequence(painter, draw_rect);
+    }
+    painter.setPen(QPen(Qt::gray, 1));
+    painter.drawRect(draw_rect);
+}
 
-    constexpr int kLineWidth = 3;
-    constexpr int kLineHalfWidth = (kLineWidth + 1) / 2;  // = 2
+void CuttingViewWidget::DrawViolationHighlights(QPainter& painter, const QRect& draw_rect) {
+    if (current_stock_index_ >= static_cast<int>(flagged_items_.size())) return;
+    const std::vector<int>& flagged = flagged_items_[current_stock_index_];
+    if (flagged.empty()) return;
 
-    // 收集红线Y位置 (用于蓝线避让)
-    std::set<int> red_line_model_y;
+    // 高亮叠加在缓存图像之上, 不进入缓存
+    StockTransform t = GetViewTransform();
+    const StockData& stock = stocks_[current_stock_index_];
 
-    // 第一阶段切割线 (水平红线，分隔条带)
-    if (!stock.strips.empty()) {
-        QPen red_pen(QColor(200, 50, 50), kLineWidth, Qt::SolidLine);
-        red_pen.setCapStyle(Qt::FlatCap);
-        painter.setPen(red_pen);
+    painter.save();
+    painter.setClipRect(draw_rect);
+    painter.translate(draw_rect.topLeft());
+    painter.setPen(QPen(QColor(220, 0, 0), 2, Qt::DashLine));
+    painter.setBrush(QColor(255, 0, 0, 70));
+
+    QRect visible(QPoint(0, 0), draw_rect.size());
+    for (int i : flagged) {
+        const ItemRect& item = stock.items[i];
+        QPointF top_left = t.ToScreen(item.x, static_cast<double>(item.y) + item.width);
+        QRectF rect(top_left, QSizeF(std::max(3.0, item.length * t.scale),
+                                     std::max(3.0, item.width * t.scale)));
+        if (rect.intersects(visible)) painter.drawRect(rect);
+    }
+    painter.restore();
+}
 
-        for (const auto& strip : stock.strips) {
-            int strip_top = strip.y + strip.width;
-            if (strip_top < stock_width_) {
-                red_line_model_y.insert(strip_top);
-                int draw_y = offset_y + static_cast<int>((stock_width_ - strip_top) * scale);
-                painter.drawLine(stock_rect.left(), draw_y, stock_rect.right(), draw_y);
-            }
-        }
+void CuttingViewWidget::OnSawSequenceToggled(bool checked) {
+    if (!checked) replay_button_->setChecked(false);
+    if (checked && saw_sequences_.empty() && !stocks_.empty()) {
+        StartSawSequencing();
     }
+    if (!stocks_.empty()) UpdateStockInfoLabel();
+    update();
+}
+
+void CuttingViewWidget::StartSawSequencing() {
+    // 上一次计算仍在运行时等其结束, 在 OnSawSequenceFinished 中按 generation 重新开始
+    if (saw_watcher_->isRunning() || stocks_.empty() || IsLoading()) return;
+
+    saw_pending_generation_ = saw_generation_;
+    saw_sequence_button_->setText(QString::fromUtf8("切割顺序 (计算中)"));
+    auto solution = GetSolutionSnapshot();
+    SawMachineModel model = machine_params_.saw;
+    saw_watcher_->setFuture(QtConcurrent::run([solution, model]() {
+        return OptimizeSawSequences(*solution, model);
+    }));
+}
+
+void CuttingViewWidget::SetMachineParameters(const MachineParameters& params) {
+    machine_params_ = params;
+    // 锯切顺序按机器模型优化并记录各项时间, 参数变化后重新计算 (计算中的结果丢弃)
+    saw_generation_++;
+    saw_sequences_.clear();
+    replay_timer_->stop();
+    replay_stock_index_ = -1;
+    if (saw_sequence_button_->isChecked() || book_plan_pending_) StartSawSequencing();
+    if (!stocks_.empty()) UpdateStockInfoLabel();
+    update();
+}
+
+void CuttingViewWidget::OnSawSequenceFinished() {
+    saw_sequence_button_->setText(QString::fromUtf8("切割顺序"));
+    if (saw_pending_generation_ != saw_generation_) {
+        // 计算期间重新加载过方案
+        if (saw_sequence_button_->isChecked() || book_plan_pending_) StartSawSequencing();
+        return;
+    }
+    saw_sequences_ = saw_watcher_->result();
+
+    // 按母板数 (重复次数) 累计全部母板的锯切时间
+    double total = 0;
+    double baseline = 0;
+    for (size_t i = 0; i < saw_sequences_.size() && i < stocks_.size(); i++) {
+        total += saw_sequences_[i].total_time * stocks_[i].multiplicity;
+        baseline += saw_sequences_[i].baseline_time * stocks_[i].multiplicity;
+    }
+    // 含上下料的机器时间与锯路损耗
+    MachineTimeReport machine = SimulateMachineTime(BuildMachineWorkload(stocks_, saw_sequences_),
+                                                    machine_params_);
+    double sheet_area = static_cast<double>(stock_width_) * stock_length_ * machine.sheet_count;
+    saw_sequence_button_->setToolTip(QString::fromUtf8(
+        "优化锯切顺序, 标注每道切割的序号与方向并估计周期时间\n"
+        "全部母板: %1 (原顺序 %2, 节省 %3%)\n"
+        "含上下料: %4 (%5 机器小时), 锯路损耗约 %6% 母板面积")
+        .arg(FormatSawTime(total), FormatSawTime(baseline))
+        .arg(baseline > 0 ? (baseline - total) / baseline * 100 : 0.0, 0, 'f', 1)
+        .arg(FormatSawTime(machine.total_time))
+        .arg(machine.Hours(), 0, 'f', 2)
+        .arg(sheet_area > 0 ? machine.kerf_area / sheet_area * 100 : 0.0, 0, 'f', 2));
+
+    if (replay_button_->isChecked()) StartReplay();
+    if (!stocks_.empty()) UpdateStockInfoLabel();
+    update();
+    if (book_plan_pending_ && saw_sequences_.size() == stocks_.size()) ShowBookPlan();
+}
+
+void CuttingViewWidget::OnReplayToggled(bool checked) {
+    if (!checked) {
+        replay_timer_->stop();
+        replay_stock_index_ = -1;
+        update();
+        return;
+    }
+    // 回放依赖锯切顺序, 未计算时先计算, 完成后在 OnSawSequenceFinished 中开始
+    if (!saw_sequence_button_->isChecked()) saw_sequence_button_->setChecked(true);
+    if (saw_sequences_.size() == stocks_.size()) StartReplay();
+}
 
-    // 第二阶段切割线 (垂直蓝线，分隔同一条带内的子板)
-    QPen blue_pen(QColor(50, 100, 180), kLineWidth, Qt::SolidLine);
-    blue_pen.setCapStyle(Qt::FlatCap);
-    painter.setPen(blue_pen);
+void CuttingViewWidget::StartReplay() {
+    replay_timer_->stop();
+    replay_stock_index_ = -1;
+    if (current_stock_index_ < static_cast<int>(saw_sequences_.size())) {
+        replay_timeline_ = BuildMachineTimeline(saw_sequences_[current_stock_index_], machine_params_);
+        replay_stock_index_ = current_stock_index_;
+        replay_speed_ = std::max(1.0, replay_timeline_.total / kReplayDuration);
+        replay_clock_.start();
+        replay_timer_->start();
+    }
+    update();
+}
+
+double CuttingViewWidget::ReplayTime() const {
+    return std::min(replay_timeline_.total, replay_clock_.elapsed() / 1000.0 * replay_speed_);
+}
 
-    // 按条带分组收集子板右边界
-    std::map<int, std::vector<int>> strip_item_boundaries;
-    for (const auto& item : stock.items) {
-        int right_x = item.x + item.length;
-        if (right_x < stock_length_) {
-            strip_item_boundaries[item.strip_id].push_back(right_x);
+void CuttingViewWidget::OnReplayTick() {
+    // 播放结束后停在最后一帧
+    if (ReplayTime() >= replay_timeline_.total) replay_timer_->stop();
+    update(GetDrawRect());
+}
+
+void CuttingViewWidget::DrawReplay(QPainter& painter, const QRect& draw_rect) {
+    if (current_stock_index_ >= static_cast<int>(saw_sequences_.size())) return;
+    const SawSequence& sequence = saw_sequences_[current_stock_index_];
+    const std::vector<MachineStep>& steps = replay_timeline_.steps;
+    if (sequence.passes.size() != steps.size()) return;
+
+    const double now = ReplayTime();
+    StockTransform t = GetViewTransform();
+    auto pass_start = [&t](const SawPass& pass) {
+        return pass.stage == 1 ? t.ToScreen(pass.from, pass.coord) : t.ToScreen(pass.coord, pass.from);
+    };
+    auto pass_end = [&t](const SawPass& pass) {
+        return pass.stage == 1 ? t.ToScreen(pass.to, pass.coord) : t.ToScreen(pass.coord, pass.to);
+    };
+
+    painter.save();
+    painter.setClipRect(draw_rect);
+    painter.translate(draw_rect.topLeft());
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // 已完成的道 (结束时刻有序, 二分查找)
+    const int done = static_cast<int>(std::partition_point(steps.begin(), steps.end(),
+        [now](const MachineStep& step) { return step.end <= now; }) - steps.begin());
+    QVector<QLineF> stage1_lines;
+    QVector<QLineF> stage2_lines;
+    for (int k = 0; k < done; k++) {
+        const SawPass& pass = sequence.passes[k];
+        (pass.stage == 1 ? stage1_lines : stage2_lines).append(QLineF(pass_start(pass), pass_end(pass)));
+    }
+    painter.setPen(QPen(QColor(200, 50, 50), 3));
+    painter.drawLines(stage1_lines);
+    painter.setPen(QPen(QColor(50, 100, 180), 3));
+    painter.drawLines(stage2_lines);
+
+    // 当前阶段与锯头位置
+    QString phase;
+    QPointF blade = t.ToScreen(0, 0);
+    bool show_blade = true;
+    const QColor blade_color(255, 140, 0);
+    if (now < replay_timeline_.load_end) {
+        phase = QString::fromUtf8("上料");
+        show_blade = false;
+    } else if (done >= static_cast<int>(steps.size())) {
+        phase = QString::fromUtf8(now < replay_timeline_.total ? "下料" : "完成");
+        if (!steps.empty()) blade = pass_end(sequence.passes.back());
+    } else {
+        const MachineStep& step = steps[done];
+        const SawPass& pass = sequence.passes[done];
+        QPointF a = pass_start(pass);
+        QPointF b = pass_end(pass);
+        if (now < step.start) {
+            phase = QString::fromUtf8("旋转");
+        } else if (now < step.travel_end) {
+            phase = QString::fromUtf8("空行程");
+            QPointF from = step.stage_start || done == 0 ? t.ToScreen(0, 0) : pass_end(sequence.passes[done - 1]);
+            double f = (now - step.start) / (step.travel_end - step.start);
+            blade = from + (a - from) * f;
+        } else if (now < step.cut_start) {
+            phase = QString::fromUtf8("落锯");
+            blade = a;
+        } else {
+            phase = QString::fromUtf8("进给");
+            double f = (now - step.cut_start) / std::max(1e-9, step.end - step.cut_start);
+            blade = a + (b - a) * f;
+            painter.setPen(QPen(blade_color, 3));
+            painter.drawLine(a, blade);
         }
     }
+    if (show_blade) {
+        painter.setPen(QPen(QColor(60, 60, 60), 1));
+        painter.setBrush(blade_color);
+        painter.drawEllipse(blade, 5, 5);
+    }
+
+    // 左上角信息框
+    QString text = QString::fromUtf8("%1 / %2 | 第 %3/%4 道 | %5 | %6 倍速")
+        .arg(FormatSawTime(now), FormatSawTime(replay_timeline_.total))
+        .arg(std::min(done + 1, static_cast<int>(steps.size())))
+        .arg(steps.size())
+        .arg(phase)
+        .arg(replay_speed_, 0, 'f', replay_speed_ < 10 ? 1 : 0);
+    QFont font = painter.font();
+    font.setPointSize(9);
+    painter.setFont(font);
+    QFontMetrics metrics(font);
+    QRectF box(8, 8, metrics.horizontalAdvance(text) + 16, metrics.height() + 8);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(255, 255, 255, 220));
+    painter.drawRoundedRect(box, 4, 4);
+    painter.setPen(QColor(40, 40, 40));
+    painter.drawText(box, Qt::AlignCenter, text);
+    painter.restore();
+}
+
+void CuttingViewWidget::OnRemnantsToggled(bool checked) {
+    if (checked && remnant_report_.stocks.size() != stocks_.size() && !stocks_.empty()) {
+        StartRemnantExtraction();
+    }
+    update();
+}
+
+void CuttingViewWidget::StartRemnantExtraction() {
+    // 上一次计算仍在运行时等其结束, 在 OnRemnantsFinished 中按 generation 重新开始
+    if (remnant_watcher_->isRunning() || stocks_.empty() || IsLoading()) return;
+
+    remnant_pending_generation_ = remnant_generation_;
+    remnant_button_->setText(QString::fromUtf8("余料 (计算中)"));
+    auto solution = GetSolutionSnapshot();
+    RemnantOptions options = DefaultRemnantOptions(stock_width_, stock_length_);
+    remnant_watcher_->setFuture(QtConcurrent::run([solution, options]() {
+        return ExtractRemnants(*solution, options);
+    }));
+}
+
+void CuttingViewWidget::OnRemnantsFinished() {
+    remnant_button_->setText(QString::fromUtf8("余料"));
+    if (remnant_pending_generation_ != remnant_generation_) {
+        // 计算期间重新加载过方案或改变过顺序
+        if (remnant_button_->isChecked() || !remnant_store_path_.isEmpty()) StartRemnantExtraction();
+        return;
+    }
+    remnant_report_ = remnant_watcher_->result();
+
+    double sheet_area = static_cast<double>(stock_width_) * stock_length_ * physical_stock_count_;
+    remnant_button_->setToolTip(QString::fromUtf8(
+        "标出可复用的余料 (切割后的空白区域中不小于母板宽度与长度 10% 的矩形)\n"
+        "全部母板: %1 块余料, 占母板面积 %2%, 提取用时 %3 ms")
+        .arg(remnant_report_.remnant_count)
+        .arg(sheet_area > 0 ? remnant_report_.remnant_area / sheet_area * 100 : 0.0, 0, 'f', 1)
+        .arg(remnant_report_.elapsed_ms));
+    update();
+    if (!remnant_store_path_.isEmpty()) FinishStoreRemnants();
+}
 
-    // 对每个条带绘制垂直切割线
-    for (const auto& strip : stock.strips) {
-        auto it = strip_item_boundaries.find(strip.strip_id);
-        if (it == strip_item_boundaries.end()) continue;
+void CuttingViewWidget::StoreRemnants(const QString& inventory_path) {
+    if (stocks_.empty() || solution_path_.isEmpty()) {
+        emit RemnantsStored(false, QString::fromUtf8("未加载切割方案"));
+        return;
+    }
+    if (IsLoading()) {
+        emit RemnantsStored(false, QString::fromUtf8("切割方案正在加载"));
+        return;
+    }
 
-        // Y范围 (屏幕坐标)
-        int strip_top_y = offset_y + static_cast<int>((stock_width_ - strip.y - strip.width) * scale);
-        int strip_bottom_y = offset_y + static_cast<int>((stock_width_ - strip.y) * scale);
+    // 复用已提取的余料; 尚未提取时在后台提取, 完成后在 OnRemnantsFinished 中入库
+    bool waiting = !remnant_store_path_.isEmpty();
+    remnant_store_path_ = inventory_path;
+    if (remnant_report_.stocks.size() == stocks_.size()) {
+        FinishStoreRemnants();
+    } else if (!waiting) {
+        StartRemnantExtraction();
+    }
+}
 
-        // 像素级避让: 蓝线端点内缩，不与红线相交
-        bool has_red_at_top = red_line_model_y.count(strip.y + strip.width) > 0;
-        bool has_red_at_bottom = red_line_model_y.count(strip.y) > 0;
+void CuttingViewWidget::FinishStoreRemnants() {
+    QString inventory_path = remnant_store_path_;
+    remnant_store_path_.clear();
 
-        if (has_red_at_top) {
-            strip_top_y += kLineHalfWidth;
+    RemnantInventory inventory;
+    QString error;
+    if (!LoadRemnantInventory(inventory_path, &inventory, &error)) {
+        emit RemnantsStored(false, error);
+        return;
+    }
+    int added = AddRemnantsToInventory(inventory, remnant_report_, stocks_, solution_path_);
+    if (!SaveRemnantInventory(inventory, inventory_path, &error)) {
+        emit RemnantsStored(false, error);
+        return;
+    }
+    emit RemnantsStored(true, QString::fromUtf8("已入库 %1 块余料, 库存共 %2 块 (%3)")
+        .arg(added)
+        .arg(inventory.TotalQuantity())
+        .arg(inventory_path));
+}
+
+void CuttingViewWidget::DrawRemnants(QPainter& painter, const QRect& draw_rect) {
+    if (!remnant_button_->isChecked() ||
+        current_stock_index_ >= static_cast<int>(remnant_report_.stocks.size())) {
+        return;
+    }
+    StockTransform t = GetViewTransform();
+
+    painter.save();
+    painter.setClipRect(draw_rect);
+    painter.translate(draw_rect.topLeft());
+    QFont font = painter.font();
+    font.setPointSize(8);
+    painter.setFont(font);
+    QFontMetrics metrics(font);
+    const QColor color(30, 150, 70);
+
+    QRectF visible(QPointF(0, 0), QSizeF(draw_rect.size()));
+    for (const Remnant& r : remnant_report_.stocks[current_stock_index_]) {
+        QRectF rect = QRectF(t.ToScreen(r.x, r.y), t.ToScreen(r.x + r.length, r.y + r.width)).normalized();
+        if (!rect.intersects(visible)) continue;
+        painter.setPen(QPen(color, 2, Qt::DashLine));
+        painter.setBrush(QBrush(QColor(30, 150, 70, 90), Qt::BDiagPattern));
+        painter.drawRect(rect);
+
+        QString text = QString("%1x%2").arg(r.width).arg(r.length);
+        if (rect.width() > metrics.horizontalAdvance(text) + 8 && rect.height() > metrics.height() + 4) {
+            painter.setPen(color.darker(130));
+            painter.drawText(rect, Qt::AlignCenter, text);
         }
-        if (has_red_at_bottom) {
-            strip_bottom_y -= kLineHalfWidth;
+    }
+    painter.restore();
+}
+
+void CuttingViewWidget::OnTypeSearchChanged() {
+    // 接受 "17" 或 "T17"
+    QString text = type_search_edit_->text().trimmed();
+    if (text.startsWith('T', Qt::CaseInsensitive)) text = text.mid(1);
+    bool ok = false;
+    int type_id = text.toInt(&ok);
+    type_search_slot_ = ok ? type_index_.Find(type_id) : -1;
+    type_search_pos_ = -1;
+    UpdateTypeSearchLabel();
+    update();
+}
+
+void CuttingViewWidget::ShowNextPlacement() {
+    if (type_search_slot_ < 0) return;
+    int begin = type_index_.type_start[type_search_slot_];
+    int end = type_index_.type_start[type_search_slot_ + 1];
+    int pos;
+    if (type_search_pos_ >= 0 && type_index_.placements[type_search_pos_].stock_index == current_stock_index_) {
+        pos = type_search_pos_ + 1;
+    } else {
+        // 翻页后从当前切割方式开始
+        pos = type_index_.StockRange(type_search_slot_, current_stock_index_).first;
+    }
+    ShowPlacement(pos < end ? pos : begin);
+}
+
+void CuttingViewWidget::ShowPrevPlacement() {
+    if (type_search_slot_ < 0) return;
+    int begin = type_index_.type_start[type_search_slot_];
+    int end = type_index_.type_start[type_search_slot_ + 1];
+    int pos;
+    if (type_search_pos_ >= 0 && type_index_.placements[type_search_pos_].stock_index == current_stock_index_) {
+        pos = type_search_pos_ - 1;
+    } else {
+        pos = type_index_.StockRange(type_search_slot_, current_stock_index_).first - 1;
+    }
+    ShowPlacement(pos >= begin ? pos : end - 1);
+}
+
+void CuttingViewWidget::ShowPlacement(int pos) {
+    type_search_pos_ = pos;
+    const ItemPlacement& placement = type_index_.placements[pos];
+    if (placement.stock_index != current_stock_index_) {
+        overview_button_->setChecked(false);
+        ShowStock(placement.stock_index);
+    }
+    // 放大时把子板移到视图中心
+    if (view_zoom_ > 1.0) {
+        const ItemRect& item = stocks_[placement.stock_index].items[placement.item_index];
+        view_center_ = QPointF(item.x + item.length / 2.0, item.y + item.width / 2.0);
+        ClampViewCenter();
+        InvalidateCache();
+    }
+    UpdateTypeSearchLabel();
+    update();
+}
+
+void CuttingViewWidget::UpdateTypeSearchLabel() {
+    bool found = type_search_slot_ >= 0;
+    type_prev_button_->setEnabled(found);
+    type_next_button_->setEnabled(found);
+    if (!found) {
+        type_search_label_->setText(type_search_edit_->text().trimmed().isEmpty()
+                                        ? QString() : QString::fromUtf8("未找到"));
+        type_search_label_->setToolTip(QString());
+        return;
+    }
+
+    const int slot = type_search_slot_;
+    const int type_id = type_index_.type_ids[slot];
+    int count = type_index_.PlacementCount(slot);
+    if (type_search_pos_ >= 0) {
+        type_search_label_->setText(QString("%1 / %2")
+            .arg(type_search_pos_ - type_index_.type_start[slot] + 1).arg(count));
+    } else {
+        type_search_label_->setText(QString::fromUtf8("%1 处").arg(count));
+    }
+
+    // 需求分配: 产出与需求对比, 各切割方式的每张数量 × 张数
+    QStringList lines;
+    QString header = QString::fromUtf8("T%1").arg(type_id);
+    auto spec = std::find_if(item_types_.begin(), item_types_.end(),
+                             [type_id](const ItemTypeSpec& t) { return t.type_id == type_id; });
+    if (spec != item_types_.end()) {
+        header += QString(" (%1x%2)").arg(spec->width).arg(spec->length);
+    }
+    lines << header;
+    QString produced = QString::fromUtf8("产出 %1 个, 面积 %2")
+        .arg(type_index_.produced[slot]).arg(type_index_.area[slot], 0, 'f', 0);
+    if (spec != item_types_.end() && spec->demand >= 0) {
+        produced += QString::fromUtf8(", 需求 %1").arg(spec->demand);
+        long long surplus = type_index_.produced[slot] - spec->demand;
+        if (surplus > 0) produced += QString::fromUtf8(" (超产 %1)").arg(surplus);
+        if (surplus < 0) produced += QString::fromUtf8(" (欠产 %1)").arg(-surplus);
+    }
+    lines << produced;
+    lines << QString::fromUtf8("分布在 %1 种切割方式:").arg(type_index_.pattern_count[slot]);
+
+    constexpr int kMaxShareLines = 20;
+    std::vector<ItemTypeShare> shares = ItemTypeShares(type_index_, slot, stocks_);
+    for (size_t i = 0; i < shares.size() && i < static_cast<size_t>(kMaxShareLines); i++) {
+        const ItemTypeShare& share = shares[i];
+        lines << QString::fromUtf8("  方案 %1: 每张 %2 个 × %3 张 = %4")
+            .arg(share.stock_index + 1).arg(share.per_sheet).arg(share.multiplicity)
+            .arg(static_cast<long long>(share.per_sheet) * share.multiplicity);
+    }
+    if (shares.size() > static_cast<size_t>(kMaxShareLines)) {
+        lines << QString::fromUtf8("  ... 另有 %1 种").arg(shares.size() - kMaxShareLines);
+    }
+    type_search_label_->setToolTip(lines.join("\n"));
+}
+
+void CuttingViewWidget::DrawTypeHighlights(QPainter& painter, const QRect& draw_rect) {
+    if (type_search_slot_ < 0 || current_stock_index_ >= static_cast<int>(stocks_.size())) return;
+    auto [begin, end] = type_index_.StockRange(type_search_slot_, current_stock_index_);
+    if (begin == end) return;
+
+    StockTransform t = GetViewTransform();
+    const StockData& stock = stocks_[current_stock_index_];
+
+    painter.save();
+    painter.setClipRect(draw_rect);
+    painter.translate(draw_rect.topLeft());
+
+    QRect visible(QPoint(0, 0), draw_rect.size());
+    for (int p = begin; p < end; p++) {
+        const ItemRect& item = stock.items[type_index_.placements[p].item_index];
+        QPointF top_left = t.ToScreen(item.x, static_cast<double>(item.y) + item.width);
+        QRectF rect(top_left, QSizeF(std::max(3.0, item.length * t.scale),
+                                     std::max(3.0, item.width * t.scale)));
+        if (!rect.intersects(visible)) continue;
+        if (p == type_search_pos_) {
+            painter.setPen(QPen(QColor(255, 120, 0), 4));
+            painter.setBrush(QColor(255, 200, 0, 140));
+        } else {
+            painter.setPen(QPen(QColor(255, 140, 0), 2));
+            painter.setBrush(QColor(255, 220, 0, 80));
         }
+        painter.drawRect(rect);
+    }
+    painter.restore();
+}
+
+void CuttingViewWidget::OnStackOrderToggled(bool checked) {
+    if (stocks_.empty()) return;
+    if (!checked) {
+        // 恢复解文件中的顺序 (计算中的结果在 OnStackOrderFinished 中被忽略)
+        std::vector<int> restore(stock_order_.size());
+        for (size_t k = 0; k < stock_order_.size(); k++) restore[stock_order_[k]] = static_cast<int>(k);
+        ApplyStockOrder(restore);
+        return;
+    }
+    // 结果相对解文件中的顺序, 取消后再次选中可直接复用
+    if (!stack_result_.order.empty()) {
+        ApplyStockOrder(stack_result_.order);
+    } else {
+        StartStackOrdering();
+    }
+}
 
-        for (int x : it->second) {
-            int draw_x = offset_x + static_cast<int>(x * scale);
-            painter.drawLine(draw_x, strip_top_y, draw_x, strip_bottom_y);
+void CuttingViewWidget::StartStackOrdering() {
+    // 上一次计算仍在运行时等其结束, 在 OnStackOrderFinished 中按 generation 重新开始
+    if (stack_watcher_->isRunning() || stocks_.empty() || IsLoading()) return;
+
+    stack_pending_generation_ = stack_generation_;
+    stack_order_button_->setText(QString::fromUtf8("堆栈排序 (计算中)"));
+    auto solution = GetSolutionSnapshot();
+    stack_watcher_->setFuture(QtConcurrent::run([solution]() {
+        return SequenceForOpenStacks(solution->stocks);
+    }));
+}
+
+void CuttingViewWidget::OnStackOrderFinished() {
+    stack_order_button_->setText(QString::fromUtf8("堆栈排序"));
+    if (stack_pending_generation_ != stack_generation_) {
+        // 计算期间重新加载过方案或改变过顺序
+        if (stack_order_button_->isChecked()) StartStackOrdering();
+        return;
+    }
+    if (!stack_order_button_->isChecked()) return;
+    stack_result_ = stack_watcher_->result();
+
+    stack_order_button_->setToolTip(QString::fromUtf8(
+        "按最少开放堆栈重排切割方式 (每种子板从首次产出到最后一次产出占用一个堆栈)\n"
+        "最大开放堆栈: %1 (原顺序 %2)%3\n平均跨度: %4 个切割方式 (原顺序 %5), 用时 %6 ms")
+        .arg(stack_result_.max_open)
+        .arg(stack_result_.original_max_open)
+        .arg(stack_result_.proven_optimal ? QString::fromUtf8(", 已证明最优") : QString())
+        .arg(stack_result_.average_spread, 0, 'f', 1)
+        .arg(stack_result_.original_average_spread, 0, 'f', 1)
+        .arg(stack_result_.elapsed_ms));
+    ApplyStockOrder(stack_result_.order);
+}
+
+void CuttingViewWidget::ApplyStockOrder(const std::vector<int>& order) {
+    const int total = static_cast<int>(stocks_.size());
+    if (static_cast<int>(order.size()) != total) return;
+
+    std::vector<int> position(total);   // 当前下标 -> 新位置
+    for (int k = 0; k < total; k++) position[order[k]] = k;
+
+    std::vector<StockData> stocks;
+    std::vector<int> stock_order(total);
+    stocks.reserve(total);
+    for (int k = 0; k < total; k++) {
+        stocks.push_back(std::move(stocks_[order[k]]));
+        stock_order[k] = stock_order_[order[k]];
+    }
+    stocks_.swap(stocks);
+    stock_order_.swap(stock_order);
+    if (static_cast<int>(saw_sequences_.size()) == total) {
+        std::vector<SawSequence> sequences;
+        sequences.reserve(total);
+        for (int k = 0; k < total; k++) sequences.push_back(std::move(saw_sequences_[order[k]]));
+        saw_sequences_.swap(sequences);
+    }
+    if (static_cast<int>(changed_stocks_.size()) == total) {
+        std::vector<char> changed(total);
+        for (int k = 0; k < total; k++) changed[k] = changed_stocks_[order[k]];
+        changed_stocks_.swap(changed);
+    }
+    if (remnant_report_.stocks.size() == stocks_.size()) {
+        std::vector<std::vector<Remnant>> remnants;
+        remnants.reserve(total);
+        for (int k = 0; k < total; k++) remnants.push_back(std::move(remnant_report_.stocks[order[k]]));
+        remnant_report_.stocks.swap(remnants);
+    }
+    // 计算中的结果按旧顺序排列, 丢弃
+    saw_generation_++;
+    remnant_generation_++;
+    stack_generation_++;
+
+    for (Violation& v : validation_.violations) {
+        if (v.stock_index >= 0 && v.stock_index < total) v.stock_index = position[v.stock_index];
+    }
+    CollectFlaggedItems();
+
+    // 重建类型索引, 当前搜索位置跟随其子板
+    ItemPlacement placement{-1, -1};
+    if (type_search_pos_ >= 0) placement = type_index_.placements[type_search_pos_];
+    type_index_ = BuildItemTypeIndex(stocks_);
+    type_search_pos_ = -1;
+    if (placement.stock_index >= 0) {
+        auto [begin, end] = type_index_.StockRange(type_search_slot_, position[placement.stock_index]);
+        for (int p = begin; p < end; p++) {
+            if (type_index_.placements[p].item_index == placement.item_index) type_search_pos_ = p;
         }
     }
+    UpdateTypeSearchLabel();
+    RefreshWasteStatistics();
 
-    // 恢复抗锯齿 (用于后续文字绘制)
-    painter.setRenderHint(QPainter::Antialiasing, true);
+    // 保持显示同一切割方式
+    current_stock_index_ = position[current_stock_index_];
+    InvalidateCache();
+    stock_combo_->blockSignals(true);
+    stock_combo_->clear();
+    stock_combo_->blockSignals(false);
+    // 已渲染的缩略图按新顺序沿用
+    if (!overview_dirty_) {
+        overview_widget_->SetStocks(std::make_shared<const std::vector<StockData>>(stocks_),
+                                    stock_width_, stock_length_, order);
+        overview_widget_->SetChangedFlags(changed_stocks_);
+    }
+    UpdateNavigation();
+    update();
+    emit StockChanged(current_stock_index_, total);
+}
 
-    // 绘制尺寸标注
-    painter.setPen(Qt::darkGray);
+void CuttingViewWidget::DrawSawSequence(QPainter& painter, const QRect& draw_rect) {
+    if (!saw_sequence_button_->isChecked() ||
+        current_stock_index_ >= static_cast<int>(saw_sequences_.size())) {
+        return;
+    }
+    const SawSequence& sequence = saw_sequences_[current_stock_index_];
+    StockTransform t = GetViewTransform();
+
+    painter.save();
+    painter.setClipRect(draw_rect);
+    painter.translate(draw_rect.topLeft());
+    painter.setRenderHint(QPainter::Antialiasing);
     QFont font = painter.font();
     font.setPointSize(8);
+    font.setBold(true);
     painter.setFont(font);
+    QFontMetrics metrics(font);
+
+    // 序号标签按标签高度划分占用网格, 与已放置的标签重叠时省略
+    const int cell = std::max(1, metrics.height());
+    const int grid_cols = draw_rect.width() / cell + 1;
+    const int grid_rows = draw_rect.height() / cell + 1;
+    std::vector<char> occupied(static_cast<size_t>(grid_cols) * grid_rows, 0);
+
+    QRectF visible(QPointF(0, 0), QSizeF(draw_rect.size()));
+    const QColor stage1_color(200, 50, 50);
+    const QColor stage2_color(50, 100, 180);
+
+    for (int k = 0; k < static_cast<int>(sequence.passes.size()); k++) {
+        const SawPass& pass = sequence.passes[k];
+        QPointF a = pass.stage == 1 ? t.ToScreen(pass.from, pass.coord) : t.ToScreen(pass.coord, pass.from);
+        QPointF b = pass.stage == 1 ? t.ToScreen(pass.to, pass.coord) : t.ToScreen(pass.coord, pass.to);
+        if (!QRectF(a, b).normalized().adjusted(-8, -8, 8, 8).intersects(visible)) continue;
+
+        // 合并了多条切割线的一道加粗
+        const QColor& color = pass.stage == 1 ? stage1_color : stage2_color;
+        painter.setPen(QPen(color, pass.cut_count > 1 ? 3 : 2));
+        painter.drawLine(a, b);
+
+        double length = QLineF(a, b).length();
+        if (length < 8) continue;
+
+        // 终点箭头表示切割方向
+        QPointF dir = (b - a) / length;
+        QPointF normal(-dir.y(), dir.x());
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(color);
+        QPointF arrow[3] = {b, b - dir * 7 + normal * 3.5, b - dir * 7 - normal * 3.5};
+        painter.drawPolygon(arrow, 3);
+
+        QString text = QString::number(k + 1);
+        double label_width = metrics.horizontalAdvance(text) + 6;
+        if (length < label_width + 12) continue;
+
+        QPointF center = a + dir * (label_width / 2 + 4);
+        QRectF label(center.x() - label_width / 2, center.y() - metrics.height() / 2.0,
+                     label_width, metrics.height());
+        int col = std::clamp(static_cast<int>(center.x()) / cell, 0, grid_cols - 1);
+        int row = std::clamp(static_cast<int>(center.y()) / cell, 0, grid_rows - 1);
+        char& slot = occupied[static_cast<size_t>(row) * grid_cols + col];
+        if (slot) continue;
+        slot = 1;
+
+        painter.drawRoundedRect(label, 3, 3);
+        painter.setPen(Qt::white);
+        painter.drawText(label, Qt::AlignCenter, text);
+    }
+    painter.restore();
+}
 
-    // 底部: 长度
-    QString length_text = QString("%1").arg(stock_length_);
-    painter.drawText(stock_rect.x(), stock_rect.bottom() + 15,
-                     stock_rect.width(), 15, Qt::AlignCenter, length_text);
+void CuttingViewWidget::wheelEvent(QWheelEvent* event) {
+    QRect draw_rect = GetDrawRect();
+    QPointF pos = event->position() - QPointF(draw_rect.topLeft());
+    if (stocks_.empty() || overview_button_->isChecked() ||
+        !QRectF(QPointF(0, 0), QSizeF(draw_rect.size())).contains(pos)) {
+        QWidget::wheelEvent(event);
+        return;
+    }
 
-    // 右侧: 宽度
-    painter.save();
-    painter.translate(stock_rect.right() + 15, stock_rect.center().y());
-    painter.rotate(-90);
-    QString width_text = QString("%1").arg(stock_width_);
-    painter.drawText(-30, -5, 60, 15, Qt::AlignCenter, width_text);
-    painter.restore();
+    StockTransform before = GetViewTransform();
+    if (before.scale <= 0) return;
+
+    // 缩放上限: 每模型单位不超过 kMaxPixelsPerUnit 像素
+    double fit_scale = before.scale / view_zoom_;
+    double max_zoom = std::max(1.0, kMaxPixelsPerUnit / fit_scale);
+    double zoom = std::clamp(view_zoom_ * std::pow(kWheelZoomBase, event->angleDelta().y()),
+                             1.0, max_zoom);
+    if (zoom == view_zoom_) {
+        event->accept();
+        return;
+    }
+
+    if (zoom <= 1.0) {
+        ResetView();
+    } else {
+        // 以光标为锚点: 缩放前后光标下的模型点保持不变
+        QPointF anchor = before.ToModel(pos);
+        double scale = fit_scale * zoom;
+        QPointF center(draw_rect.width() / 2.0, draw_rect.height() / 2.0);
+        view_zoom_ = zoom;
+        view_center_ = QPointF(anchor.x() - (pos.x() - center.x()) / scale,
+                               anchor.y() + (pos.y() - center.y()) / scale);
+        ClampViewCenter();
+        InvalidateCache();
+    }
+
+    UpdateStockInfoLabel();
+    update();
+    event->accept();
+}
+
+void CuttingViewWidget::mousePressEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton && view_zoom_ > 1.0 &&
+        GetDrawRect().contains(event->position().toPoint())) {
+        panning_ = true;
+        last_mouse_pos_ = event->position().toPoint();
+        setCursor(Qt::ClosedHandCursor);
+        event->accept();
+        return;
+    }
+    QWidget::mousePressEvent(event);
+}
+
+void CuttingViewWidget::mouseMoveEvent(QMouseEvent* event) {
+    if (!panning_) {
+        QWidget::mouseMoveEvent(event);
+        return;
+    }
+
+    QPoint pos = event->position().toPoint();
+    QPoint delta = pos - last_mouse_pos_;
+    last_mouse_pos_ = pos;
+
+    StockTransform t = GetViewTransform();
+    if (t.scale <= 0) return;
+
+    // 屏幕 Y 轴向下, 模型 Y 轴向上
+    if (view_center_.x() < 0) {
+        view_center_ = QPointF(stock_length_ / 2.0, stock_width_ / 2.0);
+    }
+    view_center_ -= QPointF(delta.x() / t.scale, -delta.y() / t.scale);
+    ClampViewCenter();
+    InvalidateCache();
+    update();
+}
+
+void CuttingViewWidget::mouseReleaseEvent(QMouseEvent* event) {
+    if (panning_ && event->button() == Qt::LeftButton) {
+        panning_ = false;
+        unsetCursor();
+        event->accept();
+        return;
+    }
+    QWidget::mouseReleaseEvent(event);
+}
+
+void CuttingViewWidget::mouseDoubleClickEvent(QMouseEvent* event) {
+    if (view_zoom_ > 1.0 && GetDrawRect().contains(event->position().toPoint())) {
+        ResetView();
+        UpdateStockInfoLabel();
+        update();
+        event->accept();
+        return;
+    }
+    QWidget::mouseDoubleClickEvent(event);
 }
 
 bool CuttingViewWidget::ExportCurrentStockImage(const QString& path) {
     if (stocks_.empty()) return false;
 
-    // 创建图片
-    QPixmap pixmap(800, 600);
-    pixmap.fill(Qt::white);
+    // 与批量导出使用同一页面布局 (QImage 不依赖窗口系统)
+    QImage image = RenderStockPageImage(stocks_[current_stock_index_], current_stock_index_,
+                                        static_cast<int>(stocks_.size()),
+                                        stock_width_, stock_length_, StockExportOptions());
+    return !image.isNull() && image.save(path);
+}
 
-    QPainter painter(&pixmap);
-    painter.setRenderHint(QPainter::Antialiasing);
+std::shared_ptr<const CuttingSolution> CuttingViewWidget::GetSolutionSnapshot() const {
+    auto solution = std::make_shared<CuttingSolution>();
+    solution->stock_width = stock_width_;
+    solution->stock_length = stock_length_;
+    solution->item_type_count = static_cast<int>(color_map_.size());
+    solution->physical_stock_count = physical_stock_count_;
+    solution->item_types = item_types_;
+    solution->stocks = stocks_;
+    return solution;
+}
 
-    QRect draw_rect(20, 20, 760, 560);
-    DrawStock(painter, stocks_[current_stock_index_], draw_rect);
+void CuttingViewWidget::ExportAllStocks() {
+    if (stocks_.empty() || IsLoading() || export_watcher_->isRunning()) return;
+
+    QString path = QFileDialog::getSaveFileName(
+        this, QString::fromUtf8("导出全部方案"), QString(),
+        QString::fromUtf8("PNG 图片 (*.png);;PDF 文档 (*.pdf);;SVG 图像 (*.svg);;"
+                         "DXF 图形 (*.dxf);;切割程序 (*.nc *.gcode *.cnc)"));
+    if (path.isEmpty()) return;
+
+    StockExportOptions options;
+    options.format = StockExportFormatFromPath(path);
+    if (options.format == StockExportFormat::kPng) {
+        bool ok = false;
+        options.dpi = QInputDialog::getInt(this, QString::fromUtf8("导出 PNG"),
+                                           QString::fromUtf8("分辨率 (DPI):"),
+                                           options.dpi, 72, 600, 1, &ok);
+        if (!ok) return;
+    }
 
-    return pixmap.save(path);
+    auto solution = GetSolutionSnapshot();
+    int total = static_cast<int>(solution->stocks.size());
+
+    export_progress_ = new QProgressDialog(QString::fromUtf8("正在导出 %1 块母板...").arg(total),
+                                           QString::fromUtf8("取消"), 0, total, this);
+    export_progress_->setWindowModality(Qt::WindowModal);
+    export_progress_->setMinimumDuration(0);
+    export_progress_->setAutoClose(false);
+    export_progress_->setAutoReset(false);
+    connect(export_progress_, &QProgressDialog::canceled,
+            export_watcher_, &QFutureWatcher<StockExportResult>::cancel);
+    connect(export_watcher_, &QFutureWatcher<StockExportResult>::progressValueChanged,
+            export_progress_, &QProgressDialog::setValue);
+
+    export_all_button_->setEnabled(false);
+    export_print_button_->setEnabled(false);
+
+    // 后台线程导出, 进度与取消通过 QPromise 传递
+    export_watcher_->setFuture(QtConcurrent::run(
+        [solution, path, options](QPromise<StockExportResult>& promise) {
+            promise.setProgressRange(0, static_cast<int>(solution->stocks.size()));
+            StockExportResult result = ExportStocks(*solution, path, options,
+                [&promise](int done, int) {
+                    promise.setProgressValue(done);
+                    return !promise.isCanceled();
+                });
+            promise.addResult(result);
+        }));
+}
+
+void CuttingViewWidget::ExportLargePrint() {
+    if (stocks_.empty() || export_watcher_->isRunning()) return;
+
+    QString path = QFileDialog::getSaveFileName(
+        this, QString::fromUtf8("大幅面导出"), QString(),
+        QString::fromUtf8("分块 TIFF (*.tif *.tiff);;PNG 分块 (*.png)"));
+    if (path.isEmpty()) return;
+
+    TiledExportOptions options;
+    bool ok = false;
+    options.width = QInputDialog::getInt(this, QString::fromUtf8("大幅面导出"),
+                                         QString::fromUtf8("输出宽度 (像素):"),
+                                         options.width, 1000, 200000, 1000, &ok);
+    if (!ok) return;
+    options.dpi = QInputDialog::getInt(this, QString::fromUtf8("大幅面导出"),
+                                       QString::fromUtf8("打印分辨率 (DPI):"),
+                                       options.dpi, 72, 1200, 1, &ok);
+    if (!ok) return;
+
+    // 快照只含当前母板 (条带与子板共享存储, 不复制)
+    StockData stock = stocks_[current_stock_index_];
+    int stock_width = stock_width_;
+    int stock_length = stock_length_;
+    QSize canvas = TiledExportCanvasSize(stock_width, stock_length, options);
+    int tiles = ((canvas.width() + options.tile_size - 1) / options.tile_size) *
+                ((canvas.height() + options.tile_size - 1) / options.tile_size);
+
+    export_progress_ = new QProgressDialog(
+        QString::fromUtf8("正在导出 %1 x %2 像素 (%3 块)...").arg(canvas.width()).arg(canvas.height()).arg(tiles),
+        QString::fromUtf8("取消"), 0, tiles, this);
+    export_progress_->setWindowModality(Qt::WindowModal);
+    export_progress_->setMinimumDuration(0);
+    export_progress_->setAutoClose(false);
+    export_progress_->setAutoReset(false);
+    connect(export_progress_, &QProgressDialog::canceled,
+            export_watcher_, &QFutureWatcher<StockExportResult>::cancel);
+    connect(export_watcher_, &QFutureWatcher<StockExportResult>::progressValueChanged,
+            export_progress_, &QProgressDialog::setValue);
+
+    export_all_button_->setEnabled(false);
+    export_print_button_->setEnabled(false);
+
+    export_watcher_->setFuture(QtConcurrent::run(
+        [stock, stock_width, stock_length, path, options](QPromise<StockExportResult>& promise) {
+            StockExportResult result = ExportStockTiled(stock, stock_width, stock_length, path, options,
+                [&promise](int done, int total) {
+                    promise.setProgressRange(0, total);
+                    promise.setProgressValue(done);
+                    return !promise.isCanceled();
+                });
+            promise.addResult(result);
+        }));
+}
+
+void CuttingViewWidget::ShowBookPlan() {
+    if (stocks_.empty() || IsLoading()) return;
+
+    // 复用已计算的锯切顺序; 尚未计算时在后台计算, 完成后在 OnSawSequenceFinished 中打开
+    if (saw_sequences_.size() != stocks_.size()) {
+        book_plan_pending_ = true;
+        book_plan_button_->setText(QString::fromUtf8("叠切计划 (计算中)"));
+        StartSawSequencing();
+        return;
+    }
+    book_plan_pending_ = false;
+    book_plan_button_->setText(QString::fromUtf8("叠切计划..."));
+
+    BookPlanDialog dialog(GetSolutionSnapshot(), saw_sequences_, this);
+    connect(&dialog, &BookPlanDialog::PatternActivated, this, [this](int index) {
+        overview_button_->setChecked(false);
+        ShowStock(index);
+    });
+    dialog.exec();
+}
+
+void CuttingViewWidget::ShowWasteReport() {
+    if (!waste_stats_) return;
+
+    WasteReportDialog dialog(waste_stats_, GetSolutionSnapshot(), this);
+    connect(&dialog, &WasteReportDialog::PatternActivated, this, [this](int index) {
+        overview_button_->setChecked(false);
+        ShowStock(index);
+    });
+    dialog.exec();
+}
+
+void CuttingViewWidget::ShowSolutionDiff() {
+    if (stocks_.empty() || IsLoading()) return;
+
+    QString path = QFileDialog::getOpenFileName(
+        this, QString::fromUtf8("选择要对比的解文件"), QFileInfo(solution_path_).absolutePath(),
+        QString::fromUtf8("JSON 文件 (*.json);;所有文件 (*)"));
+    if (path.isEmpty()) return;
+
+    // 左侧为当前方案 (按当前显示顺序), 双击配对时跳转到对应母板
+    SolutionDiffDialog dialog(GetSolutionSnapshot(), QFileInfo(solution_path_).fileName(), path, this);
+    connect(&dialog, &SolutionDiffDialog::PatternActivated, this, [this](int index) {
+        overview_button_->setChecked(false);
+        ShowStock(index);
+    });
+    dialog.exec();
+}
+
+void CuttingViewWidget::RefreshWasteStatistics() {
+    std::vector<int> multiplicity(stocks_.size());
+    for (size_t i = 0; i < stocks_.size(); i++) multiplicity[i] = stocks_[i].multiplicity;
+    waste_stats_ = std::make_shared<const WasteStatistics>(
+        ComputeWasteStatistics(stocks_, stock_width_, stock_length_));
+    heatmap_widget_->SetStatistics(waste_stats_, std::move(multiplicity));
+}
+
+void CuttingViewWidget::OnExportAllFinished() {
+    if (export_progress_) {
+        export_progress_->close();
+        export_progress_->deleteLater();
+        export_progress_ = nullptr;
+    }
+    export_all_button_->setEnabled(!stocks_.empty());
+    export_print_button_->setEnabled(!stocks_.empty());
+
+    QFuture<StockExportResult> future = export_watcher_->future();
+    if (future.isCanceled() || future.resultCount() == 0) {
+        QMessageBox::information(this, QString::fromUtf8("导出"), QString::fromUtf8("导出已取消"));
+        return;
+    }
+
+    StockExportResult result = future.result();
+    if (result.cancelled) {
+        QMessageBox::information(this, QString::fromUtf8("导出"), QString::fromUtf8("导出已取消"));
+    } else if (!result.success) {
+        QMessageBox::warning(this, QString::fromUtf8("导出错误"), result.error);
+    } else {
+        QMessageBox::information(this, QString::fromUtf8("导出"),
+            QString::fromUtf8("已导出 %1 个文件, %2 KB, 用时 %3 ms")
+                .arg(result.files.size())
+                .arg(result.bytes / 1024)
+                .arg(result.elapsed_ms));
+    }
 }
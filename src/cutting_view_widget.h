@@ -14,88 +14,283 @@
 #include <QWidget>
 #include <QString>
 #include <QColor>
+#include <QImage>
+#include <QSize>
+#include <QPoint>
+#include <QPointF>
+#include <QFutureWatcher>
+#include <QElapsedTimer>
+#include <memory>
 #include <vector>
 #include <map>
+#include "cutting_data.h"
+#include "stock_renderer.h"
+#include "stock_export.h"
+#include "solution_validator.h"
+#include "saw_sequencer.h"
+#include "machine_simulator.h"
+#include "stack_sequencer.h"
+#include "remnant_extractor.h"
+#include "item_type_index.h"
+#include "waste_statistics.h"
+#include "solution_loader.h"
 
 class QPushButton;
 class QLabel;
 class QComboBox;
-
-// 条带绘制信息
-struct StripRect {
-    int strip_id;    // 条带ID (从0开始)
-    int y;           // Y起始位置
-    int width;       // 条带宽度
-};
-
-// 子板绘制信息
-struct ItemRect {
-    int item_type;   // 子板类型 (从1开始)
-    int x, y;        // 左下角位置
-    int width;       // 宽度
-    int length;      // 长度
-    int strip_id;    // 所属条带ID
-};
-
-// 母板数据
-struct StockData {
-    int stock_id;
-    double utilization;
-    std::vector<StripRect> strips;
-    std::vector<ItemRect> items;
-};
+class QLineEdit;
+class QProgressDialog;
+class QTimer;
+class QPainter;
+class StockOverviewWidget;
+class UtilizationHeatmapWidget;
 
 class CuttingViewWidget : public QWidget {
     Q_OBJECT
 
 public:
     explicit CuttingViewWidget(QWidget* parent = nullptr);
+    ~CuttingViewWidget() override;
 
-    // 加载 JSON 解文件
+    // 在后台逐批加载 JSON 解文件 (立即返回, 文件不可读时返回 false); 结束时发出 SolutionLoaded
+    // 路径与当前方案相同时增量重新加载, 失败时保留当前方案
     bool LoadSolution(const QString& json_path);
     void Clear();
+    bool IsLoading() const { return load_watcher_->isRunning(); }
 
     // 导出当前母板为图片
     bool ExportCurrentStockImage(const QString& path);
 
+    // 最近一次加载的校验结果
+    const ValidationReport& GetValidationReport() const { return validation_; }
+
+    // 提取余料并加入库存文件 (未提取时先在后台提取); 结果以 RemnantsStored 通知
+    void StoreRemnants(const QString& inventory_path);
+
+    // 机器参数 (锯切顺序、机器时间与回放); 修改后重新优化锯切顺序
+    void SetMachineParameters(const MachineParameters& params);
+    const MachineParameters& GetMachineParameters() const { return machine_params_; }
+
+    // 当前方案快照 (可拷贝到工作线程)
+    std::shared_ptr<const CuttingSolution> GetSolutionSnapshot() const;
+
     // 获取当前状态
-    int GetStockCount() const { return static_cast<int>(stocks_.size()); }
+    int GetStockCount() const { return static_cast<int>(stocks_.size()); }      // 切割方式数
+    int GetPhysicalStockCount() const { return physical_stock_count_; }         // 母板总数
     int GetCurrentStockIndex() const { return current_stock_index_; }
 
 signals:
     void StockChanged(int index, int total);
+    void SolutionLoaded(bool ok, const QString& message);   // message 为加载概要或错误
+    void RemnantsStored(bool ok, const QString& message);   // message 为入库结果或错误
 
 public slots:
     void ShowPrevStock();
     void ShowNextStock();
     void ShowStock(int index);
+    void ExportAllStocks();
+    void ExportLargePrint();        // 当前母板的大幅面分块导出
+    void ShowBookPlan();
+    void ShowWasteReport();         // 利用率分布与最差切割方式
+    void ShowSolutionDiff();        // 与同一算例的另一个解文件对比
 
 private slots:
+    void OnLoadChunksReady(int begin, int end);
+    void OnLoadFinished();
+    void OnReloadFinished();
+    void OnChangesBadgeClicked();
     void OnStockComboChanged(int index);
+    void OnOverviewToggled(bool checked);
+    void OnOverviewStockClicked(int index);
+    void OnOverviewProgress(int done, int total, qint64 elapsed_ms);
+    void OnExportAllFinished();
+    void OnValidationBadgeClicked();
+    void OnSawSequenceToggled(bool checked);
+    void OnSawSequenceFinished();
+    void OnReplayToggled(bool checked);
+    void OnReplayTick();
+    void OnRemnantsToggled(bool checked);
+    void OnRemnantsFinished();
+    void OnStackOrderToggled(bool checked);
+    void OnStackOrderFinished();
+    void OnTypeSearchChanged();
+    void ShowNextPlacement();
+    void ShowPrevPlacement();
 
 protected:
     void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
 
 private:
     void SetupUi();
+    void DiscardSolution();                 // 清空方案数据 (各开关保持原状态)
+    void ApplyLoadChunk(SolutionChunk& chunk);
+    void RebuildSolutionState();            // 方案整体替换后: 校验、类型索引、统计, 重新开始各后台计算
+    void ReloadSolution();
+    void ApplyReload(SolutionReload& reload);
+    void UpdateChangesBadge();
+    void UpdateLoadLabel();
+    QString StockComboText(int index) const;
     void UpdateNavigation();
-    QColor GetItemColor(int item_type);
-    void DrawStock(QPainter& painter, const StockData& stock, const QRect& rect);
+    void UpdateStockInfoLabel();
+    QRect GetDrawRect() const;
+    void UpdateChildGeometry();             // 热力条与总览的位置
+    void InvalidateCache();
+
+    // 视图 (滚轮以光标为中心缩放, 拖拽平移, 双击恢复适配视图)
+    void ResetView();
+    StockRenderOptions GetViewOptions() const;
+    StockTransform GetViewTransform() const;   // 相对绘图区左上角
+    void ClampViewCenter();
+
+    // 校验
+    void CollectFlaggedItems();             // 由 validation_ 整理 flagged_items_
+    void UpdateValidationBadge();
+    void DrawViolationHighlights(QPainter& painter, const QRect& draw_rect);
+
+    // 锯切顺序: 后台为全部切割方式计算, 图上标注序号, 导航栏显示估计周期时间
+    void StartSawSequencing();
+    void DrawSawSequence(QPainter& painter, const QRect& draw_rect);
+
+    // 切割回放: 按机器时间模拟 (machine_simulator) 的时间线动画演示当前切割方式
+    void StartReplay();
+    double ReplayTime() const;      // 当前模拟时刻 (秒)
+    void DrawReplay(QPainter& painter, const QRect& draw_rect);
+
+    // 余料: 后台提取各切割方式的可复用余料并在图上标出 (StoreRemnants 加入库存)
+    void StartRemnantExtraction();
+    void FinishStoreRemnants();     // 余料已提取后写入 remnant_store_path_
+    void DrawRemnants(QPainter& painter, const QRect& draw_rect);
+
+    // 利用率统计 (加载与重排时重新计算并刷新热力条)
+    void RefreshWasteStatistics();
+
+    // 子板类型搜索: 按倒排索引 (item_type_index) 标出全部摆放位置, 前后跳转并显示各切割方式间的分配
+    void ShowPlacement(int pos);            // 跳到 type_index_.placements[pos]
+    void UpdateTypeSearchLabel();
+    void DrawTypeHighlights(QPainter& painter, const QRect& draw_rect);
+
+    // 开放堆栈排序: 后台按最少开放堆栈重排切割方式, 翻页、总览与导出均按新顺序
+    void StartStackOrdering();
+    void ApplyStockOrder(const std::vector<int>& order);   // order[k] 为放到位置 k 的当前下标
 
     // UI 组件
     QPushButton* prev_button_;
     QPushButton* next_button_;
     QComboBox* stock_combo_;
     QLabel* utilization_label_;
+    QPushButton* overview_button_;
+    StockOverviewWidget* overview_widget_;
+    QPushButton* export_all_button_;
+    QPushButton* export_print_button_;
+    QPushButton* validation_badge_;
+    QPushButton* changes_badge_;
+    QPushButton* saw_sequence_button_;
+    QPushButton* replay_button_;
+    QPushButton* book_plan_button_;
+    QPushButton* waste_report_button_;
+    QPushButton* diff_button_;
+    UtilizationHeatmapWidget* heatmap_widget_;     // 全部切割方式的利用率, 点击跳转
+    QPushButton* stack_order_button_;
+    QPushButton* remnant_button_;
+    QLineEdit* type_search_edit_;
+    QPushButton* type_prev_button_;
+    QPushButton* type_next_button_;
+    QLabel* type_search_label_;
+    QLabel* load_label_;
+
+    // 逐批加载 (solution_loader): 第一批到达即可翻页, 校验、统计与依赖全部切割方式的功能在加载完成后启用
+    // 每批以共享指针传递, 界面线程取走数据后结果存储中只剩空壳
+    QFutureWatcher<std::shared_ptr<SolutionChunk>>* load_watcher_;
+    QElapsedTimer load_clock_;
+    QString load_error_;
+    int load_total_;                        // 母板总数 (去重前), -1 表示尚未统计
+
+    // 增量重新加载: 按母板原文哈希, 内容未变的切割方式沿用几何、渲染缓存与总览缩略图
+    // (fingerprint_ 的切割方式序号为解文件中的顺序, 与 stock_order_ 一致)
+    // 计算期间再次请求时只记下 reload_again_, 结束后重新开始
+    QFutureWatcher<std::shared_ptr<SolutionReload>>* reload_watcher_;
+    std::shared_ptr<SolutionFingerprint> fingerprint_;
+    int reload_generation_;
+    int reload_pending_generation_;
+    bool reload_again_;
+    std::vector<char> changed_stocks_;      // 与上一次加载相比为新内容 (下标与 stocks_ 相同), 未重新加载过时为空
+    int removed_stock_count_;               // 上一次加载中不再使用的切割方式数
+
+    // 批量导出
+    QFutureWatcher<StockExportResult>* export_watcher_;
+    QProgressDialog* export_progress_;
+
+    // 锯切顺序 (generation 在每次加载或清空时递增, 过期的计算结果被丢弃)
+    QFutureWatcher<std::vector<SawSequence>>* saw_watcher_;
+    std::vector<SawSequence> saw_sequences_;
+    int saw_generation_;
+    int saw_pending_generation_;
+    bool book_plan_pending_;        // 叠切计划等待锯切顺序, 计算完成后打开
+
+    // 切割回放 (模拟时间按 replay_speed_ 倍速播放); 机器参数初始取已保存的设置
+    MachineParameters machine_params_;
+    QTimer* replay_timer_;
+    QElapsedTimer replay_clock_;
+    MachineTimeline replay_timeline_;
+    int replay_stock_index_;
+    double replay_speed_;
+
+    // 余料 (remnant_report_.stocks 与 stocks_ 一一对应, 为空表示尚未提取)
+    QFutureWatcher<RemnantReport>* remnant_watcher_;
+    RemnantReport remnant_report_;
+    int remnant_generation_;
+    int remnant_pending_generation_;
+    QString remnant_store_path_;    // 等待提取完成后入库的库存文件, 为空表示无
+
+    // 利用率与浪费统计 (下标与 stocks_ 相同)
+    std::shared_ptr<const WasteStatistics> waste_stats_;
+
+    // 子板类型索引 (加载与重排时重建); type_search_pos_ 为当前位置在 placements 中的下标, -1 表示未定位
+    ItemTypeIndex type_index_;
+    int type_search_slot_;
+    int type_search_pos_;
+
+    // 开放堆栈排序 (stock_order_[k] 为位置 k 的切割方式在解文件中的下标)
+    QFutureWatcher<StackSequenceResult>* stack_watcher_;
+    StackSequenceResult stack_result_;
+    std::vector<int> stock_order_;
+    int stack_generation_;
+    int stack_pending_generation_;
 
     // 数据
+    QString solution_path_;
     std::vector<StockData> stocks_;
     int current_stock_index_;
     int stock_width_;
     int stock_length_;
+    int physical_stock_count_;
+    std::vector<ItemTypeSpec> item_types_;
+    bool overview_dirty_;               // 数据变化后总览需重新渲染
 
     // 颜色映射
     std::map<int, QColor> color_map_;
+
+    // 校验结果: 每个切割方式中违规子板的下标 (升序, 去重)
+    ValidationReport validation_;
+    std::vector<std::vector<int>> flagged_items_;
+
+    // 视图状态 (zoom 为相对适配视图的倍数, 中心为模型坐标)
+    double view_zoom_;
+    QPointF view_center_;
+    bool panning_;
+    QPoint last_mouse_pos_;
+
+    // 当前母板的渲染缓存 (按母板下标、绘图区尺寸与设备像素比), 重绘只做一次贴图
+    QImage stock_cache_;
+    int cache_stock_index_;
+    QSize cache_size_;
+    qreal cache_dpr_;
 };
 
 #endif  // CUTTING_VIEW_WIDGET_H_
@@ -9,6 +9,7 @@
 // generator_widget.cpp - Instance Generator Widget Implementation
 
 #include "generator_widget.h"
+#include "remnant_inventory.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -27,6 +28,8 @@
 #include <QFileDialog>
 #include <QToolButton>
 #include <QMessageBox>
+#include <QMenu>
+#include <QFileInfo>
 
 GeneratorWidget::GeneratorWidget(QWidget* parent)
     : QWidget(parent) {
@@ -185,6 +188,15 @@ void GeneratorWidget::SetupManualModeUi(QGroupBox* group) {
     scale_layout->addWidget(new QLabel(QString::fromUtf8("母板长:")));
     scale_layout->addWidget(stock_length_spin_);
 
+    remnant_button_ = new QToolButton();
+    remnant_button_->setText(QString::fromUtf8("余料..."));
+    remnant_button_->setToolTip(QString::fromUtf8("从余料库存选择母板尺寸, 为余料生成新算例"));
+    remnant_button_->setPopupMode(QToolButton::InstantPopup);
+    remnant_menu_ = new QMenu(remnant_button_);
+    remnant_button_->setMenu(remnant_menu_);
+    connect(remnant_menu_, &QMenu::aboutToShow, this, &GeneratorWidget::OnRemnantMenuAboutToShow);
+    scale_layout->addWidget(remnant_button_);
+
     layout->addWidget(new QLabel(QString::fromUtf8("规模")), row, 0, Qt::AlignRight);
     layout->addLayout(scale_layout, row, 1, 1, 2);
     row++;
@@ -569,3 +581,42 @@ void GeneratorWidget::OnHelpButtonClicked() {
 
     QMessageBox::information(this, title, content);
 }
+
+void GeneratorWidget::OnRemnantMenuAboutToShow() {
+    remnant_menu_->clear();
+
+    RemnantInventory inventory;
+    QString error;
+    if (!LoadRemnantInventory(DefaultRemnantInventoryPath(), &inventory, &error)) {
+        remnant_menu_->addAction(error)->setEnabled(false);
+        return;
+    }
+    if (inventory.remnants.empty()) {
+        remnant_menu_->addAction(QString::fromUtf8("余料库存为空 (在可视化 Tab 中入库)"))->setEnabled(false);
+        return;
+    }
+
+    // 按面积从大到小列出, 超出母板尺寸范围的不可选
+    constexpr int kMaxMenuEntries = 30;
+    int shown = 0;
+    for (const RemnantStock& remnant : inventory.remnants) {
+        if (shown++ >= kMaxMenuEntries) {
+            remnant_menu_->addAction(QString::fromUtf8("... (共 %1 种)").arg(inventory.remnants.size()))
+                ->setEnabled(false);
+            break;
+        }
+        QAction* action = remnant_menu_->addAction(QString::fromUtf8("%1 x %2  ×%3  (%4)")
+            .arg(remnant.width).arg(remnant.length).arg(remnant.quantity)
+            .arg(QFileInfo(remnant.source).fileName()));
+        action->setToolTip(remnant.source);
+        bool fits = remnant.width >= stock_width_spin_->minimum() && remnant.width <= stock_width_spin_->maximum() &&
+                    remnant.length >= stock_length_spin_->minimum() && remnant.length <= stock_length_spin_->maximum();
+        action->setEnabled(fits);
+        int width = remnant.width;
+        int length = remnant.length;
+        connect(action, &QAction::triggered, this, [this, width, length]() {
+            stock_width_spin_->setValue(width);
+            stock_length_spin_->setValue(length);
+        });
+    }
+}
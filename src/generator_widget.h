@@ -27,6 +27,7 @@ class QGroupBox;
 class QButtonGroup;
 class QRadioButton;
 class QToolButton;
+class QMenu;
 
 class GeneratorWidget : public QWidget {
     Q_OBJECT
@@ -52,6 +53,7 @@ private slots:
     void OnGenerateClicked();
     void UpdatePreview();
     void OnHelpButtonClicked();
+    void OnRemnantMenuAboutToShow();
 
 private:
     void SetupUi();
@@ -84,6 +86,8 @@ private:
     QSpinBox* num_types_spin_;
     QSpinBox* stock_width_spin_;
     QSpinBox* stock_length_spin_;
+    QToolButton* remnant_button_;   // 从余料库存选择母板尺寸
+    QMenu* remnant_menu_;
     QDoubleSpinBox* min_size_ratio_spin_;
     QDoubleSpinBox* max_size_ratio_spin_;
     QDoubleSpinBox* size_cv_spin_;
@@ -0,0 +1,124 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// item_type_index.cpp - 子板类型倒排索引实现
+
+#include "item_type_index.h"
+
+#include <algorithm>
+
+int ItemTypeIndex::Find(int type_id) const {
+    auto it = std::lower_bound(type_ids.begin(), type_ids.end(), type_id);
+    if (it == type_ids.end() || *it != type_id) return -1;
+    return static_cast<int>(it - type_ids.begin());
+}
+
+std::pair<int, int> ItemTypeIndex::StockRange(int slot, int stock_index) const {
+    auto first = placements.begin() + type_start[slot];
+    auto last = placements.begin() + type_start[slot + 1];
+    auto lo = std::lower_bound(first, last, stock_index,
+                               [](const ItemPlacement& p, int s) { return p.stock_index < s; });
+    auto hi = std::upper_bound(lo, last, stock_index,
+                               [](int s, const ItemPlacement& p) { return s < p.stock_index; });
+    return {static_cast<int>(lo - placements.begin()), static_cast<int>(hi - placements.begin())};
+}
+
+ItemTypeIndex BuildItemTypeIndex(const std::vector<StockData>& stocks) {
+    ItemTypeIndex index;
+
+    size_t total = 0;
+    for (const StockData& stock : stocks) total += stock.items.size();
+
+    // 类型集合与类型 -> 下标映射; 类型ID通常是 1..n 的连续编号, 值域不大时用直接映射表
+    int min_type = 0;
+    int max_type = -1;
+    for (const StockData& stock : stocks) {
+        for (const ItemRect& item : stock.items) {
+            if (max_type < min_type) min_type = max_type = item.item_type;
+            min_type = std::min(min_type, item.item_type);
+            max_type = std::max(max_type, item.item_type);
+        }
+    }
+    std::vector<int>& types = index.type_ids;
+    std::vector<int> dense;
+    const bool use_dense = max_type >= min_type &&
+        static_cast<long long>(max_type) - min_type < static_cast<long long>(total) + 1024;
+    if (use_dense) {
+        dense.assign(static_cast<size_t>(max_type - min_type) + 1, -1);
+        for (const StockData& stock : stocks) {
+            for (const ItemRect& item : stock.items) dense[item.item_type - min_type] = 0;
+        }
+        for (size_t v = 0; v < dense.size(); v++) {
+            if (dense[v] == 0) {
+                dense[v] = static_cast<int>(types.size());
+                types.push_back(min_type + static_cast<int>(v));
+            }
+        }
+    } else {
+        types.reserve(total);
+        for (const StockData& stock : stocks) {
+            for (const ItemRect& item : stock.items) types.push_back(item.item_type);
+        }
+        std::sort(types.begin(), types.end());
+        types.erase(std::unique(types.begin(), types.end()), types.end());
+        types.shrink_to_fit();
+    }
+    const int type_count = static_cast<int>(types.size());
+    auto slot_for = [&](int type_id) {
+        return use_dense ? dense[type_id - min_type] : index.Find(type_id);
+    };
+
+    // 计数排序: 每个子板的类型下标只查找一次
+    std::vector<int> slot_of(total);
+    index.type_start.assign(type_count + 1, 0);
+    index.produced.assign(type_count, 0);
+    index.area.assign(type_count, 0.0);
+    index.pattern_count.assign(type_count, 0);
+    std::vector<int> last_stock(type_count, -1);
+
+    size_t k = 0;
+    for (size_t s = 0; s < stocks.size(); s++) {
+        const StockData& stock = stocks[s];
+        for (const ItemRect& item : stock.items) {
+            int slot = slot_for(item.item_type);
+            slot_of[k++] = slot;
+            index.type_start[slot + 1]++;
+            index.produced[slot] += stock.multiplicity;
+            index.area[slot] += static_cast<double>(item.width) * item.length * stock.multiplicity;
+            if (last_stock[slot] != static_cast<int>(s)) {
+                last_stock[slot] = static_cast<int>(s);
+                index.pattern_count[slot]++;
+            }
+        }
+    }
+    for (int t = 0; t < type_count; t++) index.type_start[t + 1] += index.type_start[t];
+
+    // 按切割方式顺序写入, 每个类型内自然有序
+    index.placements.resize(total);
+    std::vector<int> cursor(index.type_start.begin(), index.type_start.end() - 1);
+    k = 0;
+    for (size_t s = 0; s < stocks.size(); s++) {
+        for (size_t i = 0; i < stocks[s].items.size(); i++) {
+            index.placements[cursor[slot_of[k++]]++] = ItemPlacement{static_cast<int>(s), static_cast<int>(i)};
+        }
+    }
+    return index;
+}
+
+std::vector<ItemTypeShare> ItemTypeShares(const ItemTypeIndex& index, int slot,
+                                          const std::vector<StockData>& stocks) {
+    std::vector<ItemTypeShare> shares;
+    for (int p = index.type_start[slot]; p < index.type_start[slot + 1]; p++) {
+        int s = index.placements[p].stock_index;
+        if (shares.empty() || shares.back().stock_index != s) {
+            shares.push_back(ItemTypeShare{s, 0, stocks[s].multiplicity});
+        }
+        shares.back().per_sheet++;
+    }
+    return shares;
+}
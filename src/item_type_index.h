@@ -0,0 +1,61 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// item_type_index.h - 子板类型倒排索引
+// 加载时一次构建: 子板类型 -> 全部摆放位置 (切割方式下标, 子板下标), CSR 存储,
+// 同一类型的位置按 (切割方式, 子板) 升序, 某切割方式内的位置是连续区段 (二分查找)
+// 另按类型汇总产出数量、面积与所在切割方式数 (均含重复次数)
+
+#ifndef ITEM_TYPE_INDEX_H_
+#define ITEM_TYPE_INDEX_H_
+
+#include <utility>
+#include <vector>
+#include "cutting_data.h"
+
+struct ItemPlacement {
+    int stock_index;    // stocks 中的下标
+    int item_index;     // stocks[stock_index].items 中的下标
+};
+
+struct ItemTypeIndex {
+    std::vector<int> type_ids;                  // 出现过的子板类型, 升序
+    std::vector<int> type_start;                // type_ids.size() + 1
+    std::vector<ItemPlacement> placements;
+
+    // 按类型汇总 (下标与 type_ids 相同)
+    std::vector<long long> produced;            // 产出数量 (含重复次数)
+    std::vector<double> area;                   // 产出面积 (含重复次数)
+    std::vector<int> pattern_count;             // 所在切割方式数
+
+    // 类型在 type_ids 中的下标, 未出现返回 -1
+    int Find(int type_id) const;
+    int TypeCount() const { return static_cast<int>(type_ids.size()); }
+    int PlacementCount(int slot) const { return type_start[slot + 1] - type_start[slot]; }
+
+    // slot 类型在切割方式 stock_index 中的位置区段 [begin, end) (placements 下标)
+    std::pair<int, int> StockRange(int slot, int stock_index) const;
+
+    bool empty() const { return type_ids.empty(); }
+};
+
+// 单个切割方式中某类型的产出
+struct ItemTypeShare {
+    int stock_index;
+    int per_sheet;      // 每张母板的数量
+    int multiplicity;   // 母板张数
+};
+
+// 构建索引 O(子板总数 + 类型数 * log)
+ItemTypeIndex BuildItemTypeIndex(const std::vector<StockData>& stocks);
+
+// slot 类型在各切割方式之间的分配 (按切割方式下标升序)
+std::vector<ItemTypeShare> ItemTypeShares(const ItemTypeIndex& index, int slot,
+                                          const std::vector<StockData>& stocks);
+
+#endif  // ITEM_TYPE_INDEX_H_
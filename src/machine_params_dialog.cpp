@@ -0,0 +1,135 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// machine_params_dialog.cpp - 机器参数对话框实现
+
+#include "machine_params_dialog.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFormLayout>
+#include <QLabel>
+#include <QDoubleSpinBox>
+#include <QPushButton>
+#include <QSettings>
+
+namespace {
+
+// QSettings 键 (组 "machine")
+constexpr char kSettingsGroup[] = "machine";
+
+QDoubleSpinBox* CreateSpin(double min, double max, int decimals, const QString& suffix, QWidget* parent) {
+    auto* spin = new QDoubleSpinBox(parent);
+    spin->setRange(min, max);
+    spin->setDecimals(decimals);
+    spin->setSuffix(suffix);
+    return spin;
+}
+
+}  // namespace
+
+MachineParameters LoadMachineParameters() {
+    MachineParameters params;
+    QSettings settings;
+    settings.beginGroup(kSettingsGroup);
+    params.saw.cut_speed = settings.value("cut_speed", params.saw.cut_speed).toDouble();
+    params.saw.rapid_speed = settings.value("rapid_speed", params.saw.rapid_speed).toDouble();
+    params.saw.pass_overhead = settings.value("pass_overhead", params.saw.pass_overhead).toDouble();
+    params.saw.rotation_time = settings.value("rotation_time", params.saw.rotation_time).toDouble();
+    params.load_time = settings.value("load_time", params.load_time).toDouble();
+    params.unload_time = settings.value("unload_time", params.unload_time).toDouble();
+    params.kerf = settings.value("kerf", params.kerf).toDouble();
+    settings.endGroup();
+    return params;
+}
+
+void SaveMachineParameters(const MachineParameters& params) {
+    QSettings settings;
+    settings.beginGroup(kSettingsGroup);
+    settings.setValue("cut_speed", params.saw.cut_speed);
+    settings.setValue("rapid_speed", params.saw.rapid_speed);
+    settings.setValue("pass_overhead", params.saw.pass_overhead);
+    settings.setValue("rotation_time", params.saw.rotation_time);
+    settings.setValue("load_time", params.load_time);
+    settings.setValue("unload_time", params.unload_time);
+    settings.setValue("kerf", params.kerf);
+    settings.endGroup();
+}
+
+MachineParamsDialog::MachineParamsDialog(const MachineParameters& params, QWidget* parent)
+    : QDialog(parent) {
+    setWindowTitle(QString::fromUtf8("机器参数"));
+    SetupUi();
+    SetParameters(params);
+}
+
+void MachineParamsDialog::SetupUi() {
+    auto* main_layout = new QVBoxLayout(this);
+
+    auto* form_layout = new QFormLayout();
+    cut_speed_spin_ = CreateSpin(1, 100000, 1, QString::fromUtf8(" /秒"), this);
+    rapid_speed_spin_ = CreateSpin(1, 100000, 1, QString::fromUtf8(" /秒"), this);
+    pass_overhead_spin_ = CreateSpin(0, 600, 2, QString::fromUtf8(" 秒"), this);
+    rotation_time_spin_ = CreateSpin(0, 600, 1, QString::fromUtf8(" 秒"), this);
+    load_time_spin_ = CreateSpin(0, 3600, 1, QString::fromUtf8(" 秒"), this);
+    unload_time_spin_ = CreateSpin(0, 3600, 1, QString::fromUtf8(" 秒"), this);
+    kerf_spin_ = CreateSpin(0, 100, 2, QString(), this);
+    kerf_spin_->setToolTip(QString::fromUtf8("只用于估计锯路损耗面积; 锯切长度与时间不随锯缝宽度变化"));
+    form_layout->addRow(QString::fromUtf8("进给速度:"), cut_speed_spin_);
+    form_layout->addRow(QString::fromUtf8("空行程速度:"), rapid_speed_spin_);
+    form_layout->addRow(QString::fromUtf8("每道落锯/抬锯:"), pass_overhead_spin_);
+    form_layout->addRow(QString::fromUtf8("母板旋转:"), rotation_time_spin_);
+    form_layout->addRow(QString::fromUtf8("上料与对齐:"), load_time_spin_);
+    form_layout->addRow(QString::fromUtf8("下料与分拣:"), unload_time_spin_);
+    form_layout->addRow(QString::fromUtf8("锯缝宽度:"), kerf_spin_);
+    main_layout->addLayout(form_layout);
+
+    auto* note_label = new QLabel(QString::fromUtf8("长度单位与解文件相同; 参数保存后用于切割顺序、机器时间与多解对比"), this);
+    note_label->setWordWrap(true);
+    main_layout->addWidget(note_label);
+
+    auto* button_layout = new QHBoxLayout();
+    auto* defaults_button = new QPushButton(QString::fromUtf8("恢复默认"), this);
+    connect(defaults_button, &QPushButton::clicked, this, &MachineParamsDialog::RestoreDefaults);
+    auto* ok_button = new QPushButton(QString::fromUtf8("确定"), this);
+    ok_button->setDefault(true);
+    connect(ok_button, &QPushButton::clicked, this, &QDialog::accept);
+    auto* cancel_button = new QPushButton(QString::fromUtf8("取消"), this);
+    connect(cancel_button, &QPushButton::clicked, this, &QDialog::reject);
+    button_layout->addWidget(defaults_button);
+    button_layout->addStretch();
+    button_layout->addWidget(ok_button);
+    button_layout->addWidget(cancel_button);
+    main_layout->addLayout(button_layout);
+}
+
+void MachineParamsDialog::SetParameters(const MachineParameters& params) {
+    cut_speed_spin_->setValue(params.saw.cut_speed);
+    rapid_speed_spin_->setValue(params.saw.rapid_speed);
+    pass_overhead_spin_->setValue(params.saw.pass_overhead);
+    rotation_time_spin_->setValue(params.saw.rotation_time);
+    load_time_spin_->setValue(params.load_time);
+    unload_time_spin_->setValue(params.unload_time);
+    kerf_spin_->setValue(params.kerf);
+}
+
+MachineParameters MachineParamsDialog::GetParameters() const {
+    MachineParameters params;
+    params.saw.cut_speed = cut_speed_spin_->value();
+    params.saw.rapid_speed = rapid_speed_spin_->value();
+    params.saw.pass_overhead = pass_overhead_spin_->value();
+    params.saw.rotation_time = rotation_time_spin_->value();
+    params.load_time = load_time_spin_->value();
+    params.unload_time = unload_time_spin_->value();
+    params.kerf = kerf_spin_->value();
+    return params;
+}
+
+void MachineParamsDialog::RestoreDefaults() {
+    SetParameters(MachineParameters());
+}
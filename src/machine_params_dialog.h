@@ -0,0 +1,48 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// machine_params_dialog.h - 机器参数对话框
+// 编辑锯切速度、落锯/旋转与上下料时间及锯缝宽度; 参数以 QSettings 保存, 切割视图与多解对比共用
+
+#ifndef MACHINE_PARAMS_DIALOG_H_
+#define MACHINE_PARAMS_DIALOG_H_
+
+#include <QDialog>
+#include "machine_simulator.h"
+
+class QDoubleSpinBox;
+
+// 读取已保存的机器参数 (未保存的项取默认值) / 保存机器参数
+MachineParameters LoadMachineParameters();
+void SaveMachineParameters(const MachineParameters& params);
+
+class MachineParamsDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    explicit MachineParamsDialog(const MachineParameters& params, QWidget* parent = nullptr);
+
+    MachineParameters GetParameters() const;
+
+private slots:
+    void RestoreDefaults();
+
+private:
+    void SetupUi();
+    void SetParameters(const MachineParameters& params);
+
+    QDoubleSpinBox* cut_speed_spin_;
+    QDoubleSpinBox* rapid_speed_spin_;
+    QDoubleSpinBox* pass_overhead_spin_;
+    QDoubleSpinBox* rotation_time_spin_;
+    QDoubleSpinBox* load_time_spin_;
+    QDoubleSpinBox* unload_time_spin_;
+    QDoubleSpinBox* kerf_spin_;
+};
+
+#endif  // MACHINE_PARAMS_DIALOG_H_
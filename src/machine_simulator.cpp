@@ -0,0 +1,129 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// machine_simulator.cpp - 机器时间模拟实现
+
+#include "machine_simulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double kEpsilon = 1e-9;
+
+}  // namespace
+
+MachineWorkload BuildMachineWorkload(const std::vector<StockData>& stocks,
+                                     const std::vector<SawSequence>& sequences) {
+    MachineWorkload workload;
+    const size_t n = std::min(stocks.size(), sequences.size());
+    workload.cut_length.resize(n);
+    workload.travel_length.resize(n);
+    workload.passes.resize(n);
+    workload.rotations.resize(n);
+    workload.multiplicity.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        workload.cut_length[i] = sequences[i].cut_length;
+        workload.travel_length[i] = sequences[i].travel_length;
+        workload.passes[i] = static_cast<double>(sequences[i].passes.size());
+        workload.rotations[i] = sequences[i].rotations;
+        workload.multiplicity[i] = stocks[i].multiplicity;
+    }
+    return workload;
+}
+
+MachineTimeReport SimulateMachineTime(const MachineWorkload& workload, const MachineParameters& params) {
+    MachineTimeReport report;
+    const size_t n = workload.size();
+    const double inv_feed = 1.0 / std::max(kEpsilon, params.saw.cut_speed);
+    const double inv_rapid = 1.0 / std::max(kEpsilon, params.saw.rapid_speed);
+    const double pass_overhead = params.saw.pass_overhead;
+    const double rotation_time = params.saw.rotation_time;
+    const double handling = params.load_time + params.unload_time;
+
+    const double* cut = workload.cut_length.data();
+    const double* travel = workload.travel_length.data();
+    const double* passes = workload.passes.data();
+    const double* rotations = workload.rotations.data();
+    const double* multiplicity = workload.multiplicity.data();
+    report.cycle_time.resize(n);
+    double* cycle = report.cycle_time.data();
+
+    // 逐元素计时与加权求和, 循环体无分支
+    double cut_sum = 0, travel_sum = 0, overhead_sum = 0, sheets = 0, cut_length_sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        double cut_time = cut[i] * inv_feed;
+        double travel_time = travel[i] * inv_rapid;
+        double overhead = passes[i] * pass_overhead + rotations[i] * rotation_time;
+        cycle[i] = handling + cut_time + travel_time + overhead;
+        cut_sum += cut_time * multiplicity[i];
+        travel_sum += travel_time * multiplicity[i];
+        overhead_sum += overhead * multiplicity[i];
+        cut_length_sum += cut[i] * multiplicity[i];
+        sheets += multiplicity[i];
+    }
+
+    report.cut_time = cut_sum;
+    report.travel_time = travel_sum;
+    report.overhead_time = overhead_sum;
+    report.handling_time = handling * sheets;
+    report.total_time = cut_sum + travel_sum + overhead_sum + report.handling_time;
+    report.kerf_area = cut_length_sum * params.kerf;
+    report.sheet_count = std::llround(sheets);
+    return report;
+}
+
+MachineTimeReport SimulateSolutionMachineTime(const CuttingSolution& solution, const MachineParameters& params) {
+    std::vector<SawSequence> sequences;
+    sequences.reserve(solution.stocks.size());
+    for (const StockData& stock : solution.stocks) {
+        sequences.push_back(OptimizeSawSequence(stock, solution.stock_length, params.saw));
+    }
+    return SimulateMachineTime(BuildMachineWorkload(solution.stocks, sequences), params);
+}
+
+MachineTimeline BuildMachineTimeline(const SawSequence& sequence, const MachineParameters& params) {
+    MachineTimeline timeline;
+    timeline.steps.reserve(sequence.passes.size());
+    const double inv_feed = 1.0 / std::max(kEpsilon, params.saw.cut_speed);
+    const double inv_rapid = 1.0 / std::max(kEpsilon, params.saw.rapid_speed);
+
+    // 与 SawSequence 的计时规则相同: 每个阶段从原点出发, 两轴同时移动
+    double t = params.load_time;
+    timeline.load_end = t;
+    int stage = 0;
+    double x = 0, y = 0;
+    for (const SawPass& pass : sequence.passes) {
+        bool stage_start = pass.stage != stage;
+        if (stage_start) {
+            if (stage != 0) t += params.saw.rotation_time;
+            stage = pass.stage;
+            x = 0;
+            y = 0;
+        }
+        double start_x = pass.stage == 1 ? pass.from : pass.coord;
+        double start_y = pass.stage == 1 ? pass.coord : pass.from;
+        double travel = std::max(std::abs(start_x - x), std::abs(start_y - y));
+
+        MachineStep step;
+        step.start = t;
+        step.travel_end = t + travel * inv_rapid;
+        step.cut_start = step.travel_end + params.saw.pass_overhead;
+        step.end = step.cut_start + std::abs(pass.to - pass.from) * inv_feed;
+        step.stage_start = stage_start;
+        timeline.steps.push_back(step);
+
+        t = step.end;
+        x = pass.stage == 1 ? pass.to : pass.coord;
+        y = pass.stage == 1 ? pass.coord : pass.to;
+    }
+    timeline.unload_start = t;
+    timeline.total = t + params.unload_time;
+    return timeline;
+}
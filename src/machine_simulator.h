@@ -0,0 +1,87 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// machine_simulator.h - 机器时间模拟
+// 每张母板的周期 = 上料 + 锯切 (空行程 + 落锯/抬锯 + 进给 + 旋转) + 下料, 锯切部分按锯切顺序 (saw_sequencer) 计算
+//
+// 工作量 (进给长度、空行程距离、道数、旋转次数) 只取决于切割几何与锯切顺序, 以列式数组保存一次;
+// 机器参数变化时只需对全部切割方式做一次逐元素计时 (可向量化), 不必重新优化锯切顺序
+// 时间线 (MachineTimeline) 给出单块母板每道切割的起止时刻, 供动画回放使用
+
+#ifndef MACHINE_SIMULATOR_H_
+#define MACHINE_SIMULATOR_H_
+
+#include <vector>
+#include "cutting_data.h"
+#include "saw_sequencer.h"
+
+// 机器参数 (长度单位与解文件相同, 时间单位为秒)
+struct MachineParameters {
+    SawMachineModel saw;            // 进给/空行程速度, 每道落锯/抬锯 (定位) 时间, 旋转时间
+    double load_time = 30.0;        // 每张母板上料与对齐
+    double unload_time = 20.0;      // 每张母板下料与分拣
+    double kerf = 4.0;              // 锯缝宽度: 只用于锯路损耗面积, 进给长度按切割线计, 计时与锯缝无关
+};
+
+// 全部切割方式的工作量 (列式, 下标与 stocks 相同)
+struct MachineWorkload {
+    std::vector<double> cut_length;
+    std::vector<double> travel_length;
+    std::vector<double> passes;
+    std::vector<double> rotations;
+    std::vector<double> multiplicity;
+
+    size_t size() const { return cut_length.size(); }
+};
+
+// 模拟结果: 每个切割方式一张母板的周期, 以及全部母板 (乘以重复次数) 的合计
+struct MachineTimeReport {
+    std::vector<double> cycle_time;
+    double cut_time = 0;            // 进给
+    double travel_time = 0;         // 空行程
+    double overhead_time = 0;       // 落锯/抬锯与旋转
+    double handling_time = 0;       // 上料与下料
+    double total_time = 0;
+    double kerf_area = 0;           // 锯路损耗面积
+    long long sheet_count = 0;
+
+    double Hours() const { return total_time / 3600.0; }
+};
+
+// 单道切割的时刻: [start, travel_end) 空行程, [travel_end, cut_start) 落锯, [cut_start, end) 进给
+struct MachineStep {
+    double start;
+    double travel_end;
+    double cut_start;
+    double end;
+    bool stage_start;               // 本阶段第一道 (空行程从原点出发)
+};
+
+// 单块母板的时间线: [0, load_end) 上料, 阶段之间旋转, [unload_start, total) 下料
+struct MachineTimeline {
+    std::vector<MachineStep> steps;  // 与 SawSequence::passes 一一对应
+    double load_end = 0;
+    double unload_start = 0;
+    double total = 0;
+};
+
+// 由锯切顺序收集工作量 (sequences 与 stocks 一一对应)
+MachineWorkload BuildMachineWorkload(const std::vector<StockData>& stocks,
+                                     const std::vector<SawSequence>& sequences);
+
+// 按机器参数计时 (逐元素, 线程安全)
+MachineTimeReport SimulateMachineTime(const MachineWorkload& workload, const MachineParameters& params);
+
+// 整个方案的机器时间: 逐个切割方式优化锯切顺序后计时
+// (顺序执行, 供已按文件在线程池中并行的调用方使用, 如多解对比)
+MachineTimeReport SimulateSolutionMachineTime(const CuttingSolution& solution, const MachineParameters& params);
+
+// 单块母板的逐道时间线
+MachineTimeline BuildMachineTimeline(const SawSequence& sequence, const MachineParameters& params);
+
+#endif  // MACHINE_SIMULATOR_H_
@@ -12,10 +12,285 @@
 // 基于 CS-2D-BP-Arc 分支定价算法
 
 #include <QApplication>
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QStringList>
 #include <QStyleFactory>
+#include <QTextStream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
 #include "main_window.h"
+#include "analysis_export.h"
+#include "stock_export.h"
+#include "tiled_export.h"
+#include "book_planner.h"
+#include "solution_validator.h"
+#include "remnant_extractor.h"
+#include "remnant_inventory.h"
+
+#ifdef Q_OS_WIN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace {
+
+// 无界面命令的参数: 命令之后的位置参数与 "--名称 值" 选项
+struct HeadlessArgs {
+    QStringList positional;
+    std::map<std::string, QString> options;
+
+    int Int(const char* name, int fallback) const {
+        auto it = options.find(name);
+        return it == options.end() ? fallback : it->second.toInt();
+    }
+    QString String(const char* name, const QString& fallback) const {
+        auto it = options.find(name);
+        return it == options.end() ? fallback : it->second;
+    }
+};
+
+// 无界面命令的运行环境 (命令需要解文件时 solution 已由 positional[0] 加载)
+struct HeadlessContext {
+    HeadlessArgs args;
+    CuttingSolution solution;
+    QTextStream& out;
+    QTextStream& err;
+};
+
+// 无界面命令: 名称、用法与必需的位置参数个数; 绘制文字的命令需要 QGuiApplication (字体)
+struct HeadlessCommand {
+    const char* name;
+    const char* usage;
+    int positional_count;
+    bool needs_gui;
+    bool loads_solution;
+    int (*run)(HeadlessContext& context);
+};
+
+HeadlessArgs ParseHeadlessArgs(int argc, char* argv[], int begin) {
+    HeadlessArgs args;
+    for (int i = begin; i < argc; i++) {
+        if (std::strncmp(argv[i], "--", 2) == 0 && i + 1 < argc) {
+            args.options[argv[i] + 2] = QString::fromLocal8Bit(argv[i + 1]);
+            i++;
+        } else {
+            args.positional << QString::fromLocal8Bit(argv[i]);
+        }
+    }
+    return args;
+}
+
+// 进度输出到 stderr (同一行刷新)
+StockExportProgress PrintProgress(QTextStream& err) {
+    return [&err](int done, int total) {
+        err << "\r" << done << " / " << total << Qt::flush;
+        return true;
+    };
+}
+
+// CS-2D-GUI --export-analysis <解文件.json> <输出.cs2a|输出.csv>
+int RunExportAnalysis(HeadlessContext& context) {
+    const QString& output_path = context.args.positional[1];
+    AnalysisExportData data;
+    QString error;
+    if (!LoadAnalysisExportData(context.args.positional[0], &data, &error)) {
+        context.err << error << "\n";
+        return 1;
+    }
+
+    AnalysisExportResult result = ExportAnalysisData(
+        data, output_path, AnalysisExportFormatFromPath(output_path));
+    if (!result.success) {
+        context.err << result.error << "\n";
+        return 1;
+    }
+    for (const QString& file : result.files) {
+        context.out << file << "\n";
+    }
+    context.out << result.bytes << " bytes, " << result.elapsed_ms << " ms\n";
+    return 0;
+}
+
+// 批量导出切割方案: CS-2D-GUI --export-stocks <解文件.json> <输出.png|.pdf|.svg|.dxf|.nc> [--dpi N]
+int RunExportStocks(HeadlessContext& context) {
+    const QString& output_path = context.args.positional[1];
+    StockExportOptions options;
+    options.format = StockExportFormatFromPath(output_path);
+    options.dpi = std::max(36, context.args.Int("dpi", options.dpi));
+
+    StockExportResult result = ExportStocks(context.solution, output_path, options,
+                                            PrintProgress(context.err));
+    context.err << "\n";
+    if (!result.success) {
+        context.err << result.error << "\n";
+        return 1;
+    }
+    for (const QString& file : result.files) {
+        context.out << file << "\n";
+    }
+    context.out << result.bytes << " bytes, " << result.elapsed_ms << " ms\n";
+    return 0;
+}
+
+// 大幅面导出: CS-2D-GUI --export-tiled <解文件.json> <输出.tif|输出.png> [--stock N] [--width PX] [--tile PX] [--dpi N]
+int RunExportTiled(HeadlessContext& context) {
+    const CuttingSolution& solution = context.solution;
+    TiledExportOptions options;
+    options.width = std::max(100, context.args.Int("width", options.width));
+    options.tile_size = context.args.Int("tile", options.tile_size);
+    options.dpi = std::max(36, context.args.Int("dpi", options.dpi));
+    int stock_index = std::max(1, context.args.Int("stock", 1)) - 1;
+    if (stock_index >= static_cast<int>(solution.stocks.size())) {
+        context.err << "stock " << stock_index + 1 << " out of range ("
+                    << solution.stocks.size() << " patterns)\n";
+        return 1;
+    }
+
+    StockExportResult result = ExportStockTiled(solution.stocks[stock_index], solution.stock_width,
+                                                solution.stock_length, context.args.positional[1], options,
+                                                PrintProgress(context.err));
+    context.err << "\n";
+    if (!result.success) {
+        context.err << result.error << "\n";
+        return 1;
+    }
+
+    QSize size = TiledExportCanvasSize(solution.stock_width, solution.stock_length, options);
+    context.out << result.files.size() << " files, " << size.width() << " x " << size.height() << " px, "
+                << result.bytes << " bytes, " << result.elapsed_ms << " ms\n";
+    return 0;
+}
+
+// 校验: CS-2D-GUI --validate <解文件.json>, 有错误时返回 1
+int RunValidate(HeadlessContext& context) {
+    ValidationReport report = ValidateSolution(context.solution);
+    for (const Violation& v : report.violations) {
+        context.out << (v.error ? "error: " : "warning: ")
+                    << DescribeViolation(v, context.solution.stocks) << "\n";
+    }
+    context.out << report.item_count << " items, " << report.error_count << " errors, "
+                << report.warning_count << " warnings, " << report.elapsed_us / 1000.0 << " ms\n";
+    return report.ok() ? 0 : 1;
+}
+
+// 叠切计划: CS-2D-GUI --plan-books <解文件.json> <输出.csv> [--max-sheets N]
+int RunPlanBooks(HeadlessContext& context) {
+    BookPlanOptions options;
+    options.max_sheets = std::max(1, context.args.Int("max-sheets", options.max_sheets));
+
+    BookPlan plan = PlanBooks(context.solution, options);
+    QString error;
+    if (!ExportBookPlanCsv(plan, context.args.positional[1], &error)) {
+        context.err << error << "\n";
+        return 1;
+    }
+    context.out << plan.sheet_count << " sheets, " << plan.books.size() << " books, "
+                << plan.total_passes << " passes (single sheet " << plan.single_sheet_passes << "), "
+                << FormatSawTime(plan.total_time) << " (single sheet "
+                << FormatSawTime(plan.single_sheet_time) << ")\n";
+    return 0;
+}
+
+// 余料入库: CS-2D-GUI --extract-remnants <解文件.json> [--inventory 库存.json] [--min-width N] [--min-length N]
+int RunExtractRemnants(HeadlessContext& context) {
+    const CuttingSolution& solution = context.solution;
+    QString inventory_path = context.args.String("inventory", DefaultRemnantInventoryPath());
+    RemnantOptions options = DefaultRemnantOptions(solution.stock_width, solution.stock_length);
+    options.min_width = std::max(1, context.args.Int("min-width", options.min_width));
+    options.min_length = std::max(1, context.args.Int("min-length", options.min_length));
+
+    RemnantReport report = ExtractRemnants(solution, options);
+    RemnantInventory inventory;
+    QString error;
+    if (!LoadRemnantInventory(inventory_path, &inventory, &error)) {
+        context.err << error << "\n";
+        return 1;
+    }
+    int added = AddRemnantsToInventory(inventory, report, solution.stocks, context.args.positional[0]);
+    if (!SaveRemnantInventory(inventory, inventory_path, &error)) {
+        context.err << error << "\n";
+        return 1;
+    }
+    context.out << added << " remnants, area " << static_cast<qint64>(report.remnant_area) << ", "
+                << report.elapsed_ms << " ms; inventory " << inventory.TotalQuantity()
+                << " remnants (" << inventory_path << ")\n";
+    return 0;
+}
+
+const HeadlessCommand kHeadlessCommands[] = {
+    {"--export-analysis", "<solution.json> <output.cs2a|output.csv>", 2, false, false, &RunExportAnalysis},
+    {"--export-stocks", "<solution.json> <output.png|output.pdf|output.svg|output.dxf|output.nc> [--dpi N]",
+     2, true, true, &RunExportStocks},
+    {"--export-tiled", "<solution.json> <output.tif|output.png> [--stock N] [--width PX] [--tile PX] [--dpi N]",
+     2, true, true, &RunExportTiled},
+    {"--validate", "<solution.json>", 1, false, true, &RunValidate},
+    {"--plan-books", "<solution.json> <output.csv> [--max-sheets N]", 2, false, true, &RunPlanBooks},
+    {"--extract-remnants", "<solution.json> [--inventory inventory.json] [--min-width N] [--min-length N]",
+     1, false, true, &RunExtractRemnants},
+};
+
+// 程序为 Windows 图形子系统, 没有控制台: 从命令行启动且输出未重定向时附加到父进程的控制台
+void AttachParentConsole() {
+#ifdef Q_OS_WIN
+    if (!AttachConsole(ATTACH_PARENT_PROCESS)) return;
+    if (GetFileType(GetStdHandle(STD_OUTPUT_HANDLE)) == FILE_TYPE_UNKNOWN) {
+        std::freopen("CONOUT$", "w", stdout);
+    }
+    if (GetFileType(GetStdHandle(STD_ERROR_HANDLE)) == FILE_TYPE_UNKNOWN) {
+        std::freopen("CONOUT$", "w", stderr);
+    }
+#endif
+}
+
+// 解析参数、按需加载解文件后运行命令; 参数不足时输出用法并返回 2
+int RunHeadless(int argc, char* argv[], int index, const HeadlessCommand& command) {
+    AttachParentConsole();
+    std::unique_ptr<QCoreApplication> app;
+    if (command.needs_gui) {
+        // 无显示环境时使用 offscreen 平台
+        if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+            qputenv("QT_QPA_PLATFORM", "offscreen");
+        }
+        app = std::make_unique<QGuiApplication>(argc, argv);
+    } else {
+        app = std::make_unique<QCoreApplication>(argc, argv);
+    }
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    HeadlessContext context{ParseHeadlessArgs(argc, argv, index + 1), CuttingSolution(), out, err};
+    if (context.args.positional.size() < command.positional_count) {
+        err << "usage: CS-2D-GUI " << command.name << " " << command.usage << "\n";
+        return 2;
+    }
+    if (command.loads_solution) {
+        QString error;
+        if (!LoadCuttingSolution(context.args.positional[0], &context.solution, &error)) {
+            err << error << "\n";
+            return 1;
+        }
+    }
+    return command.run(context);
+}
+
+}  // namespace
 
 int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        for (const HeadlessCommand& command : kHeadlessCommands) {
+            if (std::strcmp(argv[i], command.name) == 0) {
+                return RunHeadless(argc, argv, i, command);
+            }
+        }
+    }
+
     QApplication app(argc, argv);
 
     // 应用元数据
@@ -19,6 +19,8 @@
 #include "generator_widget.h"
 #include "generator_worker.h"
 #include "difficulty_mapper.h"
+#include "remnant_inventory.h"
+#include "machine_params_dialog.h"
 
 #include <QMenuBar>
 #include <QMenu>
@@ -42,7 +44,8 @@ MainWindow::MainWindow(QWidget* parent)
     , solver_worker_(nullptr)
     , generator_thread_(nullptr)
     , generator_worker_(nullptr)
-    , is_running_(false) {
+    , is_running_(false)
+    , solver_load_(false) {
     SetupUi();
     SetupMenuBar();
     SetupConnections();
@@ -220,6 +223,11 @@ QWidget* MainWindow::CreateCuttingTab() {
     solution_path_edit_->setPlaceholderText(QString::fromUtf8("选择 JSON 解文件..."));
     control_layout->addWidget(solution_path_edit_, 1);
 
+    store_remnants_button_ = new QPushButton(QString::fromUtf8("余料入库"), tab);
+    store_remnants_button_->setEnabled(false);
+    store_remnants_button_->setToolTip(QString::fromUtf8("将当前方案的可复用余料加入余料库存 (生成 Tab 可选用其尺寸作为母板)"));
+    control_layout->addWidget(store_remnants_button_);
+
     layout->addLayout(control_layout);
 
     // ========== Bottom Visualization ==========
@@ -242,6 +250,10 @@ void MainWindow::SetupMenuBar() {
     connect(open_action, &QAction::triggered, this, &MainWindow::OnBrowseFile);
     file_menu->addAction(open_action);
 
+    auto* machine_action = new QAction(QString::fromUtf8("机器参数(&M)..."), this);
+    connect(machine_action, &QAction::triggered, this, &MainWindow::OnMachineParameters);
+    file_menu->addAction(machine_action);
+
     file_menu->addSeparator();
 
     auto* exit_action = new QAction(QString::fromUtf8("退出(&X)"), this);
@@ -271,6 +283,9 @@ void MainWindow::SetupConnections() {
 
     // Cutting view tab connections
     connect(load_solution_button_, &QPushButton::clicked, this, &MainWindow::OnLoadSolution);
+    connect(store_remnants_button_, &QPushButton::clicked, this, &MainWindow::OnStoreRemnants);
+    connect(cutting_view_widget_, &CuttingViewWidget::SolutionLoaded, this, &MainWindow::OnSolutionLoaded);
+    connect(cutting_view_widget_, &CuttingViewWidget::RemnantsStored, this, &MainWindow::OnRemnantsStored);
 
     // Setup solver worker thread
     solver_thread_ = new QThread(this);
@@ -432,6 +447,8 @@ void MainWindow::OnSolutionReady(const QString& jsonPath) {
     export_json_button_->setEnabled(true);
 
     // Auto-load solution to cutting view
+    store_remnants_button_->setEnabled(false);
+    solver_load_ = true;
     cutting_view_widget_->LoadSolution(jsonPath);
     solution_path_edit_->setText(jsonPath);
 }
@@ -500,9 +517,12 @@ void MainWindow::OnLoadSolution() {
         QString::fromUtf8("所有文件 (*);;JSON 文件 (*.json)"));
 
     if (!path.isEmpty()) {
+        // 后台逐批加载, 完成或失败时由 OnSolutionLoaded 报告
+        store_remnants_button_->setEnabled(false);
+        solver_load_ = false;
         if (cutting_view_widget_->LoadSolution(path)) {
             solution_path_edit_->setText(path);
-            statusBar()->showMessage(QString::fromUtf8("方案已加载"));
+            statusBar()->showMessage(QString::fromUtf8("正在加载方案..."));
         } else {
             QMessageBox::warning(this, QString::fromUtf8("加载错误"),
                 QString::fromUtf8("无法加载切割方案文件"));
@@ -510,3 +530,42 @@ void MainWindow::OnLoadSolution() {
     }
 }
 
+void MainWindow::OnSolutionLoaded(bool ok, const QString& message) {
+    // 重新加载失败时仍显示原方案
+    store_remnants_button_->setEnabled(ok || cutting_view_widget_->GetStockCount() > 0);
+    if (ok) {
+        statusBar()->showMessage(message);
+    } else if (solver_load_) {
+        // 求解完成后的自动加载 (解文件可能仍在写入, 下次求解结果会再次加载) 不弹出对话框
+        statusBar()->showMessage(QString::fromUtf8("自动加载切割方案失败: ") + message);
+    } else {
+        QMessageBox::warning(this, QString::fromUtf8("加载错误"),
+            QString::fromUtf8("无法加载切割方案文件\n") + message);
+    }
+}
+
+void MainWindow::OnMachineParameters() {
+    MachineParamsDialog dialog(cutting_view_widget_->GetMachineParameters(), this);
+    if (dialog.exec() != QDialog::Accepted) return;
+
+    // 切割视图立即按新参数重新计算; 多解对比在之后添加文件时读取保存的参数
+    MachineParameters params = dialog.GetParameters();
+    SaveMachineParameters(params);
+    cutting_view_widget_->SetMachineParameters(params);
+    statusBar()->showMessage(QString::fromUtf8("机器参数已保存"));
+}
+
+void MainWindow::OnStoreRemnants() {
+    statusBar()->showMessage(QString::fromUtf8("正在提取余料..."));
+    cutting_view_widget_->StoreRemnants(DefaultRemnantInventoryPath());
+}
+
+void MainWindow::OnRemnantsStored(bool ok, const QString& message) {
+    if (ok) {
+        statusBar()->showMessage(message);
+    } else {
+        statusBar()->clearMessage();
+        QMessageBox::warning(this, QString::fromUtf8("余料入库"), message);
+    }
+}
+
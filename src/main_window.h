@@ -53,6 +53,10 @@ private slots:
 
     // Cutting view tab
     void OnLoadSolution();
+    void OnSolutionLoaded(bool ok, const QString& message);
+    void OnStoreRemnants();
+    void OnRemnantsStored(bool ok, const QString& message);
+    void OnMachineParameters();
 
     // Solver worker signals
     void OnDataLoaded(int numItemTypes, int stockWidth, int stockLength, int totalDemand);
@@ -111,6 +115,7 @@ private:
     // ========== Cutting View Tab ==========
     QPushButton* load_solution_button_;
     QLineEdit* solution_path_edit_;
+    QPushButton* store_remnants_button_;
     CuttingViewWidget* cutting_view_widget_;
 
     // ========== Analysis Tab ==========
@@ -124,6 +129,7 @@ private:
 
     // ========== State ==========
     bool is_running_;
+    bool solver_load_;              // 最近一次加载由求解完成触发 (失败时只在状态栏提示)
     QString current_file_path_;
     QString current_json_path_;
 };
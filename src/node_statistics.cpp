@@ -0,0 +1,195 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// node_statistics.cpp - 分支定价树节点聚合统计实现
+
+#include "node_statistics.h"
+
+#include <QtConcurrent>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// 每块节点数 (块内串行扫描, 块间并行)
+constexpr size_t kChunkSize = 16384;
+
+struct ChunkRange {
+    size_t begin;
+    size_t end;
+};
+
+NodeStatistics ComputeChunk(const NodeColumns& columns, const NodeFilter& filter,
+                            const ChunkRange& range) {
+    NodeStatistics stats;
+
+    for (size_t i = range.begin; i < range.end; i++) {
+        NodeStatusCode status = columns.status[i];
+        BranchTypeCode branch = columns.branch_type[i];
+        if (!filter.Matches(status, branch)) continue;
+
+        stats.node_count++;
+        stats.outcome_counts[static_cast<int>(branch)][static_cast<int>(status)]++;
+
+        int depth = std::max(0, columns.depth[i]);
+        if (static_cast<size_t>(depth) >= stats.per_depth.size()) {
+            stats.per_depth.resize(static_cast<size_t>(depth) + 1);
+        }
+        DepthStats& d = stats.per_depth[depth];
+        d.count++;
+        d.y_cols_sum += columns.y_cols[i];
+        d.x_cols_sum += columns.x_cols[i];
+
+        double lb = columns.lower_bound[i];
+        if (lb >= 0) {
+            d.lb_count++;
+            d.lb_sum += lb;
+            d.lb_min = std::min(d.lb_min, lb);
+            d.lb_max = std::max(d.lb_max, lb);
+        }
+
+        stats.cg_iteration_counts.Add(columns.cg_iterations[i]);
+        stats.y_cols_counts.Add(columns.y_cols[i]);
+        stats.x_cols_counts.Add(columns.x_cols[i]);
+        stats.cg_iteration_sum += std::max(0, columns.cg_iterations[i]);
+    }
+
+    return stats;
+}
+
+void MergeStatistics(NodeStatistics& result, const NodeStatistics& partial) {
+    result.node_count += partial.node_count;
+    result.cg_iteration_sum += partial.cg_iteration_sum;
+
+    if (partial.per_depth.size() > result.per_depth.size()) {
+        result.per_depth.resize(partial.per_depth.size());
+    }
+    for (size_t i = 0; i < partial.per_depth.size(); i++) {
+        DepthStats& into = result.per_depth[i];
+        const DepthStats& from = partial.per_depth[i];
+        into.count += from.count;
+        into.lb_count += from.lb_count;
+        into.lb_sum += from.lb_sum;
+        into.lb_min = std::min(into.lb_min, from.lb_min);
+        into.lb_max = std::max(into.lb_max, from.lb_max);
+        into.y_cols_sum += from.y_cols_sum;
+        into.x_cols_sum += from.x_cols_sum;
+    }
+
+    result.cg_iteration_counts.Merge(partial.cg_iteration_counts);
+    result.y_cols_counts.Merge(partial.y_cols_counts);
+    result.x_cols_counts.Merge(partial.x_cols_counts);
+
+    for (int b = 0; b < kBranchTypeCodeCount; b++) {
+        for (int s = 0; s < kNodeStatusCodeCount; s++) {
+            result.outcome_counts[b][s] += partial.outcome_counts[b][s];
+        }
+    }
+}
+
+}  // namespace
+
+int CountHistogram::BucketIndex(int value) {
+    if (value < kExactLimit) return std::max(0, value);
+    // 最高位 e (6~30), 其后 5 位为桶内序号
+    int e = 0;
+    for (unsigned v = static_cast<unsigned>(value); v > 1; v >>= 1) e++;
+    int sub = (value >> (e - 5)) - kSubBuckets;
+    return kExactLimit + (e - 6) * kSubBuckets + sub;
+}
+
+int CountHistogram::BucketLowerBound(int bucket) {
+    if (bucket < kExactLimit) return bucket;
+    int e = 6 + (bucket - kExactLimit) / kSubBuckets;
+    int sub = (bucket - kExactLimit) % kSubBuckets;
+    return (kSubBuckets + sub) << (e - 5);
+}
+
+void CountHistogram::Add(int value) {
+    value = std::max(0, value);
+    counts_[BucketIndex(value)]++;
+    total_++;
+    max_value_ = std::max(max_value_, value);
+}
+
+void CountHistogram::Merge(const CountHistogram& other) {
+    for (int b = 0; b < kBucketCount; b++) {
+        counts_[b] += other.counts_[b];
+    }
+    total_ += other.total_;
+    max_value_ = std::max(max_value_, other.max_value_);
+}
+
+int CountHistogram::Quantile(double q) const {
+    if (total_ <= 0) return 0;
+
+    long long rank = static_cast<long long>(std::ceil(q * total_));
+    rank = std::clamp(rank, 1LL, static_cast<long long>(total_));
+
+    long long cumulative = 0;
+    for (int b = 0; b < kBucketCount; b++) {
+        cumulative += counts_[b];
+        if (cumulative >= rank) return BucketLowerBound(b);
+    }
+    return max_value_;
+}
+
+NodeColumns BuildNodeColumns(const std::vector<NodeData>& nodes) {
+    NodeColumns columns;
+    size_t n = nodes.size();
+    columns.id.resize(n);
+    columns.parent_id.resize(n);
+    columns.depth.resize(n);
+    columns.lower_bound.resize(n);
+    columns.cg_iterations.resize(n);
+    columns.y_cols.resize(n);
+    columns.x_cols.resize(n);
+    columns.status.resize(n);
+    columns.branch_type.resize(n);
+    columns.branch_dir.resize(n);
+    columns.is_integer.resize(n);
+
+    for (size_t i = 0; i < n; i++) {
+        const NodeData& node = nodes[i];
+        columns.id[i] = node.id;
+        columns.parent_id[i] = node.parent_id;
+        columns.depth[i] = node.depth;
+        columns.lower_bound[i] = node.lower_bound;
+        columns.cg_iterations[i] = node.cg_iterations;
+        columns.y_cols[i] = node.final_y_cols;
+        columns.x_cols[i] = node.final_x_cols;
+        columns.status[i] = ParseNodeStatus(node.status);
+        columns.branch_type[i] = ParseBranchType(node.branch_type);
+        columns.branch_dir[i] = node.branch_dir == "left" ? 1 : (node.branch_dir == "right" ? 2 : 0);
+        columns.is_integer[i] = node.is_integer ? 1 : 0;
+    }
+
+    return columns;
+}
+
+NodeStatistics ComputeNodeStatistics(const NodeColumns& columns, const NodeFilter& filter) {
+    size_t n = columns.size();
+    if (n <= kChunkSize) {
+        return ComputeChunk(columns, filter, {0, n});
+    }
+
+    std::vector<ChunkRange> chunks;
+    chunks.reserve(n / kChunkSize + 1);
+    for (size_t begin = 0; begin < n; begin += kChunkSize) {
+        chunks.push_back({begin, std::min(n, begin + kChunkSize)});
+    }
+
+    // 各块独立统计, 合并顺序无关 (计数与最值均满足交换律)
+    return QtConcurrent::blockingMappedReduced<NodeStatistics>(
+        chunks,
+        [&columns, filter](const ChunkRange& range) {
+            return ComputeChunk(columns, filter, range);
+        },
+        &MergeStatistics,
+        QtConcurrent::UnorderedReduce);
+}
@@ -0,0 +1,114 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// node_statistics.h - 分支定价树节点聚合统计
+// 节点加载时转为列存储, 统计时按块并行扫描 (每块独立的局部直方图), 再合并结果;
+// 整数量 (CG迭代、列数) 用固定桶数的计数直方图保存, 内存与合并代价与取值大小、节点数均无关
+
+#ifndef NODE_STATISTICS_H_
+#define NODE_STATISTICS_H_
+
+#include <array>
+#include <limits>
+#include <vector>
+#include "analysis_data.h"
+
+// 节点列存储 (加载时构建一次, 过滤、统计与导出只读)
+struct NodeColumns {
+    std::vector<int> id;
+    std::vector<int> parent_id;
+    std::vector<int> depth;
+    std::vector<double> lower_bound;
+    std::vector<int> cg_iterations;
+    std::vector<int> y_cols;
+    std::vector<int> x_cols;
+    std::vector<NodeStatusCode> status;
+    std::vector<BranchTypeCode> branch_type;
+    std::vector<unsigned char> branch_dir;  // 0: 无, 1: 左, 2: 右
+    std::vector<unsigned char> is_integer;
+
+    size_t size() const { return depth.size(); }
+};
+
+NodeColumns BuildNodeColumns(const std::vector<NodeData>& nodes);
+
+// 节点过滤条件 (-1 表示不限)
+struct NodeFilter {
+    int status = -1;        // NodeStatusCode
+    int branch_type = -1;   // BranchTypeCode
+
+    bool Matches(NodeStatusCode s, BranchTypeCode b) const {
+        return (status < 0 || static_cast<int>(s) == status) &&
+               (branch_type < 0 || static_cast<int>(b) == branch_type);
+    }
+};
+
+// 单个深度层的统计
+struct DepthStats {
+    int count = 0;
+    int lb_count = 0;       // 有效下界个数 (lower_bound >= 0)
+    double lb_sum = 0.0;
+    double lb_min = std::numeric_limits<double>::infinity();
+    double lb_max = -std::numeric_limits<double>::infinity();
+    double y_cols_sum = 0.0;
+    double x_cols_sum = 0.0;
+};
+
+// 非负整数的计数直方图: 小于 kExactLimit 的值逐值计数,
+// 更大的值按 2 的幂区间分为 kSubBuckets 个桶 (桶宽不超过下界的 1/32)
+class CountHistogram {
+public:
+    static constexpr int kExactLimit = 64;
+    static constexpr int kSubBuckets = 32;
+    static constexpr int kBucketCount = kExactLimit + (31 - 6) * kSubBuckets;
+
+    void Add(int value);
+    void Merge(const CountHistogram& other);
+
+    // 分位数 (q 取 0~1; 返回所在桶的下界, 空直方图返回 0)
+    int Quantile(double q) const;
+
+    int total() const { return total_; }
+    int max_value() const { return max_value_; }
+
+    // 遍历非空桶: visitor(桶下界, 计数)
+    template <typename Visitor>
+    void ForEachBucket(Visitor visitor) const {
+        for (int b = 0; b < kBucketCount; b++) {
+            if (counts_[b] > 0) visitor(BucketLowerBound(b), counts_[b]);
+        }
+    }
+
+    static int BucketIndex(int value);
+    static int BucketLowerBound(int bucket);
+
+private:
+    std::array<int, kBucketCount> counts_{};
+    int total_ = 0;
+    int max_value_ = 0;
+};
+
+// 聚合统计结果
+struct NodeStatistics {
+    int node_count = 0;
+    std::vector<DepthStats> per_depth;
+
+    // 计数直方图 (负值按 0 计)
+    CountHistogram cg_iteration_counts;
+    CountHistogram y_cols_counts;
+    CountHistogram x_cols_counts;
+    long long cg_iteration_sum = 0;
+
+    // 分支类型 x 节点状态 的节点数
+    int outcome_counts[kBranchTypeCodeCount][kNodeStatusCodeCount] = {};
+};
+
+// 并行计算过滤后节点的聚合统计 (线程安全, 阻塞直到完成)
+NodeStatistics ComputeNodeStatistics(const NodeColumns& columns, const NodeFilter& filter);
+
+#endif  // NODE_STATISTICS_H_
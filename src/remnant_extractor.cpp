@@ -0,0 +1,216 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// remnant_extractor.cpp - 余料提取实现
+
+#include "remnant_extractor.h"
+
+#include <QElapsedTimer>
+#include <QtConcurrent>
+#include <algorithm>
+#include <tuple>
+
+namespace {
+
+// 半开矩形 [x0, x1) x [y0, y1)
+struct Box {
+    int x0, y0, x1, y1;
+
+    long long Area() const { return static_cast<long long>(x1 - x0) * (y1 - y0); }
+    bool Overlaps(const Box& other) const {
+        return x0 < other.x1 && other.x0 < x1 && y0 < other.y1 && other.y0 < y1;
+    }
+};
+
+// container 内避开 obstacles 的全部极大空矩形
+// 障碍边界压缩为 R x C 网格; 逐行累计向下的空白高度, 单调栈给出左右与向下都不能扩展的矩形,
+// 再用上一行的占用前缀和判断能否向上扩展. O(R * C + 障碍覆盖的格数)
+void MaximalEmptyRectangles(const Box& container, const std::vector<Box>& obstacles, std::vector<Box>& out) {
+    std::vector<int> xs = {container.x0, container.x1};
+    std::vector<int> ys = {container.y0, container.y1};
+    for (const Box& b : obstacles) {
+        xs.push_back(std::clamp(b.x0, container.x0, container.x1));
+        xs.push_back(std::clamp(b.x1, container.x0, container.x1));
+        ys.push_back(std::clamp(b.y0, container.y0, container.y1));
+        ys.push_back(std::clamp(b.y1, container.y0, container.y1));
+    }
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+    const int cols = static_cast<int>(xs.size()) - 1;
+    const int rows = static_cast<int>(ys.size()) - 1;
+    if (cols <= 0 || rows <= 0) return;
+
+    auto index_of = [](const std::vector<int>& v, int value) {
+        return static_cast<int>(std::lower_bound(v.begin(), v.end(), value) - v.begin());
+    };
+    std::vector<char> occupied(static_cast<size_t>(rows) * cols, 0);
+    for (const Box& b : obstacles) {
+        int c0 = index_of(xs, std::max(b.x0, container.x0));
+        int c1 = index_of(xs, std::min(b.x1, container.x1));
+        int r0 = index_of(ys, std::max(b.y0, container.y0));
+        int r1 = index_of(ys, std::min(b.y1, container.y1));
+        for (int r = r0; r < r1; r++) {
+            std::fill(occupied.begin() + static_cast<size_t>(r) * cols + c0,
+                      occupied.begin() + static_cast<size_t>(r) * cols + c1, 1);
+        }
+    }
+
+    // 每行占用格数的前缀和 (判断向上扩展)
+    std::vector<int> prefix(static_cast<size_t>(rows) * (cols + 1), 0);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            prefix[static_cast<size_t>(r) * (cols + 1) + c + 1] =
+                prefix[static_cast<size_t>(r) * (cols + 1) + c] + occupied[static_cast<size_t>(r) * cols + c];
+        }
+    }
+    auto row_blocked = [&](int r, int c0, int c1) {   // 第 r 行 [c0, c1) 内有占用格
+        const int* p = prefix.data() + static_cast<size_t>(r) * (cols + 1);
+        return p[c1] - p[c0] > 0;
+    };
+
+    std::vector<int> height(cols, 0);
+    std::vector<std::pair<int, int>> stack;     // (起始列, 高度), 高度严格递增
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            height[c] = occupied[static_cast<size_t>(r) * cols + c] ? 0 : height[c] + 1;
+        }
+        stack.clear();
+        for (int c = 0; c <= cols; c++) {
+            int h = c < cols ? height[c] : 0;
+            int start = c;
+            while (!stack.empty() && stack.back().second >= h) {
+                auto [s, top] = stack.back();
+                stack.pop_back();
+                // 高度相同的区段合并后由后续列处理; 顶部为边界或上一行有占用时才是极大矩形
+                if (top > h && (r + 1 == rows || row_blocked(r + 1, s, c))) {
+                    out.push_back(Box{xs[s], ys[r - top + 1], xs[c], ys[r + 1]});
+                }
+                start = s;
+            }
+            if (h > 0) stack.emplace_back(start, h);
+        }
+    }
+}
+
+}  // namespace
+
+RemnantOptions DefaultRemnantOptions(int stock_width, int stock_length) {
+    RemnantOptions options;
+    options.min_width = std::max(1, stock_width / 10);
+    options.min_length = std::max(1, stock_length / 10);
+    return options;
+}
+
+std::vector<Remnant> ExtractStockRemnants(const StockData& stock, int stock_width, int stock_length,
+                                          const RemnantOptions& options) {
+    // 候选: (矩形, 条带ID); 不同分块之间互不重叠
+    std::vector<std::pair<Box, int>> candidates;
+    std::vector<Box> found;
+    std::vector<Box> obstacles;
+    auto collect = [&](const Box& container, int strip_id) {
+        found.clear();
+        MaximalEmptyRectangles(container, obstacles, found);
+        for (const Box& b : found) {
+            int w = b.y1 - b.y0;
+            int l = b.x1 - b.x0;
+            if (std::min(w, l) >= options.min_width && std::max(w, l) >= options.min_length) {
+                candidates.emplace_back(b, strip_id);
+            }
+        }
+    };
+
+    // 母板级: 条带之外的区域
+    obstacles.clear();
+    for (const StripRect& strip : stock.strips) {
+        obstacles.push_back(Box{0, strip.y, stock_length, strip.y + strip.width});
+    }
+    collect(Box{0, 0, stock_length, stock_width}, -1);
+
+    // 条带级: 按子板左右边界分段
+    std::vector<int> item_strip;
+    AssignItemsToStrips(stock, item_strip);
+    std::vector<std::vector<const ItemRect*>> strip_items(stock.strips.size());
+    for (size_t i = 0; i < stock.items.size(); i++) {
+        if (item_strip[i] >= 0) strip_items[item_strip[i]].push_back(&stock.items[i]);
+    }
+
+    std::vector<int> cuts;
+    for (size_t s = 0; s < stock.strips.size(); s++) {
+        const StripRect& strip = stock.strips[s];
+        std::vector<const ItemRect*>& items = strip_items[s];
+        cuts.assign({0, stock_length});
+        for (const ItemRect* item : items) {
+            cuts.push_back(item->x);
+            cuts.push_back(item->x + item->length);
+        }
+        std::sort(cuts.begin(), cuts.end());
+        cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+        std::sort(items.begin(), items.end(),
+                  [](const ItemRect* a, const ItemRect* b) { return a->x < b->x; });
+
+        size_t first = 0;
+        for (size_t k = 0; k + 1 < cuts.size(); k++) {
+            int x0 = std::max(0, cuts[k]);
+            int x1 = std::min(stock_length, cuts[k + 1]);
+            if (x1 <= x0) continue;
+            // 段内子板 (按 x 排序后前移起点)
+            while (first < items.size() && items[first]->x + items[first]->length <= x0) first++;
+            obstacles.clear();
+            for (size_t i = first; i < items.size() && items[i]->x < x1; i++) {
+                const ItemRect* item = items[i];
+                if (item->x + item->length <= x0) continue;
+                obstacles.push_back(Box{item->x, item->y, item->x + item->length, item->y + item->width});
+            }
+            collect(Box{x0, strip.y, x1, strip.y + strip.width}, strip.strip_id);
+        }
+    }
+
+    // 面积从大到小, 选取互不重叠的矩形
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+        if (a.first.Area() != b.first.Area()) return a.first.Area() > b.first.Area();
+        return std::tie(a.first.y0, a.first.x0) < std::tie(b.first.y0, b.first.x0);
+    });
+    std::vector<Remnant> remnants;
+    std::vector<Box> chosen;
+    for (const auto& [box, strip_id] : candidates) {
+        bool overlaps = std::any_of(chosen.begin(), chosen.end(),
+                                    [&box](const Box& c) { return c.Overlaps(box); });
+        if (overlaps) continue;
+        chosen.push_back(box);
+        remnants.push_back(Remnant{box.x0, box.y0, box.y1 - box.y0, box.x1 - box.x0, strip_id});
+    }
+    return remnants;
+}
+
+RemnantReport ExtractRemnants(const CuttingSolution& solution, const RemnantOptions& options) {
+    QElapsedTimer timer;
+    timer.start();
+
+    RemnantReport report;
+    report.stocks.resize(solution.stocks.size());
+    std::vector<int> indices(solution.stocks.size());
+    for (size_t i = 0; i < indices.size(); i++) indices[i] = static_cast<int>(i);
+
+    // 每个任务只写入自己的结果槽位
+    QtConcurrent::blockingMap(indices, [&solution, &options, &report](int index) {
+        report.stocks[index] = ExtractStockRemnants(solution.stocks[index], solution.stock_width,
+                                                    solution.stock_length, options);
+    });
+
+    for (size_t i = 0; i < report.stocks.size(); i++) {
+        int multiplicity = solution.stocks[i].multiplicity;
+        for (const Remnant& r : report.stocks[i]) {
+            report.remnant_count += multiplicity;
+            report.remnant_area += static_cast<double>(r.width) * r.length * multiplicity;
+        }
+    }
+    report.elapsed_ms = timer.elapsed();
+    return report;
+}
@@ -0,0 +1,54 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// remnant_extractor.h - 余料提取
+// 按两阶段切割的实际分块求空白区域的极大空矩形:
+//   母板级  第一阶段纵切把母板分为条带, 条带之外的区域 (条带间隙与顶部) 以条带为障碍求极大空矩形
+//   条带级  第二阶段横切在子板左右边界处贯穿条带, 条带被分为若干段, 每段内以子板为障碍求极大空矩形
+// 同一区域的极大空矩形互相重叠, 按面积从大到小选取互不重叠且不小于尺寸下限的作为可复用余料
+// 极大空矩形在坐标压缩后的网格上以直方图单调栈枚举; 各切割方式在线程池中并行
+
+#ifndef REMNANT_EXTRACTOR_H_
+#define REMNANT_EXTRACTOR_H_
+
+#include <QtGlobal>
+#include <vector>
+#include "cutting_data.h"
+
+// 余料 (模型坐标)
+struct Remnant {
+    int x, y;           // 左下角
+    int width;          // 宽度 (Y 方向)
+    int length;         // 长度 (X 方向)
+    int strip_id;       // 所在条带, -1 表示条带之外
+};
+
+// 尺寸下限: 短边不小于 min_width 且长边不小于 min_length
+struct RemnantOptions {
+    int min_width = 0;
+    int min_length = 0;
+};
+
+// 默认下限: 母板宽度与长度的 10%
+RemnantOptions DefaultRemnantOptions(int stock_width, int stock_length);
+
+struct RemnantReport {
+    std::vector<std::vector<Remnant>> stocks;   // 每个切割方式的余料 (下标与 stocks 相同)
+    long long remnant_count = 0;                // 含重复次数
+    double remnant_area = 0;                    // 含重复次数
+    qint64 elapsed_ms = 0;
+};
+
+// 单个切割方式 (线程安全)
+std::vector<Remnant> ExtractStockRemnants(const StockData& stock, int stock_width, int stock_length,
+                                          const RemnantOptions& options);
+
+// 全部切割方式 (在线程池中并行, 阻塞)
+RemnantReport ExtractRemnants(const CuttingSolution& solution, const RemnantOptions& options);
+
+#endif  // REMNANT_EXTRACTOR_H_
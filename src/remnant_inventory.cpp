@@ -0,0 +1,137 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// remnant_inventory.cpp - 余料库存实现
+
+#include "remnant_inventory.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace {
+
+constexpr int kInventoryVersion = 1;
+
+void SortByArea(std::vector<RemnantStock>& remnants) {
+    std::stable_sort(remnants.begin(), remnants.end(), [](const RemnantStock& a, const RemnantStock& b) {
+        return static_cast<long long>(a.width) * a.length > static_cast<long long>(b.width) * b.length;
+    });
+}
+
+}  // namespace
+
+int RemnantInventory::TotalQuantity() const {
+    int total = 0;
+    for (const RemnantStock& r : remnants) total += r.quantity;
+    return total;
+}
+
+QString DefaultRemnantInventoryPath() {
+    return QCoreApplication::applicationDirPath() + "/remnant_inventory.json";
+}
+
+bool LoadRemnantInventory(const QString& path, RemnantInventory* inventory, QString* error) {
+    inventory->remnants.clear();
+    QFile file(path);
+    if (!file.exists()) return true;
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (error) *error = QString::fromUtf8("无法打开文件: ") + path;
+        return false;
+    }
+
+    QJsonParseError parse_error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parse_error);
+    if (parse_error.error != QJsonParseError::NoError || !doc.isObject()) {
+        if (error) *error = QString::fromUtf8("JSON 解析错误: ") + parse_error.errorString();
+        return false;
+    }
+
+    for (const auto& value : doc.object()["remnants"].toArray()) {
+        QJsonObject obj = value.toObject();
+        RemnantStock r;
+        r.width = obj["width"].toInt();
+        r.length = obj["length"].toInt();
+        r.quantity = obj["quantity"].toInt();
+        r.source = obj["source"].toString();
+        r.added = obj["added"].toString();
+        if (r.width <= 0 || r.length <= 0 || r.quantity <= 0) continue;
+        if (r.width > r.length) std::swap(r.width, r.length);
+        inventory->remnants.push_back(r);
+    }
+    SortByArea(inventory->remnants);
+    return true;
+}
+
+bool SaveRemnantInventory(const RemnantInventory& inventory, const QString& path, QString* error) {
+    QJsonArray remnants;
+    for (const RemnantStock& r : inventory.remnants) {
+        QJsonObject obj;
+        obj["width"] = r.width;
+        obj["length"] = r.length;
+        obj["quantity"] = r.quantity;
+        obj["source"] = r.source;
+        obj["added"] = r.added;
+        remnants.append(obj);
+    }
+    QJsonObject root;
+    root["version"] = kInventoryVersion;
+    root["remnants"] = remnants;
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        if (error) *error = QString::fromUtf8("无法写入文件: ") + path;
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    if (!file.commit()) {
+        if (error) *error = QString::fromUtf8("写入失败: ") + path;
+        return false;
+    }
+    return true;
+}
+
+int AddRemnantsToInventory(RemnantInventory& inventory, const RemnantReport& report,
+                           const std::vector<StockData>& stocks, const QString& source) {
+    QString key = QFileInfo(source).absoluteFilePath();
+    inventory.remnants.erase(
+        std::remove_if(inventory.remnants.begin(), inventory.remnants.end(),
+                       [&key](const RemnantStock& r) { return r.source == key; }),
+        inventory.remnants.end());
+
+    // 按规范尺寸汇总 (每块余料乘以所在切割方式的重复次数)
+    std::map<std::pair<int, int>, int> counts;
+    for (size_t i = 0; i < report.stocks.size() && i < stocks.size(); i++) {
+        for (const Remnant& r : report.stocks[i]) {
+            counts[{std::min(r.width, r.length), std::max(r.width, r.length)}] += stocks[i].multiplicity;
+        }
+    }
+
+    QString added = QDateTime::currentDateTime().toString(Qt::ISODate);
+    int total = 0;
+    for (const auto& [size, quantity] : counts) {
+        RemnantStock r;
+        r.width = size.first;
+        r.length = size.second;
+        r.quantity = quantity;
+        r.source = key;
+        r.added = added;
+        inventory.remnants.push_back(r);
+        total += quantity;
+    }
+    SortByArea(inventory.remnants);
+    return total;
+}
@@ -0,0 +1,51 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// remnant_inventory.h - 余料库存
+// 本地 JSON 文件 (默认位于程序目录的 remnant_inventory.json), 按 (宽度, 长度, 来源) 汇总数量:
+//   {"version": 1, "remnants": [{"width": w, "length": l, "quantity": n,
+//                                "source": "解文件路径", "added": "ISO 8601 时间"}, ...]}
+// 尺寸已规范为长度 >= 宽度; 同一解文件重复入库时替换原有记录
+// 生成 Tab 可选用库存中的余料尺寸作为新算例的母板
+
+#ifndef REMNANT_INVENTORY_H_
+#define REMNANT_INVENTORY_H_
+
+#include <QString>
+#include <vector>
+#include "cutting_data.h"
+#include "remnant_extractor.h"
+
+struct RemnantStock {
+    int width = 0;
+    int length = 0;
+    int quantity = 0;
+    QString source;
+    QString added;
+};
+
+struct RemnantInventory {
+    std::vector<RemnantStock> remnants;     // 按面积从大到小
+
+    int TotalQuantity() const;
+};
+
+// 程序目录下的默认库存文件
+QString DefaultRemnantInventoryPath();
+
+// 读取库存 (文件不存在视为空库存)
+bool LoadRemnantInventory(const QString& path, RemnantInventory* inventory, QString* error);
+
+// 写入库存 (先写临时文件再替换, 中途失败不破坏原文件)
+bool SaveRemnantInventory(const RemnantInventory& inventory, const QString& path, QString* error);
+
+// 把提取结果 (含重复次数) 加入库存, 返回入库块数
+int AddRemnantsToInventory(RemnantInventory& inventory, const RemnantReport& report,
+                           const std::vector<StockData>& stocks, const QString& source);
+
+#endif  // REMNANT_INVENTORY_H_
@@ -0,0 +1,583 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// run_comparison_widget.cpp - 多解对比页面实现
+
+#include "run_comparison_widget.h"
+#include "chart_widget.h"
+#include "machine_params_dialog.h"
+#include "machine_simulator.h"
+#include "cutting_data.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QSplitter>
+#include <QGroupBox>
+#include <QLabel>
+#include <QPushButton>
+#include <QComboBox>
+#include <QProgressBar>
+#include <QTableWidget>
+#include <QTableWidgetItem>
+#include <QHeaderView>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QDirIterator>
+#include <QFile>
+#include <QTextStream>
+#include <QMessageBox>
+#include <map>
+#include <QtConcurrent>
+#include <algorithm>
+#include <charconv>
+#include <set>
+
+RunComparisonWidget::RunComparisonWidget(QWidget* parent)
+    : QWidget(parent)
+    , load_watcher_(new QFutureWatcher<RunSummary>(this))
+    , machine_watcher_(new QFutureWatcher<RunMachineTime>(this))
+    , machine_generation_(0)
+    , machine_pending_generation_(-1) {
+    SetupUi();
+
+    connect(load_watcher_, &QFutureWatcher<RunSummary>::progressRangeChanged,
+            progress_bar_, &QProgressBar::setRange);
+    connect(load_watcher_, &QFutureWatcher<RunSummary>::progressValueChanged,
+            progress_bar_, &QProgressBar::setValue);
+    connect(load_watcher_, &QFutureWatcher<RunSummary>::finished,
+            this, &RunComparisonWidget::OnLoadFinished);
+    connect(machine_watcher_, &QFutureWatcher<RunMachineTime>::finished,
+            this, &RunComparisonWidget::OnMachineTimeFinished);
+}
+
+void RunComparisonWidget::SetupUi() {
+    QVBoxLayout* main_layout = new QVBoxLayout(this);
+    main_layout->setSpacing(8);
+    main_layout->setContentsMargins(0, 0, 0, 0);
+
+    // 工具栏
+    QHBoxLayout* toolbar = new QHBoxLayout();
+    add_files_button_ = new QPushButton(QString::fromUtf8("添加文件..."));
+    add_dir_button_ = new QPushButton(QString::fromUtf8("添加目录..."));
+    clear_button_ = new QPushButton(QString::fromUtf8("清空"));
+    toolbar->addWidget(add_files_button_);
+    toolbar->addWidget(add_dir_button_);
+    export_button_ = new QPushButton(QString::fromUtf8("导出CSV..."));
+    toolbar->addWidget(clear_button_);
+    toolbar->addWidget(export_button_);
+
+    toolbar->addSpacing(16);
+    toolbar->addWidget(new QLabel(QString::fromUtf8("基准配置:")));
+    baseline_combo_ = new QComboBox();
+    baseline_combo_->setMinimumWidth(160);
+    toolbar->addWidget(baseline_combo_);
+
+    toolbar->addSpacing(16);
+    progress_bar_ = new QProgressBar();
+    progress_bar_->setFixedWidth(160);
+    progress_bar_->setVisible(false);
+    toolbar->addWidget(progress_bar_);
+
+    status_label_ = new QLabel(QString::fromUtf8("未加载"));
+    status_label_->setStyleSheet("color: gray;");
+    toolbar->addWidget(status_label_);
+    toolbar->addStretch();
+    main_layout->addLayout(toolbar);
+
+    QSplitter* splitter = new QSplitter(Qt::Vertical, this);
+
+    // 对比表格
+    QGroupBox* table_group = new QGroupBox(QString::fromUtf8("运行对比 (按算例对齐)"));
+    QVBoxLayout* table_layout = new QVBoxLayout(table_group);
+
+    run_table_ = new QTableWidget();
+    run_table_->setColumnCount(kColumnCount);
+    QStringList headers = {
+        QString::fromUtf8("算例"),
+        QString::fromUtf8("配置"),
+        QString::fromUtf8("状态"),
+        QString::fromUtf8("目标值"),
+        QString::fromUtf8("Δ目标"),
+        QString::fromUtf8("最终下界"),
+        QString::fromUtf8("Gap"),
+        QString::fromUtf8("节点数"),
+        QString::fromUtf8("母板数"),
+        QString::fromUtf8("机器时间(小时)")
+    };
+    for (int i = 0; i < kTimeStageCount; i++) {
+        headers << QString::fromUtf8(kTimeStageNames[i]);
+    }
+    headers << QString::fromUtf8("总时间(秒)") << QString::fromUtf8("加速比")
+            << QString::fromUtf8("原始积分") << QString::fromUtf8("对偶积分")
+            << QString::fromUtf8("原始对偶积分") << QString::fromUtf8("首解(秒)")
+            << QString::fromUtf8("%1%内(秒)").arg(kTargetGaps[kTargetGapCount - 1] * 100, 0, 'g', 3);
+    run_table_->setHorizontalHeaderLabels(headers);
+    run_table_->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    run_table_->horizontalHeader()->setStretchLastSection(true);
+    run_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    run_table_->setSelectionMode(QAbstractItemView::SingleSelection);
+    run_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table_layout->addWidget(run_table_);
+    splitter->addWidget(table_group);
+
+    // 收敛曲线叠加
+    QGroupBox* chart_group = new QGroupBox(QString::fromUtf8("收敛曲线 (选中算例的所有运行)"));
+    QVBoxLayout* chart_layout = new QVBoxLayout(chart_group);
+    convergence_chart_ = new LineChartWidget();
+    convergence_chart_->SetAxisTitles(QString::fromUtf8("时间 (秒)"), QString::fromUtf8("界"));
+    chart_layout->addWidget(convergence_chart_);
+    splitter->addWidget(chart_group);
+
+    splitter->setStretchFactor(0, 3);
+    splitter->setStretchFactor(1, 2);
+    main_layout->addWidget(splitter, 1);
+
+    connect(add_files_button_, &QPushButton::clicked, this, &RunComparisonWidget::OnAddFiles);
+    connect(add_dir_button_, &QPushButton::clicked, this, &RunComparisonWidget::OnAddDirectory);
+    connect(clear_button_, &QPushButton::clicked, this, &RunComparisonWidget::ClearRuns);
+    connect(export_button_, &QPushButton::clicked, this, &RunComparisonWidget::OnExportCsv);
+    connect(baseline_combo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &RunComparisonWidget::OnBaselineChanged);
+    connect(run_table_, &QTableWidget::itemSelectionChanged,
+            this, &RunComparisonWidget::OnRunSelectionChanged);
+
+    RebuildBaselineCombo();
+}
+
+void RunComparisonWidget::OnAddFiles() {
+    QStringList paths = QFileDialog::getOpenFileNames(
+        this, QString::fromUtf8("添加解文件"),
+        "D:/YM-Code/CS-2D-BP-Arc/results",
+        QString::fromUtf8("JSON 文件 (*.json);;所有文件 (*)"));
+    if (!paths.isEmpty()) {
+        AddFiles(paths);
+    }
+}
+
+void RunComparisonWidget::OnAddDirectory() {
+    QString dir = QFileDialog::getExistingDirectory(
+        this, QString::fromUtf8("添加目录 (递归查找 JSON)"),
+        "D:/YM-Code/CS-2D-BP-Arc/results");
+    if (dir.isEmpty()) return;
+
+    QStringList paths;
+    QDirIterator it(dir, {"*.json"}, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        paths << it.next();
+    }
+    AddFiles(paths);
+}
+
+void RunComparisonWidget::AddFiles(const QStringList& paths) {
+    if (paths.isEmpty() || load_watcher_->isRunning()) return;
+
+    // 跳过已加载的文件
+    std::set<QString> loaded;
+    for (const auto& run : runs_) {
+        loaded.insert(run.file_path);
+    }
+    QStringList pending;
+    for (const QString& path : paths) {
+        if (loaded.count(path) == 0) pending << path;
+    }
+    if (pending.isEmpty()) return;
+
+    add_files_button_->setEnabled(false);
+    add_dir_button_->setEnabled(false);
+    clear_button_->setEnabled(false);
+    export_button_->setEnabled(false);
+    progress_bar_->setVisible(true);
+    status_label_->setText(QString::fromUtf8("正在加载 %1 个文件...").arg(pending.size()));
+
+    // 每个文件在线程池中独立解析, 节点表在工作线程内即被释放
+    load_watcher_->setFuture(QtConcurrent::mapped(pending, &LoadRunSummary));
+}
+
+void RunComparisonWidget::OnLoadFinished() {
+    QFuture<RunSummary> future = load_watcher_->future();
+    int failed = 0;
+    for (int i = 0; i < future.resultCount(); i++) {
+        RunSummary run = future.resultAt(i);
+        if (run.loaded) {
+            runs_.push_back(std::move(run));
+        } else {
+            failed++;
+        }
+    }
+
+    std::sort(runs_.begin(), runs_.end(), [](const RunSummary& a, const RunSummary& b) {
+        if (a.instance_key != b.instance_key) return a.instance_key < b.instance_key;
+        if (a.config_label != b.config_label) return a.config_label < b.config_label;
+        return a.file_path < b.file_path;
+    });
+
+    add_files_button_->setEnabled(true);
+    add_dir_button_->setEnabled(true);
+    clear_button_->setEnabled(true);
+    export_button_->setEnabled(true);
+    progress_bar_->setVisible(false);
+
+    std::set<QString> instances;
+    for (const auto& run : runs_) {
+        instances.insert(run.instance_key);
+    }
+    QString status = QString::fromUtf8("%1 个运行, %2 个算例")
+        .arg(runs_.size()).arg(instances.size());
+    if (failed > 0) {
+        status += QString::fromUtf8(", %1 个文件加载失败").arg(failed);
+    }
+    status_label_->setText(status);
+
+    RecomputeAnytimeMetrics();
+    RebuildBaselineCombo();
+    RebuildTable();
+    StartMachineTime();
+}
+
+void RunComparisonWidget::StartMachineTime() {
+    // 上一次计算仍在运行时等其结束, 在 OnMachineTimeFinished 中计算新加入的文件
+    if (machine_watcher_->isRunning()) return;
+
+    QStringList pending;
+    for (const auto& run : runs_) {
+        if (machine_requested_.insert(run.file_path).second) pending << run.file_path;
+    }
+    if (pending.isEmpty()) return;
+
+    // 按添加时保存的机器参数; 每个文件重新读取切割方案, 文件之间并行
+    machine_pending_generation_ = machine_generation_;
+    MachineParameters params = LoadMachineParameters();
+    machine_watcher_->setFuture(QtConcurrent::mapped(pending, [params](const QString& path) {
+        RunMachineTime result;
+        result.file_path = path;
+        CuttingSolution solution;
+        QString error;
+        if (LoadCuttingSolution(path, &solution, &error) && !solution.stocks.empty()) {
+            MachineTimeReport report = SimulateSolutionMachineTime(solution, params);
+            result.valid = true;
+            result.sheet_count = report.sheet_count;
+            result.machine_hours = report.Hours();
+        }
+        return result;
+    }));
+}
+
+void RunComparisonWidget::OnMachineTimeFinished() {
+    // 计算期间清空过列表时丢弃结果
+    if (machine_pending_generation_ == machine_generation_ && !machine_watcher_->isCanceled()) {
+        QFuture<RunMachineTime> future = machine_watcher_->future();
+        std::map<QString, RunMachineTime> results;
+        for (int i = 0; i < future.resultCount(); i++) {
+            RunMachineTime result = future.resultAt(i);
+            results[result.file_path] = result;
+        }
+        for (auto& run : runs_) {
+            auto it = results.find(run.file_path);
+            if (it == results.end() || !it->second.valid) continue;
+            run.has_machine_time = true;
+            run.sheet_count = it->second.sheet_count;
+            run.machine_hours = it->second.machine_hours;
+        }
+        RebuildTable();
+    }
+    StartMachineTime();
+}
+
+void RunComparisonWidget::RecomputeAnytimeMetrics() {
+    // 同一算例的所有运行使用共同的参考值 (最好目标值) 与积分区间 (最长运行时间),
+    // 先结束的运行在剩余时段按其最终差距计入, 保证积分可比
+    struct InstanceReference {
+        double best_objective = 0.0;
+        double horizon = 0.0;
+    };
+    std::map<QString, InstanceReference> references;
+    for (const auto& run : runs_) {
+        InstanceReference& ref = references[run.instance_key];
+        if (run.objective_value > 0 &&
+            (ref.best_objective <= 0 || run.objective_value < ref.best_objective)) {
+            ref.best_objective = run.objective_value;
+        }
+        ref.horizon = std::max(ref.horizon, run.time.total);
+    }
+
+    for (auto& run : runs_) {
+        const InstanceReference& ref = references[run.instance_key];
+        run.anytime = ComputeAnytimeMetrics(run.convergence, ref.best_objective, ref.horizon);
+    }
+}
+
+void RunComparisonWidget::ClearRuns() {
+    if (load_watcher_->isRunning()) return;
+
+    machine_watcher_->cancel();
+    machine_generation_++;
+    machine_requested_.clear();
+    runs_.clear();
+    run_table_->setRowCount(0);
+    convergence_chart_->Clear();
+    status_label_->setText(QString::fromUtf8("未加载"));
+    RebuildBaselineCombo();
+}
+
+void RunComparisonWidget::RebuildBaselineCombo() {
+    QString current = baseline_combo_->currentData().toString();
+
+    std::set<QString> labels;
+    for (const auto& run : runs_) {
+        labels.insert(run.config_label);
+    }
+
+    baseline_combo_->blockSignals(true);
+    baseline_combo_->clear();
+    baseline_combo_->addItem(QString::fromUtf8("每个算例的首个运行"), QString());
+    for (const QString& label : labels) {
+        baseline_combo_->addItem(label, label);
+    }
+    int index = baseline_combo_->findData(current);
+    baseline_combo_->setCurrentIndex(index >= 0 ? index : 0);
+    baseline_combo_->blockSignals(false);
+}
+
+void RunComparisonWidget::OnBaselineChanged(int index) {
+    Q_UNUSED(index);
+    RebuildTable();
+}
+
+int RunComparisonWidget::FindBaselineIndex(const QString& instance_key) const {
+    QString label = baseline_combo_->currentData().toString();
+    auto it = std::lower_bound(runs_.begin(), runs_.end(), instance_key,
+        [](const RunSummary& run, const QString& key) { return run.instance_key < key; });
+    for (; it != runs_.end() && it->instance_key == instance_key; ++it) {
+        if (label.isEmpty() || it->config_label == label) {
+            return static_cast<int>(it - runs_.begin());
+        }
+    }
+    return -1;
+}
+
+void RunComparisonWidget::RebuildTable() {
+    run_table_->setRowCount(0);
+    run_table_->setRowCount(static_cast<int>(runs_.size()));
+
+    const QColor baseline_color(210, 225, 255);
+    auto set_cell = [this](int row, int col, const QString& text) {
+        auto* item = new QTableWidgetItem(text);
+        run_table_->setItem(row, col, item);
+        return item;
+    };
+
+    QString current_instance;
+    int baseline = -1;
+    for (int row = 0; row < static_cast<int>(runs_.size()); row++) {
+        const RunSummary& run = runs_[row];
+        if (run.instance_key != current_instance) {
+            current_instance = run.instance_key;
+            baseline = FindBaselineIndex(current_instance);
+        }
+        const RunSummary* base = (baseline >= 0 && baseline != row) ? &runs_[baseline] : nullptr;
+
+        auto* instance_item = set_cell(row, kColInstance, run.instance_key);
+        instance_item->setData(Qt::UserRole, row);
+        instance_item->setToolTip(run.file_path);
+        set_cell(row, kColConfig, run.config_label)->setToolTip(run.file_path);
+        set_cell(row, kColStatus, run.solve_status);
+        set_cell(row, kColObjective, QString::number(run.objective_value, 'f', 0));
+        set_cell(row, kColObjectiveDelta, base ?
+            QString::number(run.objective_value - base->objective_value, 'f', 0) : "-");
+        set_cell(row, kColFinalLb, QString::number(run.final_lb, 'f', 2));
+        set_cell(row, kColGap, QString::number(run.gap * 100, 'f', 2) + "%");
+        set_cell(row, kColNodes, QString::number(run.total_nodes));
+
+        // 按机器参数模拟的加工时间 (相同母板数的方案可能相差较多)
+        set_cell(row, kColSheets, run.has_machine_time ? QString::number(run.sheet_count) : "-");
+        QString hours = "-";
+        if (run.has_machine_time) {
+            hours = QString::number(run.machine_hours, 'f', 2);
+            if (base && base->has_machine_time) {
+                hours += QString::fromUtf8(" (%1%2)")
+                    .arg(run.machine_hours >= base->machine_hours ? "+" : "")
+                    .arg(run.machine_hours - base->machine_hours, 0, 'f', 2);
+            }
+        }
+        auto* hours_item = set_cell(row, kColMachineHours, hours);
+        if (base && run.has_machine_time && base->has_machine_time) {
+            hours_item->setForeground(run.machine_hours <= base->machine_hours ?
+                QColor(0, 130, 0) : QColor(190, 0, 0));
+        }
+
+        // 各阶段耗时及相对基准的加速比
+        for (int i = 0; i < kTimeStageCount; i++) {
+            double value = run.time.stages[i];
+            QString text = QString::number(value, 'f', 2);
+            if (base && value > 0 && base->time.stages[i] > 0) {
+                text += QString::fromUtf8(" (×%1)").arg(base->time.stages[i] / value, 0, 'f', 2);
+            }
+            set_cell(row, kColStageFirst + i, text);
+        }
+
+        set_cell(row, kColTotalTime, QString::number(run.time.total, 'f', 2));
+        QString speedup = "-";
+        if (base && run.time.total > 0) {
+            speedup = QString::fromUtf8("×%1").arg(base->time.total / run.time.total, 0, 'f', 2);
+        }
+        auto* speedup_item = set_cell(row, kColSpeedup, speedup);
+        if (base && run.time.total > 0) {
+            speedup_item->setForeground(base->time.total >= run.time.total ?
+                QColor(0, 130, 0) : QColor(190, 0, 0));
+        }
+
+        // 随时性能指标
+        const AnytimeMetrics& anytime = run.anytime;
+        auto format_time = [](double t) {
+            return t >= 0 ? QString::number(t, 'f', 2) : QString("-");
+        };
+        set_cell(row, kColPrimalIntegral, anytime.valid ?
+            QString::number(anytime.primal_integral, 'f', 3) : "-");
+        set_cell(row, kColDualIntegral, anytime.valid ?
+            QString::number(anytime.dual_integral, 'f', 3) : "-");
+        auto* pdi_item = set_cell(row, kColPrimalDualIntegral, anytime.valid ?
+            QString::number(anytime.primal_dual_integral, 'f', 3) : "-");
+        if (base && anytime.valid && base->anytime.valid) {
+            pdi_item->setForeground(anytime.primal_dual_integral <= base->anytime.primal_dual_integral ?
+                QColor(0, 130, 0) : QColor(190, 0, 0));
+        }
+        set_cell(row, kColFirstIncumbent, format_time(anytime.time_to_first_incumbent));
+        set_cell(row, kColTimeToTarget, format_time(anytime.time_to_target[kTargetGapCount - 1]));
+
+        if (baseline == row) {
+            for (int col = 0; col < kColumnCount; col++) {
+                if (auto* item = run_table_->item(row, col)) {
+                    item->setBackground(baseline_color);
+                }
+            }
+        }
+    }
+}
+
+void RunComparisonWidget::OnExportCsv() {
+    if (runs_.empty()) return;
+
+    QString path = QFileDialog::getSaveFileName(
+        this, QString::fromUtf8("导出对比表"),
+        "run_comparison.csv",
+        QString::fromUtf8("CSV 文件 (*.csv)"));
+    if (path.isEmpty()) return;
+
+    if (!ExportCsv(path)) {
+        QMessageBox::warning(this, QString::fromUtf8("错误"),
+            QString::fromUtf8("无法写入文件: ") + path);
+    }
+}
+
+bool RunComparisonWidget::ExportCsv(const QString& path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "instance,config,file,status,objective,heuristic,root_lb,final_lb,gap,"
+           "total_nodes,pruned_nodes,infeasible_nodes,integer_nodes,sheets,machine_hours";
+    for (int i = 0; i < kTimeStageCount; i++) {
+        out << ",time_" << kTimeStageKeys[i];
+    }
+    out << ",time_total";
+    for (int i = 0; i < kAnytimeColumnCount; i++) {
+        out << ',' << kAnytimeColumnKeys[i];
+    }
+    out << "\n";
+
+    // 浮点数用最短往返表示 (与分析数据导出相同), QTextStream 默认只保留 6 位有效数字
+    auto number = [](double value) {
+        char tmp[32];
+        auto result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        return QString::fromLatin1(tmp, result.ptr - tmp);
+    };
+
+    // 字段中可能含逗号的文本列加引号
+    auto quote = [](const QString& text) {
+        QString escaped = text;
+        escaped.replace("\"", "\"\"");
+        return "\"" + escaped + "\"";
+    };
+
+    for (const auto& run : runs_) {
+        out << quote(run.instance_key) << ',' << quote(run.config_label) << ','
+            << quote(run.file_path) << ',' << run.solve_status << ','
+            << number(run.objective_value) << ',' << number(run.heuristic_value) << ','
+            << number(run.root_lb) << ',' << number(run.final_lb) << ',' << number(run.gap) << ','
+            << run.total_nodes << ',' << run.pruned_nodes << ','
+            << run.infeasible_nodes << ',' << run.integer_nodes;
+        if (run.has_machine_time) {
+            out << ',' << run.sheet_count << ',' << number(run.machine_hours);
+        } else {
+            out << ",,";
+        }
+        for (int i = 0; i < kTimeStageCount; i++) {
+            out << ',' << number(run.time.stages[i]);
+        }
+        out << ',' << number(run.time.total);
+
+        double anytime[kAnytimeColumnCount];
+        AnytimeColumnValues(run.anytime, anytime);
+        for (int i = 0; i < kAnytimeColumnCount; i++) {
+            out << ',';
+            if (run.anytime.valid) out << number(anytime[i]);
+        }
+        out << "\n";
+    }
+
+    file.close();
+    return true;
+}
+
+void RunComparisonWidget::OnRunSelectionChanged() {
+    QList<QTableWidgetItem*> selected = run_table_->selectedItems();
+    if (selected.isEmpty()) return;
+
+    int row = selected.first()->row();
+    if (row >= 0 && row < static_cast<int>(runs_.size())) {
+        UpdateConvergencePlot(runs_[row].instance_key);
+    }
+}
+
+void RunComparisonWidget::UpdateConvergencePlot(const QString& instance_key) {
+    std::vector<ChartSeries> series;
+    int color_index = 0;
+
+    for (const auto& run : runs_) {
+        if (run.instance_key != instance_key) continue;
+
+        QString name = run.config_label + "/" + QFileInfo(run.file_path).completeBaseName();
+        ChartSeries ub_series;
+        ub_series.name = name + " UB";
+        ub_series.color = LineChartWidget::GetSeriesColor(color_index);
+        ub_series.step = true;
+
+        ChartSeries lb_series;
+        lb_series.name = name + " LB";
+        lb_series.color = ub_series.color;
+        lb_series.style = Qt::DashLine;
+        lb_series.step = true;
+
+        for (const auto& point : run.convergence) {
+            if (point.ub >= 0 && point.ub < 1e10) {
+                ub_series.points.emplace_back(point.time, point.ub);
+            }
+            if (point.lb >= 0) {
+                lb_series.points.emplace_back(point.time, point.lb);
+            }
+        }
+
+        series.push_back(std::move(ub_series));
+        series.push_back(std::move(lb_series));
+        color_index++;
+    }
+
+    convergence_chart_->SetSeries(std::move(series));
+}
@@ -0,0 +1,117 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// run_comparison_widget.h - 多解对比页面
+// 线程池并行读取多个解文件 (仅保留概要、时间统计与收敛历史),
+// 按算例对齐显示, 给出相对基准配置的差值与加速比、随时性能指标, 并叠加收敛曲线
+
+#ifndef RUN_COMPARISON_WIDGET_H_
+#define RUN_COMPARISON_WIDGET_H_
+
+#include <QWidget>
+#include <QString>
+#include <QStringList>
+#include <QFutureWatcher>
+#include <set>
+#include <vector>
+#include "analysis_data.h"
+
+class QPushButton;
+class QComboBox;
+class QLabel;
+class QProgressBar;
+class QTableWidget;
+class LineChartWidget;
+
+// 一个解文件的机器时间 (在概要加载后另行在后台计算)
+struct RunMachineTime {
+    QString file_path;
+    bool valid = false;         // 文件含切割方案
+    long long sheet_count = 0;
+    double machine_hours = 0.0;
+};
+
+class RunComparisonWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit RunComparisonWidget(QWidget* parent = nullptr);
+
+    // 添加解文件 (后台并行加载)
+    void AddFiles(const QStringList& paths);
+    void ClearRuns();
+
+    // 导出对比表 (每个运行一行, 含随时性能指标)
+    bool ExportCsv(const QString& path) const;
+
+    const std::vector<RunSummary>& GetRuns() const { return runs_; }
+
+private slots:
+    void OnAddFiles();
+    void OnAddDirectory();
+    void OnExportCsv();
+    void OnLoadFinished();
+    void OnMachineTimeFinished();
+    void OnBaselineChanged(int index);
+    void OnRunSelectionChanged();
+
+private:
+    void SetupUi();
+    void RebuildBaselineCombo();
+    void RebuildTable();
+    void RecomputeAnytimeMetrics();
+    void StartMachineTime();
+    void UpdateConvergencePlot(const QString& instance_key);
+    int FindBaselineIndex(const QString& instance_key) const;
+
+    // 表格列
+    enum Column {
+        kColInstance = 0,
+        kColConfig,
+        kColStatus,
+        kColObjective,
+        kColObjectiveDelta,
+        kColFinalLb,
+        kColGap,
+        kColNodes,
+        kColSheets,
+        kColMachineHours,
+        kColStageFirst,
+        kColTotalTime = kColStageFirst + kTimeStageCount,
+        kColSpeedup,
+        kColPrimalIntegral,
+        kColDualIntegral,
+        kColPrimalDualIntegral,
+        kColFirstIncumbent,
+        kColTimeToTarget,
+        kColumnCount
+    };
+
+    // UI 组件
+    QPushButton* add_files_button_;
+    QPushButton* add_dir_button_;
+    QPushButton* clear_button_;
+    QPushButton* export_button_;
+    QComboBox* baseline_combo_;
+    QProgressBar* progress_bar_;
+    QLabel* status_label_;
+    QTableWidget* run_table_;
+    LineChartWidget* convergence_chart_;
+
+    // 数据
+    std::vector<RunSummary> runs_;    // 按 (算例, 配置, 文件) 排序
+    QFutureWatcher<RunSummary>* load_watcher_;
+
+    // 机器时间 (需要解析切割方案并优化锯切顺序, 不阻塞概要显示; generation 在清空时递增)
+    QFutureWatcher<RunMachineTime>* machine_watcher_;
+    std::set<QString> machine_requested_;     // 已提交计算的文件
+    int machine_generation_;
+    int machine_pending_generation_;
+};
+
+#endif  // RUN_COMPARISON_WIDGET_H_
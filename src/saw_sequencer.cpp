@@ -0,0 +1,227 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// saw_sequencer.cpp - 锯切顺序优化实现
+
+#include "saw_sequencer.h"
+
+#include <QtConcurrent>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace {
+
+constexpr int kFullSearchLimit = 400;   // 道数不超过此值时 2-opt 考察全部区段
+constexpr int kSearchWindow = 64;       // 否则只考察长度不超过窗口的区段 (每轮 O(n * 窗口))
+constexpr int kMaxRounds = 50;
+constexpr double kEpsilon = 1e-9;
+
+struct Point {
+    double x;
+    double y;
+};
+
+Point PassStart(const SawPass& pass) {
+    return pass.stage == 1 ? Point{static_cast<double>(pass.from), static_cast<double>(pass.coord)}
+                           : Point{static_cast<double>(pass.coord), static_cast<double>(pass.from)};
+}
+
+Point PassEnd(const SawPass& pass) {
+    return pass.stage == 1 ? Point{static_cast<double>(pass.to), static_cast<double>(pass.coord)}
+                           : Point{static_cast<double>(pass.coord), static_cast<double>(pass.to)};
+}
+
+// 两轴同时移动, 空行程时间由较长的一轴决定
+double Distance(const Point& a, const Point& b) {
+    return std::max(std::abs(a.x - b.x), std::abs(a.y - b.y));
+}
+
+void ReversePass(SawPass& pass) {
+    std::swap(pass.from, pass.to);
+}
+
+// 第二阶段分组: 同一 x 上首尾相接的切割线 (相邻条带) 合并为一道
+std::vector<SawPass> GroupStage2Cuts(const CutGeometry& cuts) {
+    std::vector<std::tuple<int, int, int>> segments;   // (x, y0, y1)
+    segments.reserve(cuts.stage2_x.size());
+    for (size_t i = 0; i < cuts.stage2_x.size(); i++) {
+        segments.emplace_back(cuts.stage2_x[i], cuts.stage2_y0[i], cuts.stage2_y1[i]);
+    }
+    std::sort(segments.begin(), segments.end());
+
+    std::vector<SawPass> passes;
+    for (const auto& [x, y0, y1] : segments) {
+        if (!passes.empty() && passes.back().coord == x && passes.back().to == y0) {
+            passes.back().to = y1;
+            passes.back().cut_count++;
+        } else {
+            passes.push_back(SawPass{2, x, y0, y1, 1});
+        }
+    }
+    return passes;
+}
+
+// 阶段内局部搜索: 每个阶段从原点开始, 最小化道与道之间的空行程
+void ImproveOrder(SawPass* passes, int n) {
+    if (n <= 0) return;
+    const Point origin{0, 0};
+    auto prev_end = [&](int i) { return i == 0 ? origin : PassEnd(passes[i - 1]); };
+
+    // 初始解: 按坐标排序, 每道选择离当前位置较近的一端开始 (往返切割)
+    std::sort(passes, passes + n, [](const SawPass& a, const SawPass& b) {
+        if (a.coord != b.coord) return a.coord < b.coord;
+        return std::min(a.from, a.to) < std::min(b.from, b.to);
+    });
+    Point pos = origin;
+    for (int i = 0; i < n; i++) {
+        if (Distance(pos, PassEnd(passes[i])) < Distance(pos, PassStart(passes[i]))) {
+            ReversePass(passes[i]);
+        }
+        pos = PassEnd(passes[i]);
+    }
+
+    const int window = n <= kFullSearchLimit ? n : kSearchWindow;
+    for (int round = 0; round < kMaxRounds; round++) {
+        bool improved = false;
+
+        // 单道翻转切割方向
+        for (int i = 0; i < n; i++) {
+            Point a = prev_end(i);
+            double before = Distance(a, PassStart(passes[i]));
+            double after = Distance(a, PassEnd(passes[i]));
+            if (i + 1 < n) {
+                Point b = PassStart(passes[i + 1]);
+                before += Distance(PassEnd(passes[i]), b);
+                after += Distance(PassStart(passes[i]), b);
+            }
+            if (after < before - kEpsilon) {
+                ReversePass(passes[i]);
+                improved = true;
+            }
+        }
+
+        // 2-opt: 反转区段 [i, j] 的顺序与每道方向, 区段内部空行程不变, 只需比较两端
+        for (int i = 0; i + 1 < n; i++) {
+            Point a = prev_end(i);
+            Point start_i = PassStart(passes[i]);
+            int last = std::min(n - 1, i + window);
+            for (int j = i + 1; j <= last; j++) {
+                Point end_j = PassEnd(passes[j]);
+                double before = Distance(a, start_i);
+                double after = Distance(a, end_j);
+                if (j + 1 < n) {
+                    Point b = PassStart(passes[j + 1]);
+                    before += Distance(end_j, b);
+                    after += Distance(start_i, b);
+                }
+                if (after < before - kEpsilon) {
+                    std::reverse(passes + i, passes + j + 1);
+                    for (int k = i; k <= j; k++) ReversePass(passes[k]);
+                    start_i = PassStart(passes[i]);
+                    improved = true;
+                }
+            }
+        }
+
+        if (!improved) break;
+    }
+}
+
+// 按机器模型估计周期时间 (每个阶段从原点开始, 阶段切换计一次旋转)
+void EvaluateSequence(SawSequence& sequence, const SawMachineModel& model) {
+    const Point origin{0, 0};
+    double cut_length = 0;
+    double travel = 0;
+    int rotations = 0;
+    int stage = 0;
+    Point pos = origin;
+
+    for (const SawPass& pass : sequence.passes) {
+        if (pass.stage != stage) {
+            if (stage != 0) rotations++;
+            stage = pass.stage;
+            pos = origin;
+        }
+        travel += Distance(pos, PassStart(pass));
+        cut_length += std::abs(pass.to - pass.from);
+        pos = PassEnd(pass);
+    }
+
+    sequence.rotations = rotations;
+    sequence.cut_length = cut_length;
+    sequence.travel_length = travel;
+    sequence.cut_time = cut_length / std::max(kEpsilon, model.cut_speed);
+    sequence.travel_time = travel / std::max(kEpsilon, model.rapid_speed);
+    sequence.overhead_time = sequence.passes.size() * model.pass_overhead +
+                             rotations * model.rotation_time;
+    sequence.total_time = sequence.cut_time + sequence.travel_time + sequence.overhead_time;
+}
+
+// 原始顺序: 切割线按几何顺序逐条切割 (均从低端开始, 不合并)
+double BaselineTime(const CutGeometry& cuts, int stock_length, const SawMachineModel& model) {
+    SawSequence baseline;
+    baseline.passes.reserve(cuts.stage1_y.size() + cuts.stage2_x.size());
+    for (int y : cuts.stage1_y) {
+        baseline.passes.push_back(SawPass{1, y, 0, stock_length, 1});
+    }
+    for (size_t i = 0; i < cuts.stage2_x.size(); i++) {
+        baseline.passes.push_back(SawPass{2, cuts.stage2_x[i], cuts.stage2_y0[i], cuts.stage2_y1[i], 1});
+    }
+    EvaluateSequence(baseline, model);
+    return baseline.total_time;
+}
+
+}  // namespace
+
+SawSequence OptimizeSawSequence(const StockData& stock, int stock_length,
+                                const SawMachineModel& model) {
+    const CutGeometry& cuts = stock.cuts;
+    SawSequence sequence;
+
+    // 第一阶段: 纵切贯穿母板全长
+    sequence.passes.reserve(cuts.stage1_y.size() + cuts.stage2_x.size());
+    for (int y : cuts.stage1_y) {
+        sequence.passes.push_back(SawPass{1, y, 0, stock_length, 1});
+    }
+    int stage1_count = static_cast<int>(sequence.passes.size());
+
+    // 第二阶段: 合并后的横切
+    std::vector<SawPass> stage2 = GroupStage2Cuts(cuts);
+    sequence.passes.insert(sequence.passes.end(), stage2.begin(), stage2.end());
+
+    ImproveOrder(sequence.passes.data(), stage1_count);
+    ImproveOrder(sequence.passes.data() + stage1_count,
+                 static_cast<int>(sequence.passes.size()) - stage1_count);
+
+    EvaluateSequence(sequence, model);
+    sequence.baseline_time = BaselineTime(cuts, stock_length, model);
+    return sequence;
+}
+
+std::vector<SawSequence> OptimizeSawSequences(const CuttingSolution& solution,
+                                              const SawMachineModel& model) {
+    std::vector<SawSequence> sequences(solution.stocks.size());
+    std::vector<int> indices(solution.stocks.size());
+    for (size_t i = 0; i < indices.size(); i++) indices[i] = static_cast<int>(i);
+
+    // 每个任务只写入自己的结果槽位
+    QtConcurrent::blockingMap(indices, [&solution, &model, &sequences](int index) {
+        sequences[index] = OptimizeSawSequence(solution.stocks[index], solution.stock_length, model);
+    });
+    return sequences;
+}
+
+QString FormatSawTime(double seconds) {
+    long long total = std::llround(seconds);
+    if (total >= 3600) {
+        return QString("%1:%2:%3").arg(total / 3600)
+            .arg(total / 60 % 60, 2, 10, QChar('0')).arg(total % 60, 2, 10, QChar('0'));
+    }
+    return QString("%1:%2").arg(total / 60).arg(total % 60, 2, 10, QChar('0'));
+}
@@ -0,0 +1,67 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// saw_sequencer.h - 锯切顺序优化
+// 机器模型: 锯头只沿一个方向切割, 两阶段之间母板旋转 90 度; 每道切割包括落锯、进给、抬锯,
+// 道与道之间锯头快速移动 (两轴同时移动, 取 Chebyshev 距离)
+//
+// 优化内容:
+//   分组   相邻条带中 x 相同的第二阶段切割线首尾相接, 合并为一道 (一次落锯切过多个条带)
+//   顺序   先全部第一阶段纵切, 旋转一次, 再全部第二阶段横切 (旋转次数最少);
+//          阶段内以局部搜索 (单道翻转 + 2-opt 区段反转) 最小化空行程
+// 各切割方式相互独立, 在线程池中并行计算
+
+#ifndef SAW_SEQUENCER_H_
+#define SAW_SEQUENCER_H_
+
+#include <QString>
+#include <vector>
+#include "cutting_data.h"
+
+// 机器参数 (长度单位与解文件相同, 时间单位为秒)
+struct SawMachineModel {
+    double cut_speed = 300.0;       // 进给速度 (单位/秒)
+    double rapid_speed = 1000.0;    // 空行程速度 (单位/秒)
+    double pass_overhead = 1.0;     // 每道切割的落锯与抬锯时间
+    double rotation_time = 15.0;    // 母板旋转一次的时间
+};
+
+// 一道切割: 第一阶段沿 X 方向 (coord 为 y), 第二阶段沿 Y 方向 (coord 为 x); 从 from 切到 to
+struct SawPass {
+    unsigned char stage;    // 1 或 2
+    int coord;
+    int from;
+    int to;
+    int cut_count;          // 合并的切割线条数 (第一阶段为 1)
+};
+
+// 单个切割方式的切割顺序与时间估计
+struct SawSequence {
+    std::vector<SawPass> passes;    // 执行顺序
+    int rotations = 0;
+    double cut_length = 0;          // 进给长度合计
+    double travel_length = 0;       // 空行程距离合计 (Chebyshev)
+    double cut_time = 0;            // 进给时间
+    double travel_time = 0;         // 空行程时间
+    double overhead_time = 0;       // 落锯/抬锯与旋转时间
+    double total_time = 0;          // 估计周期时间
+    double baseline_time = 0;       // 按原始顺序 (逐条切割, 不合并) 的周期时间
+};
+
+// 计算单个切割方式的切割顺序 (线程安全)
+SawSequence OptimizeSawSequence(const StockData& stock, int stock_length,
+                                const SawMachineModel& model = SawMachineModel());
+
+// 全部切割方式 (在线程池中并行, 阻塞)
+std::vector<SawSequence> OptimizeSawSequences(const CuttingSolution& solution,
+                                              const SawMachineModel& model = SawMachineModel());
+
+// 时间显示 (m:ss 或 h:mm:ss)
+QString FormatSawTime(double seconds);
+
+#endif  // SAW_SEQUENCER_H_
@@ -0,0 +1,484 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_diff.cpp - 同一算例两个解的切割方式对比实现
+
+#include "solution_diff.h"
+
+#include <QElapsedTimer>
+#include <QtConcurrent>
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+constexpr int kCostScale = 10000;   // 差异度 [0, 1] 换算为整数代价 (最短路用整数, 约化代价为 0 的判断没有浮点误差)
+
+// 子板 (位置、尺寸与类型) 的 64 位键: 计算差异度时成对比较的次数为切割方式数的平方, 比较键而不是逐字段比较
+unsigned long long ItemKey(const ItemRect& item) {
+    unsigned long long h = 14695981039346656037ULL;
+    for (int value : {item.y, item.x, item.width, item.length, item.item_type}) {
+        h ^= static_cast<unsigned int>(value);
+        h *= 1099511628211ULL;
+    }
+    return h ^ (h >> 29);
+}
+
+// 每个切割方式的子板面积、子板键 (升序) 与按类型的面积构成 (按类型升序)
+struct PatternProfile {
+    double item_area = 0;
+    std::vector<std::pair<unsigned long long, double>> items;
+    std::vector<std::pair<int, double>> type_area;
+};
+
+PatternProfile BuildProfile(const StockData& stock) {
+    PatternProfile profile;
+    std::map<int, double> areas;
+    profile.items.reserve(stock.items.size());
+    for (const ItemRect& item : stock.items) {
+        double area = static_cast<double>(item.width) * item.length;
+        profile.item_area += area;
+        profile.items.emplace_back(ItemKey(item), area);
+        areas[item.item_type] += area;
+    }
+    std::sort(profile.items.begin(), profile.items.end());
+    profile.type_area.assign(areas.begin(), areas.end());
+    return profile;
+}
+
+// 按键升序归并, 两侧都有的键累加 min(面积) (相同键的面积相同)
+template <typename Key>
+double SharedArea(const std::vector<std::pair<Key, double>>& a, const std::vector<std::pair<Key, double>>& b) {
+    double shared = 0;
+    auto p = a.begin();
+    auto q = b.begin();
+    while (p != a.end() && q != b.end()) {
+        if (p->first < q->first) {
+            ++p;
+        } else if (q->first < p->first) {
+            ++q;
+        } else {
+            shared += std::min(p->second, q->second);
+            ++p;
+            ++q;
+        }
+    }
+    return shared;
+}
+
+// 子板的规范顺序 (与加载去重时相同)
+bool ItemLess(const ItemRect& a, const ItemRect& b) {
+    return std::tie(a.y, a.x, a.width, a.length, a.item_type) <
+           std::tie(b.y, b.x, b.width, b.length, b.item_type);
+}
+
+double PatternDifference(const PatternProfile& a, const PatternProfile& b) {
+    double total = a.item_area + b.item_area;
+    if (total <= 0) return 0;
+    // 位置相同的子板必然类型相同: 类型构成不重合时不必逐个比较子板
+    double shared_types = SharedArea(a.type_area, b.type_area);
+    if (shared_types <= 0) return 1.0;
+    double position = 1.0 - 2.0 * SharedArea(a.items, b.items) / total;
+    double composition = 1.0 - shared_types / std::max(a.item_area, b.item_area);
+    return std::clamp(0.5 * (position + composition), 0.0, 1.0);
+}
+
+// 平衡运输问题 (供给与需求之和相等) 的最小费用解: 逐次最短增广路, 以势保持约化代价非负
+// 先按列归约、行归约与增广行归约在约化代价为 0 的边上分配, 余下的供给逐行用稠密 Dijkstra 找到仍有需求的最近列后增广,
+// 每次增广的量为路径上的瓶颈 (供给、需求或反向边流量). 节点是切割方式而不是单张母板,
+// 每次最短路 O(行数 x 列数) 与张数无关. cost(i, j) 为非负整数; 返回流量为正的 (行, 列, 流量)
+template <typename Cost>
+std::vector<std::tuple<int, int, int>> SolveTransport(std::vector<int> supply, std::vector<int> demand,
+                                                      const Cost& cost) {
+    const int m = static_cast<int>(supply.size());
+    const int k = static_cast<int>(demand.size());
+    std::vector<std::vector<std::pair<int, int>>> flows(k);    // 每列: (行, 流量)
+    std::vector<long long> u(m, 0);     // 行势
+    std::vector<long long> v(k, 0);     // 列势; 约化代价 cost(i, j) + u[i] - v[j] >= 0, 有流量的边为 0
+    std::vector<int> row_flows(m, 0);    // 每行有流量的列数
+    auto add_flow = [&](int i, int j, int amount) {
+        auto& column = flows[j];
+        for (size_t e = 0; e < column.size(); e++) {
+            if (column[e].first != i) continue;
+            column[e].second += amount;
+            if (column[e].second == 0) {
+                column[e] = column.back();
+                column.pop_back();
+                row_flows[i]--;
+            }
+            return;
+        }
+        column.emplace_back(i, amount);
+        row_flows[i]++;
+    };
+    auto push = [&](int i, int j) {
+        int amount = std::min(supply[i], demand[j]);
+        supply[i] -= amount;
+        demand[j] -= amount;
+        add_flow(i, j, amount);
+    };
+    auto flow_of = [&](int i, int j) {
+        for (const auto& [row, flow] : flows[j]) {
+            if (row == i) return flow;
+        }
+        return 0;
+    };
+    if (m == 0 || k == 0) return {};
+
+    // 列归约: 每列在代价最小的行上分配
+    for (int j = 0; j < k; j++) {
+        long long min = LLONG_MAX;
+        for (int i = 0; i < m; i++) min = std::min<long long>(min, cost(i, j));
+        v[j] = min;
+        for (int i = 0; i < m && demand[j] > 0; i++) {
+            if (supply[i] > 0 && cost(i, j) == min) push(i, j);
+        }
+    }
+    // 行归约: 尚未分配的行降低行势, 在约化代价为 0 的列上分配
+    for (int i = 0; i < m; i++) {
+        if (row_flows[i] > 0 || supply[i] == 0) continue;
+        long long min = LLONG_MAX;
+        for (int j = 0; j < k; j++) min = std::min(min, cost(i, j) - v[j]);
+        u[i] = -min;
+        for (int j = 0; j < k && supply[i] > 0; j++) {
+            if (demand[j] > 0 && cost(i, j) + u[i] - v[j] == 0) push(i, j);
+        }
+    }
+
+    // 增广行归约 (两轮): 仍有供给的行取 cost(i, j) - v[j] 最小的列 (并列时优先仍有需求的列);
+    // 该列已满时, 若该行在别处没有流量且能接下列上其他行的全部流量, 挤走这些行并把列势降到该行的次小值.
+    // 始终保持每行的流量都在其最小值所在的列上 (行势即为负的最小值)
+    std::vector<int> pending;
+    std::vector<int> evicted;
+    std::vector<int> free_rows;
+    for (int i = 0; i < m; i++) {
+        if (supply[i] > 0) free_rows.push_back(i);
+    }
+    for (int pass = 0; pass < 2 && !free_rows.empty(); pass++) {
+        pending.assign(free_rows.rbegin(), free_rows.rend());   // 栈顶为下一个处理的行
+        free_rows.clear();
+        while (!pending.empty()) {
+            int i = pending.back();
+            pending.pop_back();
+            if (supply[i] == 0) continue;
+            long long h1 = LLONG_MAX;
+            long long h2 = LLONG_MAX;
+            int j1 = -1;
+            for (int j = 0; j < k; j++) {
+                long long h = cost(i, j) - v[j];
+                if (h < h1) {
+                    h2 = h1;
+                    h1 = h;
+                    j1 = j;
+                } else if (h == h1) {
+                    h2 = h;
+                    if (demand[j1] == 0 && demand[j] > 0) j1 = j;
+                } else if (h < h2) {
+                    h2 = h;
+                }
+            }
+            if (demand[j1] > 0) {
+                push(i, j1);
+                if (supply[i] > 0) pending.push_back(i);
+                continue;
+            }
+            int others = 0;
+            for (const auto& [row, flow] : flows[j1]) {
+                if (row != i) others += flow;
+            }
+            int own = flow_of(i, j1);
+            if (others == 0 || others > supply[i] || row_flows[i] > (own > 0 ? 1 : 0)) {
+                free_rows.push_back(i);     // 留给最短增广路
+                continue;
+            }
+            evicted.clear();
+            for (const auto& [row, flow] : flows[j1]) {
+                if (row == i) continue;
+                evicted.push_back(row);
+                supply[row] += flow;
+                row_flows[row]--;
+            }
+            flows[j1].assign(1, std::make_pair(i, own + others));
+            if (own == 0) row_flows[i]++;
+            supply[i] -= others;
+            if (supply[i] > 0) free_rows.push_back(i);
+            if (h1 < h2) {
+                // 列势严格下降时立即重新处理被挤走的行, 否则留到下一轮
+                v[j1] -= h2 - h1;
+                pending.insert(pending.end(), evicted.begin(), evicted.end());
+            } else {
+                free_rows.insert(free_rows.end(), evicted.begin(), evicted.end());
+            }
+        }
+    }
+    for (int i = 0; i < m; i++) {
+        long long min = LLONG_MAX;
+        for (int j = 0; j < k; j++) min = std::min(min, cost(i, j) - v[j]);
+        u[i] = -min;
+    }
+
+    // 逐次最短增广路 (稠密 Dijkstra): 每次从一个仍有供给的行出发, 到达第一个仍有需求的列即增广
+    std::vector<long long> d(k);
+    std::vector<int> pred(k);               // 到达该列的行
+    std::vector<int> cols(k);               // [0, low) 已确定距离, [low, up) 为当前最小距离, [up, k) 待扫描
+    std::vector<int> parent_row(m, -2);     // 经反向边到达该行的列; -1 为起点, -2 为未到达
+    std::vector<long long> dist_row(m);
+    std::vector<int> reached_rows;
+    for (int source = 0; source < m; source++) {
+        while (supply[source] > 0) {
+            for (int j = 0; j < k; j++) {
+                d[j] = cost(source, j) + u[source] - v[j];
+                pred[j] = source;
+                cols[j] = j;
+            }
+            reached_rows.assign(1, source);
+            parent_row[source] = -1;
+            dist_row[source] = 0;
+            int low = 0;
+            int up = 0;
+            long long min = 0;
+            int target = -1;
+            while (target < 0) {
+                if (up == low) {
+                    if (low == k) return {};    // 供需不平衡
+                    min = d[cols[up++]];
+                    for (int q = up; q < k; q++) {
+                        int j = cols[q];
+                        if (d[j] <= min) {
+                            if (d[j] < min) {
+                                up = low;
+                                min = d[j];
+                            }
+                            cols[q] = cols[up];
+                            cols[up++] = j;
+                        }
+                    }
+                    for (int q = low; q < up; q++) {
+                        if (demand[cols[q]] > 0) {
+                            target = cols[q];
+                            break;
+                        }
+                    }
+                    if (target >= 0) break;
+                }
+                // 经反向边 (约化代价为 0) 到达该列上有流量的行, 由这些行继续松弛
+                int j1 = cols[low++];
+                for (const auto& [i, flow] : flows[j1]) {
+                    if (parent_row[i] != -2) continue;
+                    parent_row[i] = j1;
+                    dist_row[i] = min;
+                    reached_rows.push_back(i);
+                    for (int q = up; q < k && target < 0; q++) {
+                        int j = cols[q];
+                        long long h = min + cost(i, j) + u[i] - v[j];
+                        if (h < d[j]) {
+                            d[j] = h;
+                            pred[j] = i;
+                            if (h == min) {
+                                if (demand[j] > 0) target = j;
+                                cols[q] = cols[up];
+                                cols[up++] = j;
+                            }
+                        }
+                    }
+                    if (target >= 0) break;
+                }
+            }
+
+            // 更新势 (只改变距离小于增广路长度的节点), 增广路上的边约化代价为 0
+            for (int q = 0; q < low; q++) v[cols[q]] += d[cols[q]] - min;
+            for (int i : reached_rows) u[i] += dist_row[i] - min;
+
+            // 沿增广路求瓶颈后调整流量
+            int amount = demand[target];
+            for (int j = target;;) {
+                int i = pred[j];
+                if (parent_row[i] < 0) {
+                    amount = std::min(amount, supply[i]);
+                    break;
+                }
+                j = parent_row[i];
+                amount = std::min(amount, flow_of(i, j));
+            }
+            demand[target] -= amount;
+            for (int j = target;;) {
+                int i = pred[j];
+                add_flow(i, j, amount);
+                if (parent_row[i] < 0) {
+                    supply[i] -= amount;
+                    break;
+                }
+                j = parent_row[i];
+                add_flow(i, j, -amount);
+            }
+            for (int i : reached_rows) parent_row[i] = -2;
+        }
+    }
+
+    std::vector<std::tuple<int, int, int>> result;
+    for (int j = 0; j < k; j++) {
+        for (const auto& [i, flow] : flows[j]) {
+            if (flow > 0) result.emplace_back(i, j, flow);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+SolutionDiff CompareSolutions(const CuttingSolution& left, const CuttingSolution& right) {
+    QElapsedTimer timer;
+    timer.start();
+
+    SolutionDiff diff;
+    const int left_count = static_cast<int>(left.stocks.size());
+    const int right_count = static_cast<int>(right.stocks.size());
+    diff.left_patterns = left_count;
+    diff.right_patterns = right_count;
+
+    // 每个切割方式的子板构成; 利用率取方案中记录的 StockData::utilization, 与切割视图一致
+    std::vector<PatternProfile> left_profiles(left_count);
+    std::vector<PatternProfile> right_profiles(right_count);
+    for (int i = 0; i < left_count; i++) left_profiles[i] = BuildProfile(left.stocks[i]);
+    for (int i = 0; i < right_count; i++) right_profiles[i] = BuildProfile(right.stocks[i]);
+    std::vector<int> left_rest(left_count);
+    std::vector<int> right_rest(right_count);
+    double left_utilization_sum = 0;
+    double right_utilization_sum = 0;
+    for (int i = 0; i < left_count; i++) {
+        left_rest[i] = left.stocks[i].multiplicity;
+        diff.left_sheets += left_rest[i];
+        left_utilization_sum += left.stocks[i].utilization * left_rest[i];
+    }
+    for (int i = 0; i < right_count; i++) {
+        right_rest[i] = right.stocks[i].multiplicity;
+        diff.right_sheets += right_rest[i];
+        right_utilization_sum += right.stocks[i].utilization * right_rest[i];
+    }
+    if (diff.left_sheets > 0) diff.left_utilization = left_utilization_sum / diff.left_sheets;
+    if (diff.right_sheets > 0) diff.right_utilization = right_utilization_sum / diff.right_sheets;
+
+    // 内容相同的切割方式按张数直接配对
+    std::vector<DiffPair> identical;
+    PatternTable table;
+    table.Reserve(left_count);
+    for (const StockData& stock : left.stocks) table.Add(stock);
+    for (int r = 0; r < right_count; r++) {
+        int l = table.Find(right.stocks[r]);
+        if (l < 0) continue;
+        int count = std::min(left_rest[l], right_rest[r]);
+        diff.common_patterns++;
+        diff.common_sheets += count;
+        left_rest[l] -= count;
+        right_rest[r] -= count;
+        identical.push_back(DiffPair{l, r, count, 0.0,
+                                     right.stocks[r].utilization - left.stocks[l].utilization, true});
+    }
+
+    // 其余母板按切割方式求运输问题: 张数为供给与需求, 代价为差异度
+    std::vector<int> left_slots;        // 第 a 行对应的左侧切割方式
+    std::vector<int> right_slots;
+    std::vector<int> supply;
+    std::vector<int> demand;
+    for (int i = 0; i < left_count; i++) {
+        if (left_rest[i] <= 0) continue;
+        left_slots.push_back(i);
+        supply.push_back(left_rest[i]);
+    }
+    for (int i = 0; i < right_count; i++) {
+        if (right_rest[i] <= 0) continue;
+        right_slots.push_back(i);
+        demand.push_back(right_rest[i]);
+    }
+
+    const int row_count = static_cast<int>(left_slots.size());
+    const int col_count = static_cast<int>(right_slots.size());
+    std::vector<int> pair_cost(static_cast<size_t>(row_count) * col_count);
+    std::vector<int> slot_rows(row_count);
+    std::iota(slot_rows.begin(), slot_rows.end(), 0);
+    // 每个任务只写入自己的一行
+    QtConcurrent::blockingMap(slot_rows, [&](int a) {
+        const int l = left_slots[a];
+        for (int b = 0; b < col_count; b++) {
+            const int r = right_slots[b];
+            double d = PatternDifference(left_profiles[l], right_profiles[r]);
+            // 内容不同的切割方式代价至少为 1 (只有条带不同时差异度可能为 0)
+            pair_cost[static_cast<size_t>(a) * col_count + b] = std::max(1, static_cast<int>(d * kCostScale + 0.5));
+        }
+    });
+
+    // 两侧张数不等时补一个虚拟行或虚拟列吸收差额, 其张数固定, 代价取 0 不影响最优配对
+    const int left_rest_sheets = std::accumulate(supply.begin(), supply.end(), 0);
+    const int right_rest_sheets = std::accumulate(demand.begin(), demand.end(), 0);
+    if (left_rest_sheets < right_rest_sheets) supply.push_back(right_rest_sheets - left_rest_sheets);
+    if (right_rest_sheets < left_rest_sheets) demand.push_back(left_rest_sheets - right_rest_sheets);
+    diff.transport_left = row_count;
+    diff.transport_right = col_count;
+    diff.transport_sheets = std::max(left_rest_sheets, right_rest_sheets);
+    auto flows = SolveTransport(std::move(supply), std::move(demand), [&](int a, int b) {
+        return a < row_count && b < col_count ? pair_cost[static_cast<size_t>(a) * col_count + b] : 0;
+    });
+
+    std::sort(flows.begin(), flows.end());
+
+    std::vector<DiffPair> changed;
+    std::vector<DiffPair> left_only;
+    std::vector<DiffPair> right_only;
+    double difference_sum = 0;
+    for (const auto& [a, b, count] : flows) {
+        const int l = a < row_count ? left_slots[a] : -1;
+        const int r = b < col_count ? right_slots[b] : -1;
+        if (r < 0) {
+            left_only.push_back(DiffPair{l, -1, count, 1.0, 0.0});
+            diff.left_only_sheets += count;
+        } else if (l < 0) {
+            right_only.push_back(DiffPair{-1, r, count, 1.0, 0.0});
+            diff.right_only_sheets += count;
+        } else {
+            double d = PatternDifference(left_profiles[l], right_profiles[r]);
+            changed.push_back(DiffPair{l, r, count, d,
+                                       right.stocks[r].utilization - left.stocks[l].utilization});
+            diff.changed_sheets += count;
+            difference_sum += d * count;
+        }
+    }
+    std::stable_sort(changed.begin(), changed.end(), [](const DiffPair& a, const DiffPair& b) {
+        return a.difference > b.difference;
+    });
+    int matched = diff.common_sheets + diff.changed_sheets;
+    diff.mean_difference = matched > 0 ? difference_sum / matched : 0.0;
+
+    diff.pairs = std::move(changed);
+    diff.pairs.insert(diff.pairs.end(), left_only.begin(), left_only.end());
+    diff.pairs.insert(diff.pairs.end(), right_only.begin(), right_only.end());
+    diff.pairs.insert(diff.pairs.end(), identical.begin(), identical.end());
+    diff.elapsed_ms = timer.elapsed();
+    return diff;
+}
+
+void DiffPatternItems(const StockData& left, const StockData& right,
+                      std::vector<char>* left_changed, std::vector<char>* right_changed) {
+    left_changed->assign(left.items.size(), 1);
+    right_changed->assign(right.items.size(), 1);
+    size_t i = 0;
+    size_t j = 0;
+    while (i < left.items.size() && j < right.items.size()) {
+        if (ItemLess(left.items[i], right.items[j])) {
+            i++;
+        } else if (ItemLess(right.items[j], left.items[i])) {
+            j++;
+        } else {
+            (*left_changed)[i++] = 0;
+            (*right_changed)[j++] = 0;
+        }
+    }
+}
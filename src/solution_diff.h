@@ -0,0 +1,63 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_diff.h - 同一算例两个解的切割方式对比
+// 两个解的母板按切割方式相似度做最小代价匹配:
+//   内容完全相同的切割方式 (PatternTable) 先按张数直接配对, 代价为 0;
+//   其余母板按切割方式求最小费用运输问题 (张数为供给与需求, 代价为两切割方式的差异度),
+//   两侧张数不等时补一个虚拟切割方式吸收差额, 配给虚拟切割方式的即为只在一侧出现的母板
+// 差异度与最短路都在切割方式之间计算, 时间与内存只取决于切割方式数, 与重复次数无关
+// 差异度 = (1 - 位置相同的子板面积占比 + 1 - 子板类型面积构成的重合比例) / 2, 取值 [0, 1]
+
+#ifndef SOLUTION_DIFF_H_
+#define SOLUTION_DIFF_H_
+
+#include <QtGlobal>
+#include <vector>
+#include "cutting_data.h"
+
+// 一组配对 (同一对切割方式的多张母板合并)
+struct DiffPair {
+    int left = -1;                  // 左侧切割方式下标, -1 表示只在右侧出现
+    int right = -1;                 // 右侧切割方式下标, -1 表示只在左侧出现
+    int count = 0;                  // 张数
+    double difference = 0;          // 差异度 [0, 1], 未配对时为 1
+    double utilization_delta = 0;   // 右侧利用率 - 左侧利用率 (单张)
+    bool identical = false;         // 内容完全相同 (只有条带不同时差异度也可能为 0)
+};
+
+struct SolutionDiff {
+    // 有变化的配对按差异度降序, 其后为只在左侧、只在右侧与内容相同的配对
+    std::vector<DiffPair> pairs;
+
+    int left_sheets = 0;
+    int right_sheets = 0;
+    int left_patterns = 0;
+    int right_patterns = 0;
+    int common_patterns = 0;        // 两侧都使用的切割方式数
+    int common_sheets = 0;          // 内容相同的配对张数
+    int changed_sheets = 0;         // 配对但内容不同的张数
+    int left_only_sheets = 0;
+    int right_only_sheets = 0;
+    double left_utilization = 0;    // 按张数加权的 StockData::utilization
+    double right_utilization = 0;
+    double mean_difference = 0;     // 配对母板的平均差异度
+    int transport_left = 0;         // 参与运输问题的切割方式数 (不含虚拟切割方式)
+    int transport_right = 0;
+    int transport_sheets = 0;       // 参与运输问题的张数 (较多一侧)
+    qint64 elapsed_ms = 0;
+};
+
+// 两个解须为同一算例 (母板尺寸相同); 各自的切割方式已是规范顺序 (加载时去重)
+SolutionDiff CompareSolutions(const CuttingSolution& left, const CuttingSolution& right);
+
+// 两个切割方式中位置、尺寸与类型完全相同的子板视为未变, 其余标记为 1 (下标与 items 相同)
+void DiffPatternItems(const StockData& left, const StockData& right,
+                      std::vector<char>* left_changed, std::vector<char>* right_changed);
+
+#endif  // SOLUTION_DIFF_H_
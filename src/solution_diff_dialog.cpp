@@ -0,0 +1,337 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_diff_dialog.cpp - 方案对比对话框实现
+
+#include "solution_diff_dialog.h"
+#include "stock_renderer.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QSplitter>
+#include <QLabel>
+#include <QCheckBox>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTableWidgetItem>
+#include <QHeaderView>
+#include <QPainter>
+#include <QFileInfo>
+#include <QtConcurrent>
+#include <algorithm>
+
+// 单个切割方式的预览, 有变化的子板叠加高亮
+class DiffStockView : public QWidget {
+public:
+    explicit DiffStockView(QWidget* parent) : QWidget(parent) {
+        setMinimumSize(240, 160);
+    }
+
+    // stock 为空表示另一侧没有对应的母板
+    void SetStock(const StockData* stock, int stock_width, int stock_length,
+                  std::vector<char> changed, const QString& title) {
+        stock_ = stock;
+        stock_width_ = stock_width;
+        stock_length_ = stock_length;
+        changed_ = std::move(changed);
+        title_ = title;
+        update();
+    }
+
+protected:
+    void paintEvent(QPaintEvent* event) override {
+        Q_UNUSED(event);
+        QPainter painter(this);
+        painter.fillRect(rect(), QColor(250, 250, 250));
+
+        QFontMetrics metrics = painter.fontMetrics();
+        painter.setPen(Qt::black);
+        painter.drawText(QRect(4, 2, width() - 8, metrics.height() + 4), Qt::AlignLeft | Qt::AlignVCenter, title_);
+        QRect draw_rect = rect().adjusted(4, metrics.height() + 8, -4, -4);
+        if (draw_rect.width() <= 0 || draw_rect.height() <= 0) return;
+
+        if (!stock_ || stock_width_ <= 0 || stock_length_ <= 0) {
+            painter.setPen(QPen(Qt::gray, 1));
+            painter.drawRect(draw_rect);
+            painter.drawText(draw_rect, Qt::AlignCenter, QString::fromUtf8("(无对应母板)"));
+            return;
+        }
+
+        StockRenderOptions options;
+        options.draw_dimensions = false;
+        DrawStock(painter, *stock_, stock_width_, stock_length_, draw_rect, options);
+
+        StockTransform t = ComputeStockTransform(stock_width_, stock_length_, draw_rect, options);
+        painter.setPen(QPen(QColor(230, 120, 0), 2));
+        painter.setBrush(QColor(255, 140, 0, 90));
+        for (size_t i = 0; i < changed_.size() && i < stock_->items.size(); i++) {
+            if (!changed_[i]) continue;
+            const ItemRect& item = stock_->items[i];
+            QPointF top_left = t.ToScreen(item.x, static_cast<double>(item.y) + item.width);
+            painter.drawRect(QRectF(top_left, QSizeF(std::max(3.0, item.length * t.scale),
+                                                     std::max(3.0, item.width * t.scale))));
+        }
+    }
+
+private:
+    const StockData* stock_ = nullptr;
+    int stock_width_ = 0;
+    int stock_length_ = 0;
+    std::vector<char> changed_;
+    QString title_;
+};
+
+struct SolutionDiffDialog::Comparison {
+    QString error;
+    std::shared_ptr<const CuttingSolution> right;
+    SolutionDiff diff;
+};
+
+namespace {
+
+constexpr int kPairColumns = 8;
+
+QString FormatPercent(double value) {
+    return QString("%1%").arg(value * 100, 0, 'f', 2);
+}
+
+// 利用率变化 (百分点, 带符号)
+QString FormatDelta(double delta) {
+    return QString("%1%2").arg(delta >= 0 ? "+" : "").arg(delta * 100, 0, 'f', 2);
+}
+
+}  // namespace
+
+SolutionDiffDialog::SolutionDiffDialog(std::shared_ptr<const CuttingSolution> left, const QString& left_name,
+                                       const QString& right_path, QWidget* parent)
+    : QDialog(parent)
+    , left_(std::move(left))
+    , left_name_(left_name)
+    , right_name_(QFileInfo(right_path).fileName()) {
+    setWindowTitle(QString::fromUtf8("方案对比"));
+    resize(1100, 780);
+    SetupUi();
+
+    // 读取与匹配在后台进行, 对话框保持响应
+    compare_watcher_ = new QFutureWatcher<std::shared_ptr<Comparison>>(this);
+    connect(compare_watcher_, &QFutureWatcher<std::shared_ptr<Comparison>>::finished,
+            this, &SolutionDiffDialog::OnCompareFinished);
+    std::shared_ptr<const CuttingSolution> left_solution = left_;
+    compare_watcher_->setFuture(QtConcurrent::run([left_solution, right_path]() {
+        auto comparison = std::make_shared<Comparison>();
+        auto right = std::make_shared<CuttingSolution>();
+        if (!LoadCuttingSolution(right_path, right.get(), &comparison->error)) return comparison;
+        if (right->stock_width != left_solution->stock_width || right->stock_length != left_solution->stock_length) {
+            comparison->error = QString::fromUtf8("母板尺寸不同 (%1 x %2 与 %3 x %4), 不是同一算例的解")
+                .arg(left_solution->stock_length).arg(left_solution->stock_width)
+                .arg(right->stock_length).arg(right->stock_width);
+            return comparison;
+        }
+        comparison->diff = CompareSolutions(*left_solution, *right);
+        comparison->right = std::move(right);
+        return comparison;
+    }));
+}
+
+SolutionDiffDialog::~SolutionDiffDialog() {
+    if (compare_watcher_->isRunning()) {
+        compare_watcher_->disconnect(this);
+        compare_watcher_->waitForFinished();
+    }
+}
+
+void SolutionDiffDialog::SetupUi() {
+    auto* main_layout = new QVBoxLayout(this);
+
+    summary_label_ = new QLabel(QString::fromUtf8("正在读取 %1 并匹配切割方式...").arg(right_name_), this);
+    summary_label_->setWordWrap(true);
+    main_layout->addWidget(summary_label_);
+
+    auto* option_layout = new QHBoxLayout();
+    only_changed_check_ = new QCheckBox(QString::fromUtf8("只显示有变化的配对"), this);
+    only_changed_check_->setChecked(true);
+    connect(only_changed_check_, &QCheckBox::toggled, this, &SolutionDiffDialog::FillPairTable);
+    option_layout->addWidget(only_changed_check_);
+    option_layout->addStretch();
+    main_layout->addLayout(option_layout);
+
+    auto* splitter = new QSplitter(Qt::Vertical, this);
+
+    pair_table_ = new QTableWidget(splitter);
+    pair_table_->setColumnCount(kPairColumns);
+    pair_table_->setHorizontalHeaderLabels({
+        QString::fromUtf8("左方案"), QString::fromUtf8("右方案"), QString::fromUtf8("张数"),
+        QString::fromUtf8("差异度"), QString::fromUtf8("左利用率"), QString::fromUtf8("右利用率"),
+        QString::fromUtf8("利用率变化"), QString::fromUtf8("变化子板 (左 / 右)")});
+    pair_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    pair_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    pair_table_->setSelectionMode(QAbstractItemView::SingleSelection);
+    pair_table_->verticalHeader()->setVisible(false);
+    pair_table_->horizontalHeader()->setSectionResizeMode(kPairColumns - 1, QHeaderView::Stretch);
+    pair_table_->setToolTip(QString::fromUtf8("选中一行并排显示两个切割方式; 双击在视图中打开左侧切割方式"));
+    connect(pair_table_, &QTableWidget::itemSelectionChanged, this, &SolutionDiffDialog::OnPairSelected);
+    connect(pair_table_, &QTableWidget::cellDoubleClicked, this, &SolutionDiffDialog::OnCellDoubleClicked);
+
+    auto* views = new QWidget(splitter);
+    auto* views_layout = new QHBoxLayout(views);
+    views_layout->setContentsMargins(0, 0, 0, 0);
+    left_view_ = new DiffStockView(views);
+    right_view_ = new DiffStockView(views);
+    views_layout->addWidget(left_view_);
+    views_layout->addWidget(right_view_);
+
+    splitter->addWidget(pair_table_);
+    splitter->addWidget(views);
+    splitter->setStretchFactor(0, 1);
+    splitter->setStretchFactor(1, 2);
+    main_layout->addWidget(splitter, 1);
+
+    auto* button_layout = new QHBoxLayout();
+    button_layout->addStretch();
+    auto* close_button = new QPushButton(QString::fromUtf8("关闭"), this);
+    connect(close_button, &QPushButton::clicked, this, &QDialog::accept);
+    button_layout->addWidget(close_button);
+    main_layout->addLayout(button_layout);
+}
+
+void SolutionDiffDialog::OnCompareFinished() {
+    std::shared_ptr<Comparison> comparison = compare_watcher_->result();
+    if (!comparison->error.isEmpty()) {
+        summary_label_->setText(QString::fromUtf8("无法对比: ") + comparison->error);
+        summary_label_->setStyleSheet("QLabel { color: #c62828; }");
+        return;
+    }
+    right_ = comparison->right;
+    diff_ = std::move(comparison->diff);
+
+    const SolutionDiff& d = diff_;
+    summary_label_->setText(QString::fromUtf8(
+        "左: %1 — %2 块母板, %3 种切割方式, 利用率 %4\n"
+        "右: %5 — %6 块母板, %7 种切割方式, 利用率 %8 (%9 个百分点)\n"
+        "两侧都使用的切割方式 %10 种, 内容相同的配对 %11 张; 配对但有变化 %12 张 (平均差异度 %13); "
+        "只在左侧 %14 张, 只在右侧 %15 张\n"
+        "其余 %16 / %17 种切割方式 (%18 张) 按最小费用运输问题匹配, 用时 %19 ms")
+        .arg(left_name_)
+        .arg(d.left_sheets)
+        .arg(d.left_patterns)
+        .arg(FormatPercent(d.left_utilization))
+        .arg(right_name_)
+        .arg(d.right_sheets)
+        .arg(d.right_patterns)
+        .arg(FormatPercent(d.right_utilization))
+        .arg(FormatDelta(d.right_utilization - d.left_utilization))
+        .arg(d.common_patterns)
+        .arg(d.common_sheets)
+        .arg(d.changed_sheets)
+        .arg(FormatPercent(d.mean_difference))
+        .arg(d.left_only_sheets)
+        .arg(d.right_only_sheets)
+        .arg(d.transport_left)
+        .arg(d.transport_right)
+        .arg(d.transport_sheets)
+        .arg(d.elapsed_ms));
+    FillPairTable();
+}
+
+void SolutionDiffDialog::FillPairTable() {
+    if (!right_) return;
+
+    rows_.clear();
+    for (int p = 0; p < static_cast<int>(diff_.pairs.size()); p++) {
+        if (!only_changed_check_->isChecked() || !diff_.pairs[p].identical) rows_.push_back(p);
+    }
+
+    std::vector<char> left_changed;
+    std::vector<char> right_changed;
+    pair_table_->blockSignals(true);
+    pair_table_->setUpdatesEnabled(false);
+    pair_table_->clearContents();
+    pair_table_->setRowCount(static_cast<int>(rows_.size()));
+    for (int row = 0; row < static_cast<int>(rows_.size()); row++) {
+        const DiffPair& pair = diff_.pairs[rows_[row]];
+        const StockData* l = pair.left >= 0 ? &left_->stocks[pair.left] : nullptr;
+        const StockData* r = pair.right >= 0 ? &right_->stocks[pair.right] : nullptr;
+
+        QString difference;
+        QString changed_items;
+        if (pair.identical) {
+            difference = QString::fromUtf8("相同");
+            changed_items = "0 / 0";
+        } else if (l && r) {
+            difference = FormatPercent(pair.difference);
+            DiffPatternItems(*l, *r, &left_changed, &right_changed);
+            changed_items = QString("%1 / %2")
+                .arg(std::count(left_changed.begin(), left_changed.end(), 1))
+                .arg(std::count(right_changed.begin(), right_changed.end(), 1));
+        } else {
+            difference = l ? QString::fromUtf8("只在左侧") : QString::fromUtf8("只在右侧");
+            changed_items = l ? QString("%1 / -").arg(l->items.size()) : QString("- / %1").arg(r->items.size());
+        }
+
+        const QString cells[] = {
+            l ? QString::fromUtf8("方案 %1").arg(pair.left + 1) : QString("-"),
+            r ? QString::fromUtf8("方案 %1").arg(pair.right + 1) : QString("-"),
+            QString::number(pair.count),
+            difference,
+            l ? FormatPercent(l->utilization) : QString("-"),
+            r ? FormatPercent(r->utilization) : QString("-"),
+            l && r ? FormatDelta(pair.utilization_delta) : QString("-"),
+            changed_items
+        };
+        for (int column = 0; column < kPairColumns; column++) {
+            auto* item = new QTableWidgetItem(cells[column]);
+            if (column >= 2) item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            if (column == 6 && l && r && pair.utilization_delta != 0) {
+                item->setForeground(pair.utilization_delta > 0 ? QColor(46, 125, 50) : QColor(198, 40, 40));
+            }
+            if (!(l && r)) item->setForeground(Qt::gray);
+            pair_table_->setItem(row, column, item);
+        }
+    }
+    if (!rows_.empty()) pair_table_->setCurrentCell(0, 0);
+    pair_table_->setUpdatesEnabled(true);
+    pair_table_->blockSignals(false);
+    OnPairSelected();
+}
+
+void SolutionDiffDialog::OnPairSelected() {
+    int row = pair_table_->currentRow();
+    if (!right_ || row < 0 || row >= static_cast<int>(rows_.size())) {
+        left_view_->SetStock(nullptr, 0, 0, {}, QString());
+        right_view_->SetStock(nullptr, 0, 0, {}, QString());
+        return;
+    }
+
+    const DiffPair& pair = diff_.pairs[rows_[row]];
+    const StockData* l = pair.left >= 0 ? &left_->stocks[pair.left] : nullptr;
+    const StockData* r = pair.right >= 0 ? &right_->stocks[pair.right] : nullptr;
+    std::vector<char> left_changed;
+    std::vector<char> right_changed;
+    if (l && r) {
+        DiffPatternItems(*l, *r, &left_changed, &right_changed);
+    } else if (l) {
+        left_changed.assign(l->items.size(), 1);
+    } else if (r) {
+        right_changed.assign(r->items.size(), 1);
+    }
+
+    QString suffix = QString::fromUtf8(" ×%1").arg(pair.count);
+    left_view_->SetStock(l, left_->stock_width, left_->stock_length, std::move(left_changed),
+                         l ? QString::fromUtf8("左: %1 方案 %2").arg(left_name_).arg(pair.left + 1) + suffix
+                           : QString::fromUtf8("左: %1").arg(left_name_));
+    right_view_->SetStock(r, right_->stock_width, right_->stock_length, std::move(right_changed),
+                          r ? QString::fromUtf8("右: %1 方案 %2").arg(right_name_).arg(pair.right + 1) + suffix
+                            : QString::fromUtf8("右: %1").arg(right_name_));
+}
+
+void SolutionDiffDialog::OnCellDoubleClicked(int row, int column) {
+    Q_UNUSED(column);
+    if (row >= 0 && row < static_cast<int>(rows_.size()) && diff_.pairs[rows_[row]].left >= 0) {
+        emit PatternActivated(diff_.pairs[rows_[row]].left);
+    }
+}
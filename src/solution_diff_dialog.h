@@ -0,0 +1,68 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_diff_dialog.h - 方案对比对话框
+// 在后台读取同一算例的另一个解文件并与当前方案做切割方式匹配 (solution_diff),
+// 概要给出相同切割方式数与利用率变化; 表格列出配对, 选中一行时左右并排显示两个切割方式, 有变化的子板高亮
+
+#ifndef SOLUTION_DIFF_DIALOG_H_
+#define SOLUTION_DIFF_DIALOG_H_
+
+#include <QDialog>
+#include <QFutureWatcher>
+#include <QString>
+#include <memory>
+#include <vector>
+#include "cutting_data.h"
+#include "solution_diff.h"
+
+class QCheckBox;
+class QLabel;
+class QTableWidget;
+class DiffStockView;
+
+class SolutionDiffDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    // left 为当前方案 (下标与视图相同), right_path 为对比的解文件
+    SolutionDiffDialog(std::shared_ptr<const CuttingSolution> left, const QString& left_name,
+                       const QString& right_path, QWidget* parent = nullptr);
+    ~SolutionDiffDialog() override;
+
+signals:
+    void PatternActivated(int pattern_index);   // 左侧切割方式
+
+private slots:
+    void OnCompareFinished();
+    void FillPairTable();
+    void OnPairSelected();
+    void OnCellDoubleClicked(int row, int column);
+
+private:
+    struct Comparison;                      // 后台结果: 右侧方案与对比结果 (或错误)
+
+    void SetupUi();
+
+    std::shared_ptr<const CuttingSolution> left_;
+    std::shared_ptr<const CuttingSolution> right_;
+    QString left_name_;
+    QString right_name_;
+    SolutionDiff diff_;
+    std::vector<int> rows_;                 // 表格行 -> diff_.pairs 下标
+
+    QFutureWatcher<std::shared_ptr<Comparison>>* compare_watcher_;
+
+    QLabel* summary_label_;
+    QCheckBox* only_changed_check_;
+    QTableWidget* pair_table_;
+    DiffStockView* left_view_;
+    DiffStockView* right_view_;
+};
+
+#endif  // SOLUTION_DIFF_DIALOG_H_
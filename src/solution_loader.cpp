@@ -0,0 +1,467 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_loader.cpp - 解文件逐批加载实现
+
+#include "solution_loader.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtConcurrent>
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+constexpr int kFirstChunkStocks = 16;       // 第一批母板数 (决定首屏时间)
+constexpr int kMaxChunkStocks = 1024;       // 此后每批加倍, 不超过此数
+
+// 文件中的一段 [begin, end)
+struct Range {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+};
+
+const char* SkipSpace(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    return p;
+}
+
+// p 指向开始的引号; 返回结束引号之后的位置, 格式错误返回 nullptr
+const char* SkipString(const char* p, const char* end) {
+    for (p++; p < end; p++) {
+        if (*p == '\\') {
+            p++;
+        } else if (*p == '"') {
+            return p + 1;
+        }
+    }
+    return nullptr;
+}
+
+// 跳过一个 JSON 值 (只匹配括号与字符串, 内容由 QJsonDocument 在解析时校验)
+const char* SkipValue(const char* p, const char* end) {
+    if (p >= end) return nullptr;
+    if (*p == '"') return SkipString(p, end);
+    if (*p != '{' && *p != '[') {
+        // 数字与 true / false / null
+        while (p < end && *p != ',' && *p != '}' && *p != ']' &&
+               *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') {
+            p++;
+        }
+        return p;
+    }
+
+    int depth = 0;
+    while (p < end) {
+        char c = *p;
+        if (c == '"') {
+            p = SkipString(p, end);
+            if (!p) return nullptr;
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (--depth == 0) return p + 1;
+        }
+        p++;
+    }
+    return nullptr;
+}
+
+// 顶层对象中的 stock、item_types 与 stocks 的位置
+// 遇到 stocks 时若表头已找到即停止, 不必跳过 (可能很大的) 母板数组
+bool ScanTopLevel(const char* p, const char* end, Range* stock, Range* item_types,
+                  const char** stocks) {
+    p = SkipSpace(p, end);
+    if (p >= end || *p != '{') return false;
+    p = SkipSpace(p + 1, end);
+
+    while (p < end && *p != '}') {
+        if (*p != '"') return false;
+        const char* key_end = SkipString(p, end);
+        if (!key_end) return false;
+        QByteArray key = QByteArray::fromRawData(p + 1, static_cast<qsizetype>(key_end - p - 2));
+
+        p = SkipSpace(key_end, end);
+        if (p >= end || *p != ':') return false;
+        p = SkipSpace(p + 1, end);
+
+        if (key == "stocks") {
+            *stocks = p;
+            if (stock->begin && item_types->begin) return true;
+        }
+        const char* value_end = SkipValue(p, end);
+        if (!value_end) return false;
+        if (key == "stock") {
+            *stock = Range{p, value_end};
+        } else if (key == "item_types") {
+            *item_types = Range{p, value_end};
+        }
+
+        p = SkipSpace(value_end, end);
+        if (p < end && *p == ',') p = SkipSpace(p + 1, end);
+    }
+    return p < end;
+}
+
+bool ParseRange(const Range& range, QJsonDocument* doc) {
+    QJsonParseError error;
+    *doc = QJsonDocument::fromJson(
+        QByteArray::fromRawData(range.begin, static_cast<qsizetype>(range.end - range.begin)), &error);
+    return error.error == QJsonParseError::NoError && !doc->isNull();
+}
+
+// stocks 数组的逐元素游标
+class ArrayCursor {
+public:
+    // p 指向数组开始; 不是数组时返回 false
+    bool Open(const char* p, const char* end) {
+        end_ = end;
+        p_ = SkipSpace(p, end);
+        if (p_ >= end_ || *p_ != '[') return false;
+        p_ = SkipSpace(p_ + 1, end_);
+        done_ = p_ < end_ && *p_ == ']';
+        return true;
+    }
+
+    bool done() const { return done_; }
+
+    // 取下一个元素, 格式错误返回 false
+    bool Next(Range* element) {
+        const char* value_end = SkipValue(p_, end_);
+        if (!value_end) return false;
+        *element = Range{p_, value_end};
+
+        p_ = SkipSpace(value_end, end_);
+        if (p_ >= end_) return false;
+        if (*p_ == ']') {
+            done_ = true;
+        } else if (*p_ == ',') {
+            p_ = SkipSpace(p_ + 1, end_);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+private:
+    const char* p_ = nullptr;
+    const char* end_ = nullptr;
+    bool done_ = true;
+};
+
+// 母板原文 (JSON 元素字节) 的 FNV-1a 64 位哈希
+unsigned long long HashRange(const Range& range) {
+    unsigned long long h = 14695981039346656037ULL;
+    for (const char* p = range.begin; p < range.end; p++) {
+        h ^= static_cast<unsigned char>(*p);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// 逐个解析母板元素, 条带与子板存入一块新的连续存储
+bool ParseRanges(const Range* elements, size_t count, std::vector<StockData>* stocks) {
+    QJsonArray stocks_array;
+    QJsonDocument doc;
+    for (size_t i = 0; i < count; i++) {
+        if (!ParseRange(elements[i], &doc) || !doc.isObject()) return false;
+        stocks_array.append(doc.object());
+    }
+    *stocks = ParseStocks(stocks_array);
+    return true;
+}
+
+// 映射到内存的解文件: 打开时解析表头, stocks 数组中的母板由游标逐个定位
+class SolutionFile {
+public:
+    bool Open(const QString& path, QString* error) {
+        file_.setFileName(path);
+        if (!file_.open(QIODevice::ReadOnly)) {
+            *error = QString::fromUtf8("无法打开文件: ") + path;
+            return false;
+        }
+        *error = QString::fromUtf8("JSON 解析错误: ") + path;
+
+        // 映射到内存 (映射失败时整体读入)
+        const char* data = reinterpret_cast<const char*>(file_.map(0, file_.size()));
+        const char* end = data ? data + file_.size() : nullptr;
+        if (!data) {
+            buffer_ = file_.readAll();
+            data = buffer_.constData();
+            end = data + buffer_.size();
+        }
+
+        Range stock_range;
+        Range types_range;
+        const char* stocks_begin = nullptr;
+        if (!ScanTopLevel(data, end, &stock_range, &types_range, &stocks_begin)) return false;
+
+        // 表头按 LoadCuttingSolution 的规则解析 (不含母板的根对象)
+        QJsonObject root;
+        QJsonDocument doc;
+        if (stock_range.begin) {
+            if (!ParseRange(stock_range, &doc)) return false;
+            root["stock"] = doc.object();
+        }
+        if (types_range.begin) {
+            if (!ParseRange(types_range, &doc)) return false;
+            root["item_types"] = doc.array();
+        }
+        ParseCuttingSolution(root, &header_);
+
+        // 缺少 stocks 或不是数组时与 LoadCuttingSolution 相同, 视为没有母板
+        if (stocks_begin) cursor_.Open(stocks_begin, end);
+        error->clear();
+        return true;
+    }
+
+    CuttingSolution& header() { return header_; }
+    ArrayCursor& cursor() { return cursor_; }
+
+    // 取出至多 limit 个母板元素追加到 elements, 格式错误返回 false
+    bool Collect(std::vector<Range>& elements, size_t limit) {
+        Range element;
+        while (!cursor_.done() && elements.size() < limit) {
+            if (!cursor_.Next(&element)) return false;
+            elements.push_back(element);
+        }
+        return true;
+    }
+
+private:
+    QFile file_;
+    QByteArray buffer_;
+    CuttingSolution header_;
+    ArrayCursor cursor_;
+};
+
+}  // namespace
+
+void LoadCuttingSolutionChunked(const QString& json_path,
+                                const std::function<bool(SolutionChunk&&)>& publish) {
+    auto fail = [&publish](const QString& message) {
+        SolutionChunk chunk;
+        chunk.error = message;
+        publish(std::move(chunk));
+    };
+
+    SolutionFile file;
+    QString error;
+    if (!file.Open(json_path, &error)) {
+        fail(error);
+        return;
+    }
+    const QString parse_error = QString::fromUtf8("JSON 解析错误: ") + json_path;
+    const int stock_width = file.header().stock_width;
+    const int stock_length = file.header().stock_length;
+
+    SolutionChunk chunk;
+    chunk.has_header = true;
+    chunk.stock_width = stock_width;
+    chunk.stock_length = stock_length;
+    chunk.item_types = std::move(file.header().item_types);
+
+    PatternTable table;
+    // 去重表引用的存储: 界面可能在加载结束前丢弃已发布的切割方式
+    std::vector<std::shared_ptr<SolutionArena>> arenas;
+    int loaded = 0;
+    int total = -1;
+
+    // 解析一批母板, 与已发布的切割方式去重后发布
+    auto publish_range = [&](const Range* elements, int count) {
+        std::vector<StockData> parsed;
+        if (!ParseRanges(elements, count, &parsed)) {
+            fail(parse_error);
+            return false;
+        }
+
+        const int base = table.size();
+        chunk.fingerprints.reserve(count);
+        for (int i = 0; i < count; i++) {
+            StockData& stock = parsed[i];
+            int found = table.Insert(stock);
+            if (found < 0) {
+                found = base + static_cast<int>(chunk.stocks.size());
+                stock.stock_ids.push_back(stock.stock_id);
+                chunk.fingerprints.emplace_back(HashRange(elements[i]), StockFingerprint{found, stock.stock_id});
+                chunk.stocks.push_back(std::move(stock));
+                continue;
+            }
+            chunk.fingerprints.emplace_back(HashRange(elements[i]), StockFingerprint{found, stock.stock_id});
+            if (found >= base) {
+                StockData& pattern = chunk.stocks[found - base];
+                pattern.multiplicity++;
+                pattern.stock_ids.push_back(stock.stock_id);
+            } else {
+                chunk.repeats.emplace_back(found, stock.stock_id);
+            }
+        }
+        if (!chunk.stocks.empty()) {
+            if (chunk.stocks.size() < parsed.size()) {
+                PackStocks(chunk.stocks);
+                for (size_t k = 0; k < chunk.stocks.size(); k++) {
+                    table.Rebind(base + static_cast<int>(k), chunk.stocks[k]);
+                }
+            }
+            arenas.push_back(chunk.stocks.front().arena);
+        }
+
+        // 几何与索引: 每个任务只写入自己的切割方式
+        QtConcurrent::blockingMap(chunk.stocks, [stock_width, stock_length](StockData& stock) {
+            BuildCutGeometry(stock, stock_width, stock_length);
+            BuildItemIndex(stock, stock_width, stock_length);
+        });
+
+        loaded += count;
+        chunk.loaded = loaded;
+        chunk.total = total;
+        bool keep_going = publish(std::move(chunk));
+        chunk = SolutionChunk();
+        return keep_going;
+    };
+
+    // 第一批 (连同表头) 尽快发布
+    std::vector<Range> elements;
+    if (!file.Collect(elements, kFirstChunkStocks)) {
+        fail(parse_error);
+        return;
+    }
+    if (file.cursor().done()) total = static_cast<int>(elements.size());
+    if (!publish_range(elements.data(), static_cast<int>(elements.size())) || file.cursor().done()) return;
+
+    // 统计余下的母板 (只匹配括号), 之后每批加倍
+    elements.clear();
+    if (!file.Collect(elements, static_cast<size_t>(-1))) {
+        fail(parse_error);
+        return;
+    }
+    total = loaded + static_cast<int>(elements.size());
+
+    int chunk_size = kFirstChunkStocks;
+    for (size_t begin = 0; begin < elements.size();) {
+        chunk_size = std::min(chunk_size * 2, kMaxChunkStocks);
+        int count = static_cast<int>(std::min(elements.size() - begin, static_cast<size_t>(chunk_size)));
+        if (!publish_range(elements.data() + begin, count)) return;
+        begin += count;
+    }
+}
+
+SolutionReload ReloadCuttingSolution(const QString& json_path, const CuttingSolution& previous,
+                                     const SolutionFingerprint& previous_fingerprint) {
+    SolutionReload reload;
+    SolutionFile file;
+    if (!file.Open(json_path, &reload.error)) return reload;
+    const QString parse_error = QString::fromUtf8("JSON 解析错误: ") + json_path;
+
+    CuttingSolution& result = reload.solution;
+    result = std::move(file.header());
+    std::vector<Range> elements;
+    if (!file.Collect(elements, static_cast<size_t>(-1))) {
+        reload.error = parse_error;
+        return reload;
+    }
+    result.physical_stock_count = static_cast<int>(elements.size());
+
+    // 母板尺寸变化时几何全部失效, 不沿用
+    const bool same_size = previous.stock_width == result.stock_width &&
+                           previous.stock_length == result.stock_length;
+    const int previous_count = same_size ? static_cast<int>(previous.stocks.size()) : 0;
+
+    // 原文哈希与上一次相同的母板不再解析, 直接取其切割方式与母板ID
+    std::vector<unsigned long long> hashes(elements.size());
+    std::vector<StockFingerprint> known(elements.size());
+    std::vector<Range> changed;
+    for (size_t i = 0; i < elements.size(); i++) {
+        hashes[i] = HashRange(elements[i]);
+        auto it = previous_fingerprint.find(hashes[i]);
+        if (it != previous_fingerprint.end() && it->second.pattern >= 0 &&
+            it->second.pattern < previous_count) {
+            known[i] = it->second;
+        } else {
+            changed.push_back(elements[i]);
+        }
+    }
+    std::vector<StockData> parsed;
+    if (!ParseRanges(changed.data(), changed.size(), &parsed)) {
+        reload.error = parse_error;
+        return reload;
+    }
+    reload.reparsed = static_cast<int>(parsed.size());
+
+    // 去重表先登记旧的切割方式 (已是规范顺序), 新解析的母板与新旧切割方式一并去重
+    PatternTable table;
+    table.Reserve(previous_count + parsed.size());
+    for (int p = 0; p < previous_count; p++) table.Add(previous.stocks[p]);
+    std::vector<int> table_to_result(previous_count, -1);
+
+    size_t next_parsed = 0;
+    for (size_t i = 0; i < elements.size(); i++) {
+        int t = known[i].pattern;
+        int stock_id = known[i].stock_id;
+        StockData* stock = nullptr;
+        if (t < 0) {
+            stock = &parsed[next_parsed++];
+            stock_id = stock->stock_id;
+            t = table.Insert(*stock);
+            if (t < 0) {
+                t = table.size() - 1;
+                table_to_result.push_back(-1);
+            }
+        }
+
+        int& index = table_to_result[t];
+        if (index < 0) {
+            // 切割方式在本次首次出现: 旧的沿用几何与索引, 新的在下面计算
+            index = static_cast<int>(result.stocks.size());
+            if (t < previous_count) {
+                result.stocks.push_back(previous.stocks[t]);
+                reload.previous.push_back(t);
+            } else {
+                result.stocks.push_back(std::move(*stock));
+                reload.previous.push_back(-1);
+            }
+            StockData& pattern = result.stocks.back();
+            pattern.stock_id = stock_id;
+            pattern.multiplicity = 0;
+            pattern.stock_ids.clear();
+        }
+        StockData& pattern = result.stocks[index];
+        pattern.multiplicity++;
+        pattern.stock_ids.push_back(stock_id);
+        reload.fingerprint[hashes[i]] = StockFingerprint{index, stock_id};
+    }
+
+    // 新的切割方式搬到紧凑存储, 在线程池中计算几何与索引
+    std::vector<int> fresh;
+    for (size_t i = 0; i < result.stocks.size(); i++) {
+        if (reload.previous[i] < 0) fresh.push_back(static_cast<int>(i));
+    }
+    if (fresh.size() < parsed.size()) {
+        std::vector<StockData> packed;
+        packed.reserve(fresh.size());
+        for (int i : fresh) packed.push_back(std::move(result.stocks[i]));
+        PackStocks(packed);
+        for (size_t k = 0; k < fresh.size(); k++) result.stocks[fresh[k]] = std::move(packed[k]);
+    }
+    const int stock_width = result.stock_width;
+    const int stock_length = result.stock_length;
+    QtConcurrent::blockingMap(fresh, [&result, stock_width, stock_length](int index) {
+        BuildCutGeometry(result.stocks[index], stock_width, stock_length);
+        BuildItemIndex(result.stocks[index], stock_width, stock_length);
+    });
+
+    reload.changed = static_cast<int>(fresh.size());
+    reload.removed = static_cast<int>(previous.stocks.size()) - (static_cast<int>(result.stocks.size()) - reload.changed);
+    return reload;
+}
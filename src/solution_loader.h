@@ -0,0 +1,81 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_loader.h - 解文件逐批加载
+// 文件映射到内存后只做括号匹配定位顶层键与 stocks 数组中的每块母板, 每批母板单独解析 JSON,
+// 经增量去重 (PatternTable) 后计算几何与索引并立即发布. 第一批只含少量母板,
+// 首屏时间与文件大小无关; 母板总数在第一批发布后扫描统计 (只跳过括号与字符串)
+// 全部批次合并后的结果与 LoadCuttingSolution 相同 (切割方式顺序、重复次数与母板ID)
+//
+// 同一路径的解文件被改写时 (求解器输出新的解) 按母板原文的哈希与上一次加载比较:
+// 原文相同的母板不再解析, 其余母板解析后按切割方式内容与旧方案去重, 内容相同的切割方式沿用旧的几何与索引,
+// 只有新出现的切割方式需要计算几何与重新渲染
+
+#ifndef SOLUTION_LOADER_H_
+#define SOLUTION_LOADER_H_
+
+#include <QString>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "cutting_data.h"
+
+// 母板原文指纹: 所属切割方式 (按解文件中首次出现的顺序) 与母板ID
+struct StockFingerprint {
+    int pattern = -1;
+    int stock_id = 0;
+};
+
+// 母板原文 (JSON 元素字节) 的 64 位哈希 -> 指纹 (哈希视为唯一, 冲突概率可忽略)
+using SolutionFingerprint = std::unordered_map<unsigned long long, StockFingerprint>;
+
+// 一批加载结果
+struct SolutionChunk {
+    QString error;                          // 非空表示加载失败, 此后不再发布
+
+    // 母板尺寸与子板类型 (仅第一批)
+    bool has_header = false;
+    int stock_width = 0;
+    int stock_length = 0;
+    std::vector<ItemTypeSpec> item_types;
+
+    // 新出现的切割方式 (已计算几何与索引), 序号接在此前发布的之后
+    std::vector<StockData> stocks;
+
+    // 此前已发布的切割方式新增的母板: (切割方式序号, 母板ID), 重复次数各加一
+    std::vector<std::pair<int, int>> repeats;
+
+    // 本批母板的原文指纹 (供之后的增量重新加载)
+    std::vector<std::pair<unsigned long long, StockFingerprint>> fingerprints;
+
+    int loaded = 0;                         // 已读取的母板数 (去重前)
+    int total = -1;                         // 文件中的母板总数, -1 表示尚未统计
+};
+
+// 增量重新加载结果
+struct SolutionReload {
+    QString error;                          // 非空表示加载失败
+    CuttingSolution solution;
+    std::vector<int> previous;              // 每个切割方式在旧方案中的下标, -1 表示新出现
+    SolutionFingerprint fingerprint;        // 新方案的原文指纹
+    int changed = 0;                        // 新出现的切割方式数
+    int removed = 0;                        // 不再使用的旧切割方式数
+    int reparsed = 0;                       // 重新解析的母板数 (其余母板原文未变)
+};
+
+// 逐批读取解文件, 每批调用一次 publish (在调用线程中); publish 返回 false 时停止读取
+void LoadCuttingSolutionChunked(const QString& json_path,
+                                const std::function<bool(SolutionChunk&&)>& publish);
+
+// 与上一次加载的方案比较后重新加载 (阻塞, 可在工作线程中调用)
+// previous 的切割方式按解文件中首次出现的顺序, 与 previous_fingerprint 中的序号一致
+SolutionReload ReloadCuttingSolution(const QString& json_path, const CuttingSolution& previous,
+                                     const SolutionFingerprint& previous_fingerprint);
+
+#endif  // SOLUTION_LOADER_H_
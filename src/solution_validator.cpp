@@ -0,0 +1,311 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_validator.cpp - 切割方案校验实现
+
+#include "solution_validator.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+constexpr int kViolationKindCount = static_cast<int>(ViolationKind::kOverProduction) + 1;
+
+// 汇总违规: 计数全部, 每类只保存前 kMaxViolationsPerKind 条
+class ReportBuilder {
+public:
+    explicit ReportBuilder(ValidationReport& report) : report_(report) {}
+
+    void Add(const Violation& violation) {
+        if (violation.error) {
+            report_.error_count++;
+        } else {
+            report_.warning_count++;
+        }
+        int& stored = stored_[static_cast<int>(violation.kind)];
+        if (stored < kMaxViolationsPerKind) {
+            report_.violations.push_back(violation);
+            stored++;
+        }
+    }
+
+    void Add(ViolationKind kind, int stock_index, int item_index, int other_index = -1) {
+        Violation violation;
+        violation.kind = kind;
+        violation.stock_index = stock_index;
+        violation.item_index = item_index;
+        violation.other_index = other_index;
+        Add(violation);
+    }
+
+private:
+    ValidationReport& report_;
+    int stored_[kViolationKindCount] = {};
+};
+
+void CheckBounds(const StockData& stock, int stock_index, int stock_width, int stock_length,
+                 ReportBuilder& builder) {
+    for (int i = 0; i < static_cast<int>(stock.items.size()); i++) {
+        const ItemRect& item = stock.items[i];
+        if (item.width <= 0 || item.length <= 0 || item.x < 0 || item.y < 0 ||
+            static_cast<long long>(item.x) + item.length > stock_length ||
+            static_cast<long long>(item.y) + item.width > stock_width) {
+            builder.Add(ViolationKind::kOutOfBounds, stock_index, i);
+        }
+    }
+}
+
+// 两阶段结构: 条带 (第一阶段) 与条带内子板 (第二阶段)
+void CheckGuillotine(const StockData& stock, int stock_index, int stock_width,
+                     ReportBuilder& builder) {
+    const auto& strips = stock.strips;
+    const auto& items = stock.items;
+
+    // 条带按 y 排序后, 相邻条带不得重叠
+    std::vector<int> strip_order(strips.size());
+    for (size_t i = 0; i < strip_order.size(); i++) strip_order[i] = static_cast<int>(i);
+    std::sort(strip_order.begin(), strip_order.end(),
+              [&](int a, int b) { return strips[a].y < strips[b].y; });
+
+    long long prev_top = LLONG_MIN;
+    for (int s : strip_order) {
+        const StripRect& strip = strips[s];
+        long long top = static_cast<long long>(strip.y) + strip.width;
+        if (strip.y < 0 || strip.width <= 0 || top > stock_width || strip.y < prev_top) {
+            builder.Add(ViolationKind::kStripInvalid, stock_index, -1, s);
+        }
+        prev_top = std::max(prev_top, top);
+    }
+
+    std::unordered_map<int, int> strip_of_id;
+    strip_of_id.reserve(strips.size());
+    for (int s = 0; s < static_cast<int>(strips.size()); s++) {
+        strip_of_id.emplace(strips[s].strip_id, s);
+    }
+
+    // 子板须位于所属条带内 (旧格式无条带ID时跳过)
+    std::vector<int> in_strip;
+    in_strip.reserve(items.size());
+    for (int i = 0; i < static_cast<int>(items.size()); i++) {
+        const ItemRect& item = items[i];
+        if (item.strip_id < 0) continue;
+
+        auto it = strip_of_id.find(item.strip_id);
+        if (it == strip_of_id.end()) {
+            builder.Add(ViolationKind::kStripMismatch, stock_index, i);
+            continue;
+        }
+        const StripRect& strip = strips[it->second];
+        if (item.y < strip.y ||
+            static_cast<long long>(item.y) + item.width > static_cast<long long>(strip.y) + strip.width) {
+            builder.Add(ViolationKind::kStripMismatch, stock_index, i, it->second);
+        }
+        in_strip.push_back(i);
+    }
+
+    // 第二阶段为贯穿条带的垂直切割: 同一条带内子板的 x 区间必须互不相交
+    std::sort(in_strip.begin(), in_strip.end(), [&](int a, int b) {
+        if (items[a].strip_id != items[b].strip_id) return items[a].strip_id < items[b].strip_id;
+        return items[a].x < items[b].x;
+    });
+    int reach_item = -1;
+    long long reach = LLONG_MIN;
+    for (size_t k = 0; k < in_strip.size(); k++) {
+        int i = in_strip[k];
+        const ItemRect& item = items[i];
+        if (k == 0 || items[in_strip[k - 1]].strip_id != item.strip_id) {
+            reach_item = -1;
+            reach = LLONG_MIN;
+        }
+        if (reach_item >= 0 && item.x < reach) {
+            builder.Add(ViolationKind::kNotGuillotine, stock_index, i, reach_item);
+        }
+        long long right = static_cast<long long>(item.x) + item.length;
+        if (right > reach) {
+            reach = right;
+            reach_item = i;
+        }
+    }
+}
+
+// 扫描线重叠检测: 活动集合中的 y 区间保持互不相交,
+// 新区间若与任一活动区间重叠, 必与其按 y 排序的前驱或后继重叠
+void CheckOverlaps(const StockData& stock, int stock_index, ReportBuilder& builder) {
+    const auto& items = stock.items;
+
+    std::vector<int> order;
+    order.reserve(items.size());
+    for (int i = 0; i < static_cast<int>(items.size()); i++) {
+        if (items[i].width > 0 && items[i].length > 0) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return items[a].x < items[b].x; });
+
+    using Expiry = std::pair<long long, int>;   // (右边界, 子板)
+    std::priority_queue<Expiry, std::vector<Expiry>, std::greater<Expiry>> expiring;
+    std::set<std::pair<int, int>> active;       // (下边界 y, 子板)
+
+    for (int i : order) {
+        const ItemRect& item = items[i];
+
+        // 右边界 <= 当前 x 的子板离开扫描线 (边界相接不算重叠)
+        while (!expiring.empty() && expiring.top().first <= item.x) {
+            int j = expiring.top().second;
+            expiring.pop();
+            active.erase({items[j].y, j});
+        }
+
+        long long top = static_cast<long long>(item.y) + item.width;
+        int other = -1;
+        auto next = active.lower_bound({item.y, INT_MIN});
+        if (next != active.end() && next->first < top) {
+            other = next->second;
+        } else if (next != active.begin()) {
+            auto prev = std::prev(next);
+            const ItemRect& p = items[prev->second];
+            if (static_cast<long long>(p.y) + p.width > item.y) other = prev->second;
+        }
+
+        if (other >= 0) {
+            builder.Add(ViolationKind::kOverlap, stock_index, i, other);
+            continue;   // 不加入活动集合, 保持其互不相交
+        }
+        active.insert({item.y, i});
+        expiring.push({static_cast<long long>(item.x) + item.length, i});
+    }
+}
+
+}  // namespace
+
+ValidationReport ValidateSolution(const CuttingSolution& solution) {
+    QElapsedTimer timer;
+    timer.start();
+
+    ValidationReport report;
+    ReportBuilder builder(report);
+
+    std::unordered_map<int, const ItemTypeSpec*> spec_of_type;
+    spec_of_type.reserve(solution.item_types.size());
+    for (const auto& spec : solution.item_types) {
+        spec_of_type.emplace(spec.type_id, &spec);
+    }
+    std::unordered_map<int, long long> produced;
+
+    for (int s = 0; s < static_cast<int>(solution.stocks.size()); s++) {
+        const StockData& stock = solution.stocks[s];
+        report.item_count += static_cast<long long>(stock.items.size()) * stock.multiplicity;
+
+        CheckBounds(stock, s, solution.stock_width, solution.stock_length, builder);
+        CheckGuillotine(stock, s, solution.stock_width, builder);
+        CheckOverlaps(stock, s, builder);
+
+        // 类型与尺寸 (允许旋转 90 度)
+        for (int i = 0; i < static_cast<int>(stock.items.size()); i++) {
+            const ItemRect& item = stock.items[i];
+            produced[item.item_type] += stock.multiplicity;
+            if (spec_of_type.empty()) continue;
+
+            auto it = spec_of_type.find(item.item_type);
+            if (it == spec_of_type.end()) {
+                Violation v;
+                v.kind = ViolationKind::kUnknownType;
+                v.stock_index = s;
+                v.item_index = i;
+                v.item_type = item.item_type;
+                builder.Add(v);
+                continue;
+            }
+            const ItemTypeSpec& spec = *it->second;
+            if (spec.width <= 0 || spec.length <= 0) continue;
+            bool same = item.width == spec.width && item.length == spec.length;
+            bool rotated = item.width == spec.length && item.length == spec.width;
+            if (!same && !rotated) {
+                Violation v;
+                v.kind = ViolationKind::kSizeMismatch;
+                v.stock_index = s;
+                v.item_index = i;
+                v.item_type = item.item_type;
+                v.expected = spec.length;
+                v.actual = item.length;
+                builder.Add(v);
+            }
+        }
+    }
+
+    // 需求: 全局按类型比较
+    for (const auto& spec : solution.item_types) {
+        if (spec.demand < 0) continue;
+        auto it = produced.find(spec.type_id);
+        long long count = it == produced.end() ? 0 : it->second;
+        if (count == spec.demand) continue;
+
+        Violation v;
+        v.kind = count < spec.demand ? ViolationKind::kDemandShortfall : ViolationKind::kOverProduction;
+        v.error = count < spec.demand;
+        v.item_type = spec.type_id;
+        v.expected = spec.demand;
+        v.actual = count;
+        builder.Add(v);
+    }
+
+    report.elapsed_us = timer.nsecsElapsed() / 1000;
+    return report;
+}
+
+QString DescribeViolation(const Violation& violation, const std::vector<StockData>& stocks) {
+    QString where;
+    if (violation.stock_index >= static_cast<int>(stocks.size())) return QString();
+    if (violation.stock_index >= 0) {
+        where = QString::fromUtf8("方案 %1").arg(violation.stock_index + 1);
+    }
+
+    auto item_text = [&](int index) {
+        if (violation.stock_index < 0 || index < 0) return QString();
+        const auto& items = stocks[violation.stock_index].items;
+        if (index >= static_cast<int>(items.size())) return QString();
+        const ItemRect& item = items[index];
+        return QString::fromUtf8("T%1 (%2, %3, %4x%5)")
+            .arg(item.item_type).arg(item.x).arg(item.y).arg(item.length).arg(item.width);
+    };
+
+    switch (violation.kind) {
+        case ViolationKind::kOutOfBounds:
+            return where + QString::fromUtf8(": 子板 %1 超出母板").arg(item_text(violation.item_index));
+        case ViolationKind::kOverlap:
+            return where + QString::fromUtf8(": 子板 %1 与 %2 重叠")
+                .arg(item_text(violation.item_index), item_text(violation.other_index));
+        case ViolationKind::kStripInvalid:
+            return where + QString::fromUtf8(": 条带 %1 超出母板或与其他条带重叠")
+                .arg(violation.other_index >= 0 ?
+                     stocks[violation.stock_index].strips[violation.other_index].strip_id : -1);
+        case ViolationKind::kStripMismatch:
+            return where + QString::fromUtf8(": 子板 %1 不在所属条带内")
+                .arg(item_text(violation.item_index));
+        case ViolationKind::kNotGuillotine:
+            return where + QString::fromUtf8(": 子板 %1 与 %2 在条带内横向重叠, 无法两阶段切出")
+                .arg(item_text(violation.item_index), item_text(violation.other_index));
+        case ViolationKind::kUnknownType:
+            return where + QString::fromUtf8(": 子板类型 T%1 不在 item_types 中").arg(violation.item_type);
+        case ViolationKind::kSizeMismatch:
+            return where + QString::fromUtf8(": 子板 %1 尺寸与类型定义不符")
+                .arg(item_text(violation.item_index));
+        case ViolationKind::kDemandShortfall:
+            return QString::fromUtf8("类型 T%1 产出 %2, 少于需求 %3")
+                .arg(violation.item_type).arg(violation.actual).arg(violation.expected);
+        case ViolationKind::kOverProduction:
+            return QString::fromUtf8("类型 T%1 产出 %2, 多于需求 %3")
+                .arg(violation.item_type).arg(violation.actual).arg(violation.expected);
+    }
+    return QString();
+}
@@ -0,0 +1,65 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// solution_validator.h - 切割方案校验
+// 每次加载解文件时运行, 检查:
+//   越界     子板尺寸为正且位于母板内
+//   重叠     扫描线按 x 推进, 活动子板按 y 区间有序存放, 新区间只需与相邻区间比较
+//   两阶段   条带位于母板内且互不重叠; 子板位于所属条带内; 条带内子板 x 区间互不相交
+//   需求     各类型产出量 (按切割方式重复次数累计) 与 item_types 的需求量和尺寸比较
+// 全部检查为 O(n log n), 不依赖界面
+
+#ifndef SOLUTION_VALIDATOR_H_
+#define SOLUTION_VALIDATOR_H_
+
+#include <QString>
+#include <vector>
+#include "cutting_data.h"
+
+enum class ViolationKind {
+    kOutOfBounds,       // 子板超出母板或尺寸非正
+    kOverlap,           // 子板相互重叠
+    kStripInvalid,      // 条带超出母板或条带之间重叠
+    kStripMismatch,     // 子板不在所属条带内 (或条带ID不存在)
+    kNotGuillotine,     // 条带内子板在 x 方向重叠 (无法两阶段切出)
+    kUnknownType,       // 子板类型不在 item_types 中
+    kSizeMismatch,      // 子板尺寸与类型定义不符
+    kDemandShortfall,   // 产出少于需求
+    kOverProduction     // 产出多于需求 (警告)
+};
+
+struct Violation {
+    ViolationKind kind;
+    bool error = true;          // false 为警告
+    int stock_index = -1;       // 切割方式下标 (-1 为全局)
+    int item_index = -1;        // 子板下标
+    int other_index = -1;       // 重叠的另一子板 / 条带下标
+    int item_type = 0;
+    long long expected = 0;     // 需求类: 需求量 / 尺寸类: 类型长度
+    long long actual = 0;       // 需求类: 产出量 / 尺寸类: 子板长度
+};
+
+struct ValidationReport {
+    std::vector<Violation> violations;  // 每类最多保存 kMaxViolationsPerKind 条
+    int error_count = 0;                // 全部错误数 (含未保存的)
+    int warning_count = 0;
+    long long item_count = 0;
+    qint64 elapsed_us = 0;
+
+    bool ok() const { return error_count == 0; }
+};
+
+constexpr int kMaxViolationsPerKind = 1000;
+
+// 校验 (线程安全)
+ValidationReport ValidateSolution(const CuttingSolution& solution);
+
+// 违规描述 (界面显示)
+QString DescribeViolation(const Violation& violation, const std::vector<StockData>& stocks);
+
+#endif  // SOLUTION_VALIDATOR_H_
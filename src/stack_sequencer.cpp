@@ -0,0 +1,299 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stack_sequencer.cpp - 开放堆栈排序实现
+
+#include "stack_sequencer.h"
+
+#include <QElapsedTimer>
+#include <QtAlgorithms>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+constexpr double kExactTimeShare = 0.6;     // 精确搜索最多占用的时间比例 (其余留给局部搜索)
+constexpr int kMinStallMoves = 2000;        // 局部搜索连续无改进的移动次数下限
+
+// 顺序的评价: 先比较最大开放堆栈数, 再比较跨度总和
+struct StackCost {
+    int max_open = 0;
+    long long spread_sum = 0;
+
+    bool operator<(const StackCost& other) const {
+        if (max_open != other.max_open) return max_open < other.max_open;
+        return spread_sum < other.spread_sum;
+    }
+    bool operator<=(const StackCost& other) const { return !(other < *this); }
+};
+
+class StackProblem {
+public:
+    explicit StackProblem(const std::vector<StockData>& stocks) {
+        std::unordered_map<int, int> dense;
+        pattern_types_.resize(stocks.size());
+        for (size_t p = 0; p < stocks.size(); p++) {
+            std::vector<int>& types = pattern_types_[p];
+            for (const ItemRect& item : stocks[p].items) {
+                auto it = dense.emplace(item.item_type, static_cast<int>(dense.size())).first;
+                types.push_back(it->second);
+            }
+            std::sort(types.begin(), types.end());
+            types.erase(std::unique(types.begin(), types.end()), types.end());
+        }
+        type_count_ = static_cast<int>(dense.size());
+        first_.resize(type_count_);
+        last_.resize(type_count_);
+        delta_.resize(stocks.size() + 1);
+    }
+
+    int PatternCount() const { return static_cast<int>(pattern_types_.size()); }
+    int TypeCount() const { return type_count_; }
+    const std::vector<int>& Types(int pattern) const { return pattern_types_[pattern]; }
+
+    // O(切割方式数 + 类型出现次数)
+    StackCost Evaluate(const std::vector<int>& order) {
+        std::fill(first_.begin(), first_.end(), -1);
+        for (int pos = 0; pos < static_cast<int>(order.size()); pos++) {
+            for (int t : pattern_types_[order[pos]]) {
+                if (first_[t] < 0) first_[t] = pos;
+                last_[t] = pos;
+            }
+        }
+        std::fill(delta_.begin(), delta_.end(), 0);
+        StackCost cost;
+        for (int t = 0; t < type_count_; t++) {
+            if (first_[t] < 0) continue;
+            delta_[first_[t]]++;
+            delta_[last_[t] + 1]--;
+            cost.spread_sum += last_[t] - first_[t] + 1;
+        }
+        int open = 0;
+        for (int d : delta_) {
+            open += d;
+            cost.max_open = std::max(cost.max_open, open);
+        }
+        return cost;
+    }
+
+private:
+    std::vector<std::vector<int>> pattern_types_;   // 每个切割方式包含的类型 (稠密编号, 去重)
+    int type_count_ = 0;
+    std::vector<int> first_, last_, delta_;         // Evaluate 的工作区
+};
+
+// 贪心构造: 每步选择放入后仍开放的堆栈最少者; 并列时峰值低者、新开堆栈少者优先
+std::vector<int> GreedyOrder(const StackProblem& problem) {
+    const int n = problem.PatternCount();
+    std::vector<int> remaining_count(problem.TypeCount(), 0);
+    for (int p = 0; p < n; p++) {
+        for (int t : problem.Types(p)) remaining_count[t]++;
+    }
+    std::vector<char> opened(problem.TypeCount(), 0);
+    std::vector<char> used(n, 0);
+    std::vector<int> order;
+    order.reserve(n);
+    int open_count = 0;
+
+    for (int step = 0; step < n; step++) {
+        int best = -1;
+        int best_after = 0, best_peak = 0, best_new = 0;
+        for (int p = 0; p < n; p++) {
+            if (used[p]) continue;
+            int opened_now = 0, closed = 0;
+            for (int t : problem.Types(p)) {
+                if (!opened[t]) opened_now++;
+                if (remaining_count[t] == 1) closed++;
+            }
+            int peak = open_count + opened_now;
+            int after = peak - closed;
+            if (best < 0 || after < best_after ||
+                (after == best_after && (peak < best_peak ||
+                                         (peak == best_peak && opened_now < best_new)))) {
+                best = p;
+                best_after = after;
+                best_peak = peak;
+                best_new = opened_now;
+            }
+        }
+        used[best] = 1;
+        order.push_back(best);
+        for (int t : problem.Types(best)) {
+            if (!opened[t]) {
+                opened[t] = 1;
+                open_count++;
+            }
+            if (--remaining_count[t] == 0) open_count--;
+        }
+    }
+    return order;
+}
+
+// 精确搜索 (切割方式不超过 64 个): 已完成集合 S 之后放入 p 时的开放堆栈数只取决于 S 与 p,
+// 即 |types(p) ∪ (types(S) ∩ types(其余))|; 逐步降低上界, 直到无解 (证明最优) 或超时
+class ExactSearch {
+public:
+    ExactSearch(const StackProblem& problem, const QElapsedTimer& timer, qint64 deadline_ms)
+        : problem_(problem), timer_(timer), deadline_ms_(deadline_ms),
+          n_(problem.PatternCount()), words_((problem.TypeCount() + 63) / 64) {
+        masks_.assign(static_cast<size_t>(n_) * words_, 0);
+        for (int p = 0; p < n_; p++) {
+            for (int t : problem.Types(p)) masks_[p * words_ + t / 64] |= quint64(1) << (t % 64);
+        }
+        full_ = n_ == 64 ? ~quint64(0) : (quint64(1) << n_) - 1;
+    }
+
+    // 返回 true 表示 best_max 已证明最优; order 为找到的最好顺序 (可能未变)
+    bool Run(std::vector<int>& order, int& best_max) {
+        std::vector<int> sequence;
+        sequence.reserve(n_);
+        while (best_max > 0) {
+            bound_ = best_max;
+            sequence.clear();
+            found_max_ = 0;
+            if (!Dfs(0, sequence)) return !timed_out_;
+            order = sequence;
+            best_max = found_max_;
+        }
+        return true;
+    }
+
+private:
+    void UnionOf(quint64 set, quint64* out) const {
+        std::fill(out, out + words_, 0);
+        while (set) {
+            int p = static_cast<int>(qCountTrailingZeroBits(set));
+            set &= set - 1;
+            for (int w = 0; w < words_; w++) out[w] |= masks_[p * words_ + w];
+        }
+    }
+
+    bool Dfs(quint64 done, std::vector<int>& sequence) {
+        if (done == full_) return true;
+        if (failed_.count(done)) return false;
+        if ((++nodes_ & 1023) == 0 && timer_.elapsed() > deadline_ms_) timed_out_ = true;
+        if (timed_out_) return false;
+
+        std::vector<quint64> done_types(words_), rest_types(words_);
+        UnionOf(done, done_types.data());
+
+        // 候选按开放堆栈数排序, 先尝试最有希望的
+        std::vector<std::pair<int, int>> candidates;   // (开放堆栈数, 切割方式)
+        quint64 todo = full_ & ~done;
+        for (quint64 set = todo; set; set &= set - 1) {
+            int p = static_cast<int>(qCountTrailingZeroBits(set));
+            UnionOf(todo & ~(quint64(1) << p), rest_types.data());
+            int open = 0;
+            for (int w = 0; w < words_; w++) {
+                open += qPopulationCount(masks_[p * words_ + w] | (done_types[w] & rest_types[w]));
+            }
+            if (open < bound_) candidates.emplace_back(open, p);
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (const auto& [open, p] : candidates) {
+            sequence.push_back(p);
+            if (Dfs(done | (quint64(1) << p), sequence)) {
+                found_max_ = std::max(found_max_, open);
+                return true;
+            }
+            sequence.pop_back();
+            if (timed_out_) return false;
+        }
+        // 上界只会降低, 在较高上界下无解的状态在之后也无解
+        failed_.insert(done);
+        return false;
+    }
+
+    const StackProblem& problem_;
+    const QElapsedTimer& timer_;
+    qint64 deadline_ms_;
+    int n_;
+    int words_;
+    std::vector<quint64> masks_;
+    quint64 full_ = 0;
+    int bound_ = 0;
+    int found_max_ = 0;
+    long long nodes_ = 0;
+    bool timed_out_ = false;
+    std::unordered_set<quint64> failed_;
+};
+
+// 局部搜索: 随机取出一个切割方式插入到另一位置, 不变差即接受 (允许平移以跨过平台)
+void ImproveByRelocation(StackProblem& problem, std::vector<int>& order, StackCost& cost,
+                         const QElapsedTimer& timer, qint64 deadline_ms) {
+    const int n = static_cast<int>(order.size());
+    if (n < 3) return;
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    const int stall_limit = std::max(kMinStallMoves, 20 * n);
+    std::vector<int> candidate;
+    int stall = 0;
+
+    while (stall < stall_limit && timer.elapsed() < deadline_ms) {
+        int from = pick(rng);
+        int to = pick(rng);
+        if (from == to) continue;
+        candidate = order;
+        int moved = candidate[from];
+        candidate.erase(candidate.begin() + from);
+        candidate.insert(candidate.begin() + to, moved);
+
+        StackCost next = problem.Evaluate(candidate);
+        stall = next < cost ? 0 : stall + 1;
+        if (next <= cost) {
+            order.swap(candidate);
+            cost = next;
+        }
+    }
+}
+
+}  // namespace
+
+StackSequenceResult SequenceForOpenStacks(const std::vector<StockData>& stocks,
+                                          const StackSequenceOptions& options) {
+    QElapsedTimer timer;
+    timer.start();
+    const qint64 deadline_ms = static_cast<qint64>(options.time_limit_s * 1000.0);
+
+    StackSequenceResult result;
+    StackProblem problem(stocks);
+    const int n = problem.PatternCount();
+    const double type_count = std::max(1, problem.TypeCount());
+
+    std::vector<int> identity(n);
+    for (int i = 0; i < n; i++) identity[i] = i;
+    StackCost original = problem.Evaluate(identity);
+    result.original_max_open = original.max_open;
+    result.original_average_spread = original.spread_sum / type_count;
+
+    std::vector<int> order = GreedyOrder(problem);
+    StackCost cost = problem.Evaluate(order);
+    if (original < cost) {
+        order = identity;
+        cost = original;
+    }
+
+    if (options.exact && n <= kMaxExactPatterns && n > 0) {
+        ExactSearch search(problem, timer, static_cast<qint64>(deadline_ms * kExactTimeShare));
+        int best_max = cost.max_open;
+        result.proven_optimal = search.Run(order, best_max);
+        cost = problem.Evaluate(order);
+    }
+
+    // 保持最大开放堆栈数不变, 继续缩短跨度
+    ImproveByRelocation(problem, order, cost, timer, deadline_ms);
+
+    result.order = std::move(order);
+    result.max_open = cost.max_open;
+    result.average_spread = cost.spread_sum / type_count;
+    result.elapsed_ms = timer.elapsed();
+    return result;
+}
@@ -0,0 +1,45 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stack_sequencer.h - 最小化开放堆栈的母板排序 (MOSP)
+// 切割后每种子板类型占用一个堆栈, 从第一次产出到最后一次产出期间保持开放;
+// 重新排列切割方式的顺序, 使同时开放的堆栈数最少, 其次使各类型的跨度 (开放期间的切割方式数) 最短
+// 相同切割方式的母板总是连续切割 (不会增加开放堆栈), 因此只对去重后的切割方式排序
+//
+// 启发式: 每步选择放入后开放堆栈最少的切割方式 (并列时关闭类型多者优先), 再以随机插入移动局部搜索
+// 精确搜索: 切割方式不超过 64 个时, 按已完成集合做深度优先搜索并记录无解状态, 在时间限制内证明最优
+// 无界面依赖, 线程安全
+
+#ifndef STACK_SEQUENCER_H_
+#define STACK_SEQUENCER_H_
+
+#include <vector>
+#include "cutting_data.h"
+
+struct StackSequenceOptions {
+    double time_limit_s = 2.0;      // 局部搜索与精确搜索的总时间
+    bool exact = true;              // 切割方式不超过 kMaxExactPatterns 时尝试精确搜索
+};
+
+constexpr int kMaxExactPatterns = 64;
+
+struct StackSequenceResult {
+    std::vector<int> order;             // 新顺序 (切割方式下标)
+    int max_open = 0;                   // 最大开放堆栈数
+    double average_spread = 0;          // 各类型平均跨度 (切割方式数)
+    int original_max_open = 0;          // 原始顺序
+    double original_average_spread = 0;
+    bool proven_optimal = false;        // 最大开放堆栈数已被精确搜索证明最优
+    qint64 elapsed_ms = 0;
+};
+
+// 计算开放堆栈最少的顺序 (阻塞, 不超过时间限制)
+StackSequenceResult SequenceForOpenStacks(const std::vector<StockData>& stocks,
+                                          const StackSequenceOptions& options = StackSequenceOptions());
+
+#endif  // STACK_SEQUENCER_H_
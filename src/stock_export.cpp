@@ -0,0 +1,404 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stock_export.cpp - 切割方案批量导出实现
+
+#include "stock_export.h"
+#include "cut_program_export.h"
+#include "stock_renderer.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QFontMetrics>
+#include <QPageLayout>
+#include <QPageSize>
+#include <QPainter>
+#include <QPdfWriter>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr double kScreenDpi = 96.0;     // 逻辑坐标基准 (与屏幕绘制一致)
+constexpr int kDimensionMargin = 40;    // 母板下方与右侧尺寸标注所需空间 (逻辑像素)
+
+// 每批并行处理的母板数 (批间报告进度并检查取消, 同时限制内存中的结果数量)
+int BatchSize() {
+    return std::max(4, QThread::idealThreadCount() * 2);
+}
+
+QString PngPath(const QString& base, int index, int digits) {
+    return QString("%1_%2.png").arg(base).arg(index + 1, digits, 10, QChar('0'));
+}
+
+// ----- SVG -----
+
+// 模型坐标: 每块母板占一个区段, 顶部为标题带; 区段内 y 向下 = 模型 y 翻转
+QByteArray SvgNumber(double value) {
+    return QByteArray::number(value, 'g', 8);
+}
+
+QByteArray BuildSvgStock(const CuttingSolution& solution, int index, double origin_y,
+                         double title_height) {
+    const StockData& stock = solution.stocks[index];
+    const int w = solution.stock_width;
+    const int l = solution.stock_length;
+    const double top = origin_y + title_height;
+
+    QByteArray out;
+    out.reserve(static_cast<int>(stock.items.size()) * 96 + 512);
+
+    out += "<g id=\"stock" + QByteArray::number(index + 1) + "\">\n";
+
+    // 标题
+    out += "<text class=\"title\" x=\"0\" y=\"" + SvgNumber(origin_y + title_height * 0.7) + "\">";
+    out += QString::fromUtf8("方案 %1 / %2   ×%3   利用率 %4%   子板 %5")
+               .arg(index + 1).arg(solution.stocks.size())
+               .arg(stock.multiplicity)
+               .arg(stock.utilization * 100, 0, 'f', 1)
+               .arg(stock.items.size()).toUtf8();
+    out += "</text>\n";
+
+    // 母板底色
+    out += "<rect class=\"stock\" x=\"0\" y=\"" + SvgNumber(top) + "\" width=\"" +
+           QByteArray::number(l) + "\" height=\"" + QByteArray::number(w) + "\"/>\n";
+
+    // 子板 (颜色按调色板下标使用 CSS 类)
+    for (const auto& item : stock.items) {
+        int palette = ((item.item_type - 1) % 12 + 12) % 12;
+        out += "<rect class=\"p" + QByteArray::number(palette) + "\" x=\"" +
+               QByteArray::number(item.x) + "\" y=\"" +
+               SvgNumber(top + w - item.y - item.width) + "\" width=\"" +
+               QByteArray::number(item.length) + "\" height=\"" +
+               QByteArray::number(item.width) + "\"/>\n";
+    }
+
+    // 标签: 只标注相对母板足够大的子板
+    double font_size = std::max(1.0, std::min(l, w) / 40.0);
+    for (const auto& item : stock.items) {
+        if (item.length < font_size * 3 || item.width < font_size * 1.5) continue;
+        out += "<text class=\"label\" x=\"" + SvgNumber(item.x + item.length / 2.0) + "\" y=\"" +
+               SvgNumber(top + w - item.y - item.width / 2.0 + font_size * 0.35) + "\">T" +
+               QByteArray::number(item.item_type) + "</text>\n";
+    }
+
+    // 切割线: 每个阶段合并为一条路径
+    const CutGeometry& cuts = stock.cuts;
+    if (!cuts.stage1_y.empty()) {
+        out += "<path class=\"cut1\" d=\"";
+        for (int y : cuts.stage1_y) {
+            out += "M0 " + SvgNumber(top + w - y) + "H" + QByteArray::number(l);
+        }
+        out += "\"/>\n";
+    }
+    if (!cuts.stage2_x.empty()) {
+        out += "<path class=\"cut2\" d=\"";
+        for (size_t i = 0; i < cuts.stage2_x.size(); i++) {
+            out += "M" + QByteArray::number(cuts.stage2_x[i]) + " " +
+                   SvgNumber(top + w - cuts.stage2_y1[i]) + "V" +
+                   SvgNumber(top + w - cuts.stage2_y0[i]);
+        }
+        out += "\"/>\n";
+    }
+
+    out += "<rect class=\"border\" x=\"0\" y=\"" + SvgNumber(top) + "\" width=\"" +
+           QByteArray::number(l) + "\" height=\"" + QByteArray::number(w) + "\"/>\n";
+    out += "</g>\n";
+    return out;
+}
+
+StockExportResult ExportSvg(const CuttingSolution& solution, const QString& path,
+                            const StockExportOptions& options,
+                            const StockExportProgress& progress) {
+    StockExportResult result;
+    const int count = static_cast<int>(solution.stocks.size());
+    const int w = solution.stock_width;
+    const int l = solution.stock_length;
+
+    // 区段高度: 标题带 + 母板 + 间隔
+    const double title_height = std::max(1.0, l / 30.0);
+    const double gap = title_height * 0.5;
+    const double section = title_height + w + gap;
+    const double total_height = std::max(1.0, section * count - gap);
+    const double page_height_mm = options.page_width_mm * total_height / l;
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        result.error = QString::fromUtf8("无法写入文件: ") + path;
+        return result;
+    }
+
+    QByteArray header;
+    header += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    header += "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" +
+              SvgNumber(options.page_width_mm) + "mm\" height=\"" + SvgNumber(page_height_mm) +
+              "mm\" viewBox=\"0 0 " + QByteArray::number(l) + " " + SvgNumber(total_height) + "\">\n";
+    header += "<style>\n";
+    header += "rect{stroke:#000;stroke-width:0.5;vector-effect:non-scaling-stroke}\n";
+    header += ".stock{fill:#dcdcdc}\n.border{fill:none;stroke-width:2}\n";
+    for (int p = 0; p < 12; p++) {
+        header += ".p" + QByteArray::number(p) + "{fill:" +
+                  GetItemTypeColor(p + 1).name().toLatin1() + "}\n";
+    }
+    header += ".cut1{fill:none;stroke:#c83232;stroke-width:3;vector-effect:non-scaling-stroke}\n";
+    header += ".cut2{fill:none;stroke:#3264b4;stroke-width:3;vector-effect:non-scaling-stroke}\n";
+    header += "text{font-family:sans-serif}\n";
+    header += ".title{font-size:" + SvgNumber(title_height * 0.6) + "px}\n";
+    header += ".label{font-size:" + SvgNumber(std::max(1.0, std::min(l, w) / 40.0)) +
+              "px;text-anchor:middle}\n";
+    header += "</style>\n";
+    file.write(header);
+
+    // 各母板片段在线程池中并行生成, 按顺序写出 (文件只持有当前一批的片段)
+    const int batch = BatchSize();
+    for (int start = 0; start < count; start += batch) {
+        int end = std::min(count, start + batch);
+        std::vector<int> indices(end - start);
+        for (int i = start; i < end; i++) indices[i - start] = i;
+
+        QList<QByteArray> parts = QtConcurrent::blockingMapped<QList<QByteArray>>(
+            indices, [&solution, section, title_height](int index) {
+                return BuildSvgStock(solution, index, section * index, title_height);
+            });
+        for (const QByteArray& part : parts) {
+            if (file.write(part) != part.size()) {
+                result.error = QString::fromUtf8("写入失败: ") + path;
+                file.close();
+                file.remove();
+                return result;
+            }
+        }
+
+        if (progress && !progress(end, count)) {
+            result.cancelled = true;
+            file.close();
+            file.remove();
+            return result;
+        }
+    }
+
+    file.write("</svg>\n");
+    file.close();
+    if (file.error() != QFileDevice::NoError) {
+        result.error = QString::fromUtf8("写入失败: ") + path;
+        return result;
+    }
+
+    result.success = true;
+    result.files << path;
+    return result;
+}
+
+// ----- PDF -----
+
+StockExportResult ExportPdf(const CuttingSolution& solution, const QString& path,
+                            const StockExportProgress& progress) {
+    StockExportResult result;
+    const int count = static_cast<int>(solution.stocks.size());
+
+    // QPdfWriter 只能在一个线程中顺序绘制; 每页写完即输出到文件
+    // 矢量输出: 分辨率取 96 DPI, 逻辑坐标、线宽与字号与屏幕绘制一致
+    auto writer = std::make_unique<QPdfWriter>(path);
+    writer->setResolution(static_cast<int>(kScreenDpi));
+    writer->setCreator("CS-2D-GUI");
+    writer->setTitle(QFileInfo(path).completeBaseName());
+    writer->setPageLayout(QPageLayout(QPageSize(QPageSize::A4), QPageLayout::Landscape,
+                                      QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter));
+
+    auto painter = std::make_unique<QPainter>();
+    if (!painter->begin(writer.get())) {
+        result.error = QString::fromUtf8("无法写入文件: ") + path;
+        return result;
+    }
+
+    QRect page_rect(0, 0, writer->width(), writer->height());
+
+    for (int i = 0; i < count; i++) {
+        if (i > 0) writer->newPage();
+        painter->setRenderHint(QPainter::Antialiasing);
+        DrawStockPage(*painter, solution.stocks[i], i, count,
+                      solution.stock_width, solution.stock_length, page_rect);
+
+        if (progress && !progress(i + 1, count)) {
+            painter->end();
+            painter.reset();
+            writer.reset();
+            QFile::remove(path);
+            result.cancelled = true;
+            return result;
+        }
+    }
+
+    if (!painter->end()) {
+        result.error = QString::fromUtf8("写入失败: ") + path;
+        return result;
+    }
+    painter.reset();
+    writer.reset();
+
+    result.success = true;
+    result.files << path;
+    return result;
+}
+
+// ----- PNG -----
+
+StockExportResult ExportPng(const CuttingSolution& solution, const QString& path,
+                            const StockExportOptions& options,
+                            const StockExportProgress& progress) {
+    StockExportResult result;
+    const int count = static_cast<int>(solution.stocks.size());
+
+    QFileInfo info(path);
+    QString base = info.dir().filePath(info.completeBaseName());
+    int digits = std::max(3, static_cast<int>(QString::number(count).size()));
+
+    // 渲染与 PNG 压缩都在线程池中完成, 每个任务只触碰自己的 QImage
+    const int batch = BatchSize();
+    for (int start = 0; start < count; start += batch) {
+        int end = std::min(count, start + batch);
+        std::vector<int> indices(end - start);
+        for (int i = start; i < end; i++) indices[i - start] = i;
+
+        QList<bool> saved = QtConcurrent::blockingMapped<QList<bool>>(
+            indices, [&solution, &options, &base, digits](int index) {
+                QImage image = RenderStockPageImage(solution.stocks[index], index,
+                                                    static_cast<int>(solution.stocks.size()),
+                                                    solution.stock_width, solution.stock_length,
+                                                    options);
+                return !image.isNull() && image.save(PngPath(base, index, digits), "PNG");
+            });
+
+        for (int i = start; i < end; i++) {
+            result.files << PngPath(base, i, digits);
+        }
+
+        auto failed = std::find(saved.begin(), saved.end(), false);
+        if (failed != saved.end()) {
+            result.error = QString::fromUtf8("写入失败: ") +
+                           PngPath(base, start + static_cast<int>(failed - saved.begin()), digits);
+        } else if (progress && !progress(end, count)) {
+            result.cancelled = true;
+        }
+
+        if (!result.error.isEmpty() || result.cancelled) {
+            for (const QString& file : result.files) QFile::remove(file);
+            result.files.clear();
+            return result;
+        }
+    }
+
+    result.success = true;
+    return result;
+}
+
+}  // namespace
+
+StockExportFormat StockExportFormatFromPath(const QString& path) {
+    QString suffix = QFileInfo(path).suffix().toLower();
+    if (suffix == "pdf") return StockExportFormat::kPdf;
+    if (suffix == "svg") return StockExportFormat::kSvg;
+    if (suffix == "dxf") return StockExportFormat::kDxf;
+    if (suffix == "nc" || suffix == "gcode" || suffix == "cnc") return StockExportFormat::kCutProgram;
+    return StockExportFormat::kPng;
+}
+
+void DrawStockPage(QPainter& painter, const StockData& stock, int index, int total,
+                   int stock_width, int stock_length, const QRect& page_rect) {
+    QFont title_font = painter.font();
+    title_font.setPointSize(10);
+    painter.setFont(title_font);
+    int title_height = QFontMetrics(title_font, painter.device()).height() + 8;
+
+    painter.setPen(Qt::black);
+    painter.drawText(QRect(page_rect.left(), page_rect.top(), page_rect.width(), title_height),
+                     Qt::AlignLeft | Qt::AlignVCenter,
+                     QString::fromUtf8("方案 %1 / %2    ×%3    利用率 %4%    子板 %5    一阶段切割 %6    二阶段切割 %7")
+                         .arg(index + 1).arg(total)
+                         .arg(stock.multiplicity)
+                         .arg(stock.utilization * 100, 0, 'f', 1)
+                         .arg(stock.items.size())
+                         .arg(stock.cuts.Stage1Count())
+                         .arg(stock.cuts.Stage2Count()));
+
+    QRect stock_rect = page_rect.adjusted(0, title_height, 0, 0);
+    DrawStock(painter, stock, stock_width, stock_length, stock_rect);
+}
+
+QImage RenderStockPageImage(const StockData& stock, int index, int total,
+                            int stock_width, int stock_length,
+                            const StockExportOptions& options) {
+    if (stock_width <= 0 || stock_length <= 0) return QImage();
+
+    // 逻辑尺寸按 96 DPI 计算, 实际像素 = 逻辑尺寸 * dpi / 96
+    int width = static_cast<int>(options.page_width_mm / 25.4 * kScreenDpi);
+    int height = static_cast<int>(static_cast<double>(width) * stock_width / stock_length) +
+                 kDimensionMargin + 24;
+    height = std::max(height, 120);
+    qreal dpr = options.dpi / kScreenDpi;
+
+    QSize pixel_size = (QSizeF(width, height) * dpr).toSize();
+    QImage image(pixel_size, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+    image.fill(Qt::white);
+
+    // 写入 DPI 元数据, 便于按物理尺寸打印
+    int dots_per_meter = qRound(options.dpi / 0.0254);
+    image.setDotsPerMeterX(dots_per_meter);
+    image.setDotsPerMeterY(dots_per_meter);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    DrawStockPage(painter, stock, index, total, stock_width, stock_length,
+                  QRect(8, 4, width - 16, height - 8));
+    painter.end();
+
+    return image;
+}
+
+StockExportResult ExportStocks(const CuttingSolution& solution, const QString& path,
+                               const StockExportOptions& options,
+                               const StockExportProgress& progress) {
+    QElapsedTimer timer;
+    timer.start();
+
+    StockExportResult result;
+    if (solution.stocks.empty() || solution.stock_width <= 0 || solution.stock_length <= 0) {
+        result.error = QString::fromUtf8("暂无切割方案");
+        return result;
+    }
+
+    switch (options.format) {
+        case StockExportFormat::kPdf:
+            result = ExportPdf(solution, path, progress);
+            break;
+        case StockExportFormat::kSvg:
+            result = ExportSvg(solution, path, options, progress);
+            break;
+        case StockExportFormat::kDxf:
+            result = ExportStocksDxf(solution, path, progress);
+            break;
+        case StockExportFormat::kCutProgram:
+            result = ExportStocksCutProgram(solution, path, progress);
+            break;
+        default:
+            result = ExportPng(solution, path, options, progress);
+            break;
+    }
+
+    for (const QString& file : result.files) {
+        result.bytes += QFileInfo(file).size();
+    }
+    result.elapsed_ms = timer.elapsed();
+    return result;
+}
@@ -0,0 +1,72 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stock_export.h - 切割方案批量导出 (PNG / PDF / SVG)
+// 只使用 QImage / QPdfWriter 与手写 SVG, 不依赖控件, 可在工作线程或命令行 (offscreen) 中调用
+//
+// PNG: 每块母板一个文件 <名称>_001.png ..., 在线程池中并行渲染与压缩
+// PDF: 单个多页文件 (A4 横向), 每页一块母板, 逐页写出
+// SVG: 单个文件, 母板纵向排列; 各母板的 SVG 片段并行生成后按顺序写出
+// DXF / 切割程序 (.nc): 见 cut_program_export.h
+
+#ifndef STOCK_EXPORT_H_
+#define STOCK_EXPORT_H_
+
+#include <QImage>
+#include <QRect>
+#include <QString>
+#include <QStringList>
+#include <functional>
+#include "cutting_data.h"
+
+class QPainter;
+
+enum class StockExportFormat {
+    kPng,
+    kPdf,
+    kSvg,
+    kDxf,           // DXF 图形 (R12)
+    kCutProgram     // 两阶段切割程序 (G 代码)
+};
+
+struct StockExportOptions {
+    StockExportFormat format = StockExportFormat::kPng;
+    int dpi = 150;                  // PNG 像素密度 (PDF 与 SVG 为矢量输出)
+    double page_width_mm = 297.0;   // PNG 图片与 SVG 的物理宽度 (默认 A4 横向)
+};
+
+struct StockExportResult {
+    bool success = false;
+    bool cancelled = false;
+    QString error;
+    QStringList files;
+    qint64 bytes = 0;
+    qint64 elapsed_ms = 0;
+};
+
+// 进度回调 (在调用线程中执行): 返回 false 表示取消
+using StockExportProgress = std::function<bool(int done, int total)>;
+
+// 根据扩展名判断格式 (.pdf / .svg / .dxf / .nc .gcode .cnc, 其余为 PNG)
+StockExportFormat StockExportFormatFromPath(const QString& path);
+
+// 绘制一页: 顶部标题 (母板序号、利用率、子板数), 其余区域绘制母板
+void DrawStockPage(QPainter& painter, const StockData& stock, int index, int total,
+                   int stock_width, int stock_length, const QRect& page_rect);
+
+// 按导出选项渲染单块母板 (线程安全)
+QImage RenderStockPageImage(const StockData& stock, int index, int total,
+                            int stock_width, int stock_length,
+                            const StockExportOptions& options);
+
+// 导出全部母板 (阻塞, 取消时删除已写出的文件)
+StockExportResult ExportStocks(const CuttingSolution& solution, const QString& path,
+                               const StockExportOptions& options,
+                               const StockExportProgress& progress = StockExportProgress());
+
+#endif  // STOCK_EXPORT_H_
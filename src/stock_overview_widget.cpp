@@ -0,0 +1,317 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stock_overview_widget.cpp - 母板缩略图总览实现
+
+#include "stock_overview_widget.h"
+#include "stock_renderer.h"
+
+#include <QPainter>
+#include <QScrollBar>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QResizeEvent>
+#include <QtConcurrent>
+#include <algorithm>
+
+namespace {
+
+constexpr int kTileWidth = 180;
+constexpr int kMinTileHeight = 60;
+constexpr int kMaxTileHeight = 240;
+constexpr int kCaptionHeight = 18;
+constexpr int kSpacing = 10;
+
+}  // namespace
+
+StockOverviewWidget::StockOverviewWidget(QWidget* parent)
+    : QAbstractScrollArea(parent)
+    , stock_width_(0)
+    , stock_length_(0)
+    , tile_size_(kTileWidth, kTileWidth / 2)
+    , tiles_done_(0)
+    , generation_(0)
+    , hover_index_(-1)
+    , render_watcher_(new QFutureWatcher<OverviewTile>(this)) {
+    viewport()->setMouseTracking(true);
+    verticalScrollBar()->setSingleStep(20);
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+
+    connect(render_watcher_, &QFutureWatcher<OverviewTile>::resultReadyAt,
+            this, &StockOverviewWidget::OnTileReady);
+    connect(render_watcher_, &QFutureWatcher<OverviewTile>::finished,
+            this, &StockOverviewWidget::OnRenderFinished);
+}
+
+StockOverviewWidget::~StockOverviewWidget() {
+    CancelRendering();
+}
+
+void StockOverviewWidget::CancelRendering() {
+    if (render_watcher_->isRunning()) {
+        render_watcher_->cancel();
+        render_watcher_->waitForFinished();
+    }
+}
+
+void StockOverviewWidget::SetStocks(std::shared_ptr<const std::vector<StockData>> stocks,
+                                    int stock_width, int stock_length, const std::vector<int>& reuse) {
+    CancelRendering();
+
+    // 母板尺寸不变时才能沿用缩略图
+    int count = stocks ? static_cast<int>(stocks->size()) : 0;
+    std::vector<QImage> tiles(count);
+    if (static_cast<int>(reuse.size()) == count &&
+        stock_width == stock_width_ && stock_length == stock_length_) {
+        for (int i = 0; i < count; i++) {
+            if (reuse[i] >= 0 && reuse[i] < static_cast<int>(tiles_.size())) tiles[i] = std::move(tiles_[reuse[i]]);
+        }
+    }
+
+    stocks_ = std::move(stocks);
+    stock_width_ = stock_width;
+    stock_length_ = stock_length;
+    generation_++;
+    hover_index_ = -1;
+    changed_.clear();
+
+    tiles_ = std::move(tiles);
+    tiles_done_ = static_cast<int>(std::count_if(tiles_.begin(), tiles_.end(),
+                                                 [](const QImage& image) { return !image.isNull(); }));
+
+    // 缩略图高度按母板宽长比确定
+    if (stock_length_ > 0 && stock_width_ > 0) {
+        int height = kTileWidth * stock_width_ / stock_length_;
+        tile_size_ = QSize(kTileWidth, std::clamp(height, kMinTileHeight, kMaxTileHeight));
+    }
+
+    if (reuse.empty()) verticalScrollBar()->setValue(0);
+    UpdateScrollBars();
+    viewport()->update();
+
+    if (count == 0 || stock_width_ <= 0 || stock_length_ <= 0) return;
+
+    // 每张缩略图是独立的 QImage 绘制任务, 线程池按核数并行 (沿用的缩略图除外)
+    std::vector<int> indices;
+    indices.reserve(count - tiles_done_);
+    for (int i = 0; i < count; i++) {
+        if (tiles_[i].isNull()) indices.push_back(i);
+    }
+    if (indices.empty()) {
+        emit RenderProgress(tiles_done_, count, 0);
+        return;
+    }
+
+    auto data = stocks_;
+    int generation = generation_;
+    int width = stock_width_;
+    int length = stock_length_;
+    QSize size = tile_size_;
+    qreal dpr = devicePixelRatioF();
+
+    render_timer_.start();
+    render_watcher_->setFuture(QtConcurrent::mapped(std::move(indices),
+        [data, generation, width, length, size, dpr](int index) {
+            StockRenderOptions options;
+            options.draw_labels = false;
+            options.draw_dimensions = false;
+
+            OverviewTile tile;
+            tile.generation = generation;
+            tile.index = index;
+            tile.image = RenderStockImage((*data)[index], width, length,
+                                          size, dpr, Qt::white, options);
+            return tile;
+        }));
+}
+
+void StockOverviewWidget::Clear() {
+    SetStocks(nullptr, 0, 0);
+}
+
+void StockOverviewWidget::SetChangedFlags(std::vector<char> changed) {
+    changed_ = std::move(changed);
+    viewport()->update();
+}
+
+void StockOverviewWidget::OnTileReady(int result_index) {
+    QFuture<OverviewTile> future = render_watcher_->future();
+    if (!future.isResultReadyAt(result_index)) return;
+
+    OverviewTile tile = future.resultAt(result_index);
+    if (tile.generation != generation_ || tile.index < 0 ||
+        tile.index >= static_cast<int>(tiles_.size()) || !tiles_[tile.index].isNull()) {
+        return;
+    }
+
+    tiles_[tile.index] = std::move(tile.image);
+    tiles_done_++;
+    emit RenderProgress(tiles_done_, static_cast<int>(tiles_.size()), render_timer_.elapsed());
+
+    // 只有可见的格子才需要重绘
+    QRect cell = CellRect(tile.index);
+    if (cell.intersects(viewport()->rect())) {
+        viewport()->update(cell);
+    }
+}
+
+void StockOverviewWidget::OnRenderFinished() {
+    emit RenderProgress(tiles_done_, static_cast<int>(tiles_.size()), render_timer_.elapsed());
+}
+
+int StockOverviewWidget::ColumnCount() const {
+    int cell_width = tile_size_.width() + kSpacing;
+    return std::max(1, (viewport()->width() - kSpacing) / cell_width);
+}
+
+QSize StockOverviewWidget::CellSize() const {
+    return QSize(tile_size_.width() + kSpacing, tile_size_.height() + kCaptionHeight + kSpacing);
+}
+
+QRect StockOverviewWidget::CellRect(int index) const {
+    int columns = ColumnCount();
+    QSize cell = CellSize();
+    int row = index / columns;
+    int col = index % columns;
+    int x = kSpacing + col * cell.width();
+    int y = kSpacing + row * cell.height() - verticalScrollBar()->value();
+    return QRect(x, y, tile_size_.width(), tile_size_.height() + kCaptionHeight);
+}
+
+int StockOverviewWidget::TileAt(const QPoint& pos) const {
+    int columns = ColumnCount();
+    QSize cell = CellSize();
+    int x = pos.x() - kSpacing;
+    int y = pos.y() + verticalScrollBar()->value() - kSpacing;
+    if (x < 0 || y < 0) return -1;
+
+    int col = x / cell.width();
+    int row = y / cell.height();
+    if (col >= columns) return -1;
+    // 落在格子间隙中不算命中
+    if (x % cell.width() >= tile_size_.width() ||
+        y % cell.height() >= tile_size_.height() + kCaptionHeight) {
+        return -1;
+    }
+
+    int index = row * columns + col;
+    return index < static_cast<int>(tiles_.size()) ? index : -1;
+}
+
+void StockOverviewWidget::UpdateScrollBars() {
+    int count = static_cast<int>(tiles_.size());
+    int rows = (count + ColumnCount() - 1) / ColumnCount();
+    int content_height = kSpacing + rows * CellSize().height();
+
+    verticalScrollBar()->setPageStep(viewport()->height());
+    verticalScrollBar()->setRange(0, std::max(0, content_height - viewport()->height()));
+}
+
+void StockOverviewWidget::EnsureVisible(int index) {
+    if (index < 0 || index >= static_cast<int>(tiles_.size())) return;
+
+    QRect cell = CellRect(index);
+    if (cell.top() < 0) {
+        verticalScrollBar()->setValue(verticalScrollBar()->value() + cell.top() - kSpacing);
+    } else if (cell.bottom() > viewport()->height()) {
+        verticalScrollBar()->setValue(verticalScrollBar()->value() +
+                                      cell.bottom() - viewport()->height() + kSpacing);
+    }
+}
+
+void StockOverviewWidget::resizeEvent(QResizeEvent* event) {
+    QAbstractScrollArea::resizeEvent(event);
+    UpdateScrollBars();
+}
+
+void StockOverviewWidget::paintEvent(QPaintEvent* event) {
+    QPainter painter(viewport());
+    painter.fillRect(event->rect(), QColor(250, 250, 250));
+
+    int count = static_cast<int>(tiles_.size());
+    if (count == 0) {
+        painter.setPen(Qt::gray);
+        painter.drawText(viewport()->rect(), Qt::AlignCenter, QString::fromUtf8("暂无切割方案"));
+        return;
+    }
+
+    // 只遍历与重绘区域相交的行
+    int columns = ColumnCount();
+    int cell_height = CellSize().height();
+    int scroll = verticalScrollBar()->value();
+    int first_row = std::max(0, (event->rect().top() + scroll - kSpacing) / cell_height);
+    int last_row = (event->rect().bottom() + scroll - kSpacing) / cell_height;
+
+    QFont font = painter.font();
+    font.setPointSize(8);
+    painter.setFont(font);
+
+    for (int row = first_row; row <= last_row; row++) {
+        for (int col = 0; col < columns; col++) {
+            int index = row * columns + col;
+            if (index >= count) return;
+
+            QRect cell = CellRect(index);
+            QRect image_rect(cell.topLeft(), tile_size_);
+            const QImage& image = tiles_[index];
+            if (!image.isNull()) {
+                painter.drawImage(image_rect.topLeft(), image);
+            } else {
+                painter.fillRect(image_rect, QColor(235, 235, 235));
+                painter.setPen(Qt::gray);
+                painter.drawText(image_rect, Qt::AlignCenter, QString::fromUtf8("渲染中..."));
+            }
+
+            bool changed = index < static_cast<int>(changed_.size()) && changed_[index];
+            if (index == hover_index_) {
+                painter.setPen(QPen(QColor(50, 100, 180), 2));
+            } else {
+                painter.setPen(changed ? QPen(QColor(230, 120, 0), 2) : QPen(Qt::gray, 1));
+            }
+            painter.drawRect(image_rect);
+
+            const StockData& stock = (*stocks_)[index];
+            painter.setPen(Qt::black);
+            painter.drawText(QRect(cell.left(), image_rect.bottom() + 1, cell.width(), kCaptionHeight),
+                             Qt::AlignCenter,
+                             QString::fromUtf8("#%1 ×%2  %3%").arg(index + 1)
+                                 .arg(stock.multiplicity)
+                                 .arg(stock.utilization * 100, 0, 'f', 1) +
+                                 (changed ? QString::fromUtf8("  [新]") : QString()));
+        }
+    }
+}
+
+void StockOverviewWidget::mouseMoveEvent(QMouseEvent* event) {
+    int index = TileAt(event->position().toPoint());
+    if (index != hover_index_) {
+        if (hover_index_ >= 0) viewport()->update(CellRect(hover_index_).adjusted(-2, -2, 2, 2));
+        hover_index_ = index;
+        if (hover_index_ >= 0) viewport()->update(CellRect(hover_index_).adjusted(-2, -2, 2, 2));
+        viewport()->setCursor(index >= 0 ? Qt::PointingHandCursor : Qt::ArrowCursor);
+    }
+    QAbstractScrollArea::mouseMoveEvent(event);
+}
+
+void StockOverviewWidget::leaveEvent(QEvent* event) {
+    if (hover_index_ >= 0) {
+        viewport()->update(CellRect(hover_index_).adjusted(-2, -2, 2, 2));
+        hover_index_ = -1;
+    }
+    QAbstractScrollArea::leaveEvent(event);
+}
+
+void StockOverviewWidget::mouseReleaseEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton) {
+        int index = TileAt(event->position().toPoint());
+        if (index >= 0) {
+            emit StockClicked(index);
+        }
+    }
+    QAbstractScrollArea::mouseReleaseEvent(event);
+}
@@ -0,0 +1,90 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stock_overview_widget.h - 母板缩略图总览
+// 所有母板在线程池中并行渲染为 QImage 缩略图, 完成一张显示一张;
+// 滚动区域只绘制可见行, 与母板数量无关
+// 解文件重新加载后只渲染内容变化的母板, 其余沿用原有缩略图
+
+#ifndef STOCK_OVERVIEW_WIDGET_H_
+#define STOCK_OVERVIEW_WIDGET_H_
+
+#include <QAbstractScrollArea>
+#include <QFutureWatcher>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QSize>
+#include <memory>
+#include <vector>
+#include "cutting_data.h"
+
+// 缩略图渲染结果
+struct OverviewTile {
+    int generation = 0;     // 数据版本 (丢弃过期结果)
+    int index = -1;         // 母板下标
+    QImage image;
+};
+
+class StockOverviewWidget : public QAbstractScrollArea {
+    Q_OBJECT
+
+public:
+    explicit StockOverviewWidget(QWidget* parent = nullptr);
+    ~StockOverviewWidget() override;
+
+    // 设置母板数据并开始后台渲染
+    // reuse 非空时 reuse[i] 为母板 i 在原数据中的下标 (-1 表示新内容), 对应的缩略图直接沿用
+    void SetStocks(std::shared_ptr<const std::vector<StockData>> stocks,
+                   int stock_width, int stock_length, const std::vector<int>& reuse = {});
+    void Clear();
+
+    // 标记内容有变化的母板 (边框高亮), 下标与 SetStocks 的数据相同
+    void SetChangedFlags(std::vector<char> changed);
+
+    // 滚动到指定母板
+    void EnsureVisible(int index);
+
+signals:
+    void StockClicked(int index);
+    void RenderProgress(int done, int total, qint64 elapsed_ms);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void leaveEvent(QEvent* event) override;
+
+private slots:
+    void OnTileReady(int result_index);
+    void OnRenderFinished();
+
+private:
+    void CancelRendering();
+    void UpdateScrollBars();
+    int ColumnCount() const;
+    QSize CellSize() const;
+    QRect CellRect(int index) const;       // 视口坐标
+    int TileAt(const QPoint& pos) const;
+
+    std::shared_ptr<const std::vector<StockData>> stocks_;
+    int stock_width_;
+    int stock_length_;
+    QSize tile_size_;                       // 缩略图逻辑尺寸
+
+    std::vector<QImage> tiles_;
+    std::vector<char> changed_;
+    int tiles_done_;
+    int generation_;
+    int hover_index_;
+
+    QFutureWatcher<OverviewTile>* render_watcher_;
+    QElapsedTimer render_timer_;
+};
+
+#endif  // STOCK_OVERVIEW_WIDGET_H_
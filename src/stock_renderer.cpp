@@ -0,0 +1,340 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stock_renderer.cpp - 母板切割方案渲染实现
+
+#include "stock_renderer.h"
+
+#include <QPainter>
+#include <QStaticText>
+#include <QFont>
+#include <QLine>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+QColor GetItemTypeColor(int item_type) {
+    // 使用预定义的调色板
+    static const QColor palette[] = {
+        QColor(255, 179, 186),  // 粉红
+        QColor(255, 223, 186),  // 橙色
+        QColor(255, 255, 186),  // 黄色
+        QColor(186, 255, 201),  // 浅绿
+        QColor(186, 225, 255),  // 浅蓝
+        QColor(218, 186, 255),  // 紫色
+        QColor(255, 186, 255),  // 粉紫
+        QColor(186, 255, 255),  // 青色
+        QColor(255, 200, 200),  // 浅红
+        QColor(200, 255, 200),  // 浅绿2
+        QColor(200, 200, 255),  // 浅蓝2
+        QColor(255, 230, 200),  // 浅橙
+    };
+    int idx = ((item_type - 1) % 12 + 12) % 12;
+    return palette[idx];
+}
+
+StockTransform ComputeStockTransform(int stock_width, int stock_length, const QRect& rect,
+                                     const StockRenderOptions& options) {
+    StockTransform t;
+    t.stock_width = stock_width;
+    if (stock_width <= 0 || stock_length <= 0) return t;
+
+    // 适配缩放比例 (保持宽高比, 留 5% 边距)
+    double scale_x = static_cast<double>(rect.width()) / stock_length;
+    double scale_y = static_cast<double>(rect.height()) / stock_width;
+    double fit_scale = std::min(scale_x, scale_y) * 0.95;
+
+    if (options.zoom <= 1.0) {
+        t.scale = fit_scale;
+        t.offset_x = rect.x() + (rect.width() - static_cast<int>(stock_length * t.scale)) / 2;
+        t.offset_y = rect.y() + (rect.height() - static_cast<int>(stock_width * t.scale)) / 2;
+        return t;
+    }
+
+    // 放大: 视图中心映射到绘图区中心 (偏移取整保证线条像素对齐)
+    t.scale = fit_scale * options.zoom;
+    double cx = options.center_x >= 0 ? options.center_x : stock_length / 2.0;
+    double cy = options.center_y >= 0 ? options.center_y : stock_width / 2.0;
+    t.offset_x = static_cast<int>(std::floor(rect.x() + rect.width() / 2.0 - cx * t.scale));
+    t.offset_y = static_cast<int>(std::floor(rect.y() + rect.height() / 2.0 - (stock_width - cy) * t.scale));
+    return t;
+}
+
+namespace {
+
+// 按覆盖率将子板颜色与母板底色混合
+QColor BlendCellColor(const QColor& item_color, const QColor& background, float coverage) {
+    float a = std::clamp(coverage, 0.0f, 1.0f);
+    return QColor(static_cast<int>(item_color.red() * a + background.red() * (1 - a)),
+                  static_cast<int>(item_color.green() * a + background.green() * (1 - a)),
+                  static_cast<int>(item_color.blue() * a + background.blue() * (1 - a)));
+}
+
+}  // namespace
+
+void DrawStock(QPainter& painter, const StockData& stock,
+               int stock_width, int stock_length, const QRect& rect,
+               const StockRenderOptions& options) {
+    if (stock_width <= 0 || stock_length <= 0) return;
+
+    StockTransform t = ComputeStockTransform(stock_width, stock_length, rect, options);
+    double scale = t.scale;
+    int offset_x = t.offset_x;
+    int offset_y = t.offset_y;
+    if (scale <= 0) return;
+
+    // 模型坐标 -> 像素 (整数截断, 相邻边界共用同一像素)
+    auto sx = [&](long long x) { return offset_x + static_cast<int>(x * scale); };
+    auto sy = [&](long long y) { return offset_y + static_cast<int>((stock_width - y) * scale); };
+
+    bool zoomed = options.zoom > 1.0;
+    if (zoomed) {
+        painter.save();
+        painter.setClipRect(rect);
+    }
+
+    // 实际需要绘制的区域
+    bool clipped = !options.clip.isNull();
+    QRect view = clipped ? rect.intersected(options.clip) : rect;
+    if (view.isEmpty()) {
+        if (zoomed) painter.restore();
+        return;
+    }
+
+    // 视口对应的模型矩形 (裁剪查询范围)
+    int view_x0 = std::max(0, static_cast<int>(std::floor((view.left() - offset_x) / scale)));
+    int view_x1 = std::min(stock_length,
+                           static_cast<int>(std::ceil((view.right() + 1 - offset_x) / scale)));
+    int view_y0 = std::max(0, static_cast<int>(std::floor(stock_width - (view.bottom() + 1 - offset_y) / scale)));
+    int view_y1 = std::min(stock_width,
+                           static_cast<int>(std::ceil(stock_width - (view.top() - offset_y) / scale)));
+
+    // 绘制母板背景
+    const QColor stock_background(220, 220, 220);
+    QRect stock_rect(offset_x, offset_y,
+                     static_cast<int>(stock_length * scale),
+                     static_cast<int>(stock_width * scale));
+    // 放大后母板可能远大于视口, 只填充可见部分
+    QRect visible_stock = zoomed || clipped ? stock_rect.intersected(view.adjusted(-2, -2, 2, 2)) : stock_rect;
+    painter.fillRect(visible_stock, stock_background);
+    painter.setPen(QPen(Qt::black, 2));
+    painter.drawRect(stock_rect);
+
+    const ItemGridIndex& index = stock.index;
+    bool coarse = !index.empty() && index.cell_size * scale < kMinGridCellPixels;
+
+    if (coarse) {
+        // ===== 聚合绘制: 每个网格格子一个色块 =====
+        int cs = index.cell_size;
+        int cx0 = std::clamp(view_x0 / cs, 0, index.cols - 1);
+        int cx1 = std::clamp((view_x1 - 1) / cs, 0, index.cols - 1);
+        int cy0 = std::clamp(view_y0 / cs, 0, index.rows - 1);
+        int cy1 = std::clamp((view_y1 - 1) / cs, 0, index.rows - 1);
+
+        for (int cy = cy0; cy <= cy1; cy++) {
+            int top = sy(std::min<long long>(stock_width, static_cast<long long>(cy + 1) * cs));
+            int bottom = sy(static_cast<long long>(cy) * cs);
+            if (bottom <= top) continue;
+            for (int cx = cx0; cx <= cx1; cx++) {
+                int cell = cy * index.cols + cx;
+                float coverage = index.cell_coverage[cell];
+                if (coverage <= 0.0f) continue;
+                int left = sx(static_cast<long long>(cx) * cs);
+                int right = sx(std::min<long long>(stock_length, static_cast<long long>(cx + 1) * cs));
+                if (right <= left) continue;
+                painter.fillRect(left, top, right - left, bottom - top,
+                                 BlendCellColor(GetItemTypeColor(index.cell_dominant_type[cell]),
+                                                stock_background, coverage));
+            }
+        }
+    } else {
+        // ===== 逐个绘制视口内的子板 =====
+        // 标签字体只设置一次; 标签文本按内容缓存为 QStaticText (布局只计算一次)
+        QFont label_font = painter.font();
+        label_font.setPointSize(8);
+        painter.setFont(label_font);
+        std::unordered_map<int, QStaticText> label_cache;
+        std::unordered_map<long long, QStaticText> dimension_cache;
+
+        auto prepared = [&](const QString& str) {
+            QStaticText text(str);
+            text.setTextFormat(Qt::PlainText);
+            text.prepare(painter.transform(), label_font);
+            return text;
+        };
+
+        std::vector<int> visible;
+        if (index.empty() || (view_x0 == 0 && view_y0 == 0 &&
+                              view_x1 == stock_length && view_y1 == stock_width)) {
+            visible.resize(stock.items.size());
+            for (size_t i = 0; i < visible.size(); i++) visible[i] = static_cast<int>(i);
+        } else {
+            QueryItems(stock, view_x0, view_y0, view_x1, view_y1, visible);
+        }
+
+        painter.setPen(QPen(Qt::black, 1));
+        for (int i : visible) {
+            const ItemRect& item = stock.items[i];
+            int draw_x = sx(item.x);
+            // Y 坐标翻转 (屏幕 Y 轴向下，切割 Y 轴向上)
+            int draw_y = sy(static_cast<long long>(item.y) + item.width);
+            int draw_w = static_cast<int>(item.length * scale);
+            int draw_h = static_cast<int>(item.width * scale);
+
+            QRect item_rect(draw_x, draw_y, draw_w, draw_h);
+
+            // 填充颜色与边框
+            painter.fillRect(item_rect, GetItemTypeColor(item.item_type));
+            painter.drawRect(item_rect);
+
+            // 子板类型标签 (仅当足够大时显示); 放大到足够大时附加尺寸
+            if (!options.draw_labels || draw_w <= kLabelMinWidth || draw_h <= kLabelMinHeight) {
+                continue;
+            }
+            auto it = label_cache.find(item.item_type);
+            if (it == label_cache.end()) {
+                it = label_cache.emplace(item.item_type,
+                                         prepared(QString("T%1").arg(item.item_type))).first;
+            }
+            QSizeF text_size = it->second.size();
+            QPointF center = QRectF(item_rect).center();
+
+            if (draw_w > kDimensionLabelMinWidth && draw_h > kDimensionLabelMinHeight) {
+                long long key = (static_cast<long long>(item.length) << 32) | static_cast<unsigned int>(item.width);
+                auto dim = dimension_cache.find(key);
+                if (dim == dimension_cache.end()) {
+                    dim = dimension_cache.emplace(key, prepared(
+                        QString("%1 x %2").arg(item.length).arg(item.width))).first;
+                }
+                QSizeF dim_size = dim->second.size();
+                double total_height = text_size.height() + dim_size.height();
+                painter.drawStaticText(QPointF(center.x() - text_size.width() / 2,
+                                               center.y() - total_height / 2), it->second);
+                painter.drawStaticText(QPointF(center.x() - dim_size.width() / 2,
+                                               center.y() - total_height / 2 + text_size.height()),
+                                       dim->second);
+            } else {
+                painter.drawStaticText(QPointF(center.x() - text_size.width() / 2,
+                                               center.y() - text_size.height() / 2), it->second);
+            }
+        }
+    }
+
+    // ===== 绘制两阶段切割轨迹 =====
+    // 关闭抗锯齿以获得锐利的像素级线条
+    painter.setRenderHint(QPainter::Antialiasing, false);
+
+    // 聚合绘制时切割线过密, 只画 1 像素的第一阶段线
+    const int line_width = coarse ? 1 : 3;
+    const int line_half_width = (line_width + 1) / 2;
+
+    // 切割线几何在加载时已计算 (StockData::cuts), 此处只做坐标变换并批量绘制
+    const CutGeometry& cuts = stock.cuts;
+
+    // 水平线只画可见部分, 避免放大后坐标远超视口
+    int line_left = std::max(stock_rect.left(), view.left() - line_width);
+    int line_right = std::min(stock_rect.right(), view.right() + line_width);
+
+    // 第一阶段切割线 (水平红线，分隔条带)
+    if (!cuts.stage1_y.empty()) {
+        QPen red_pen(QColor(200, 50, 50), line_width, Qt::SolidLine);
+        red_pen.setCapStyle(Qt::FlatCap);
+        painter.setPen(red_pen);
+
+        auto first = std::lower_bound(cuts.stage1_y.begin(), cuts.stage1_y.end(), view_y0);
+        auto last = std::upper_bound(first, cuts.stage1_y.end(), view_y1);
+
+        std::vector<QLine> lines;
+        lines.reserve(last - first);
+        int prev_y = std::numeric_limits<int>::min();
+        for (auto it = first; it != last; ++it) {
+            int draw_y = sy(*it);
+            if (draw_y == prev_y) continue;  // 同一像素行只画一次
+            prev_y = draw_y;
+            lines.emplace_back(line_left, draw_y, line_right, draw_y);
+        }
+        painter.drawLines(lines.data(), static_cast<int>(lines.size()));
+    }
+
+    // 第二阶段切割线 (垂直蓝线，分隔同一条带内的子板)
+    if (!coarse && !cuts.stage2_x.empty()) {
+        QPen blue_pen(QColor(50, 100, 180), line_width, Qt::SolidLine);
+        blue_pen.setCapStyle(Qt::FlatCap);
+        painter.setPen(blue_pen);
+
+        std::vector<std::pair<int, int>> ranges;
+        QueryStage2Cuts(cuts, view_x0, view_y0, view_x1, view_y1, ranges);
+
+        int line_top = view.top() - line_width;
+        int line_bottom = view.bottom() + line_width;
+
+        std::vector<QLine> lines;
+        for (const auto& range : ranges) {
+            for (int i = range.first; i < range.second; i++) {
+                int draw_x = sx(cuts.stage2_x[i]);
+                int top_y = sy(cuts.stage2_y1[i]);
+                int bottom_y = sy(cuts.stage2_y0[i]);
+
+                // 像素级避让: 蓝线端点内缩，不与红线相交
+                if (cuts.stage2_trim[i] & kCutTrimTop) top_y += line_half_width;
+                if (cuts.stage2_trim[i] & kCutTrimBottom) bottom_y -= line_half_width;
+
+                lines.emplace_back(draw_x, std::max(top_y, line_top),
+                                   draw_x, std::min(bottom_y, line_bottom));
+            }
+        }
+        painter.drawLines(lines.data(), static_cast<int>(lines.size()));
+    }
+
+    // 恢复抗锯齿 (用于后续文字绘制)
+    painter.setRenderHint(QPainter::Antialiasing, true);
+
+    if (zoomed) {
+        painter.restore();
+        return;
+    }
+    if (!options.draw_dimensions) return;
+
+    // 绘制尺寸标注
+    painter.setPen(Qt::darkGray);
+
+    // 底部: 长度
+    QString length_text = QString("%1").arg(stock_length);
+    painter.drawText(stock_rect.x(), stock_rect.bottom() + 15,
+                     stock_rect.width(), 15, Qt::AlignCenter, length_text);
+
+    // 右侧: 宽度
+    painter.save();
+    painter.translate(stock_rect.right() + 15, stock_rect.center().y());
+    painter.rotate(-90);
+    QString width_text = QString("%1").arg(stock_width);
+    painter.drawText(-30, -5, 60, 15, Qt::AlignCenter, width_text);
+    painter.restore();
+}
+
+QImage RenderStockImage(const StockData& stock, int stock_width, int stock_length,
+                        const QSize& size, qreal device_pixel_ratio,
+                        const QColor& background,
+                        const StockRenderOptions& options) {
+    QSize pixel_size = (QSizeF(size) * device_pixel_ratio).toSize();
+    if (pixel_size.isEmpty()) return QImage();
+
+    // 预乘 alpha 格式是光栅绘制的最快路径
+    QImage image(pixel_size, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(device_pixel_ratio);
+    image.fill(background);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    DrawStock(painter, stock, stock_width, stock_length, QRect(QPoint(0, 0), size), options);
+    painter.end();
+
+    return image;
+}
@@ -0,0 +1,81 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// stock_renderer.h - 母板切割方案渲染
+// 只依赖 QPainter, 不访问任何控件状态; 绘制到 QImage 时可在工作线程中调用
+
+#ifndef STOCK_RENDERER_H_
+#define STOCK_RENDERER_H_
+
+#include <QColor>
+#include <QImage>
+#include <QPointF>
+#include <QRect>
+#include <QSize>
+#include "cutting_data.h"
+
+class QPainter;
+
+// 渲染选项
+struct StockRenderOptions {
+    bool draw_labels = true;        // 子板类型标签
+    bool draw_dimensions = true;    // 母板尺寸标注 (仅适配视图时绘制)
+
+    // 视图: 相对适配视图的缩放倍数与视图中心 (模型坐标, 负值表示母板中心)
+    double zoom = 1.0;
+    double center_x = -1.0;
+    double center_y = -1.0;
+
+    // 只绘制与 clip 相交的部分 (与 rect 同一坐标系, 空表示整个 rect);
+    // 分块渲染大图时每块使用同一 rect (同一变换) 与各自的 clip
+    QRect clip;
+};
+
+// 模型坐标到绘图区坐标的变换 (屏幕 Y 轴向下, 模型 Y 轴向上)
+struct StockTransform {
+    double scale = 0.0;             // 像素 / 模型单位
+    int offset_x = 0;
+    int offset_y = 0;
+    int stock_width = 0;
+
+    QPointF ToScreen(double x, double y) const {
+        return QPointF(offset_x + x * scale, offset_y + (stock_width - y) * scale);
+    }
+    QPointF ToModel(const QPointF& p) const {
+        return QPointF((p.x() - offset_x) / scale, stock_width - (p.y() - offset_y) / scale);
+    }
+};
+
+// 细节层次阈值
+constexpr double kMinGridCellPixels = 4.0;     // 网格格子小于此像素时按格子聚合绘制
+constexpr int kLabelMinWidth = 30;              // 显示类型标签的最小子板像素尺寸
+constexpr int kLabelMinHeight = 20;
+constexpr int kDimensionLabelMinWidth = 80;     // 额外显示子板尺寸的最小像素尺寸
+constexpr int kDimensionLabelMinHeight = 40;
+
+// 计算变换: 适配视图下母板等比缩放居中 (留 5% 边距), 再按 zoom 绕视图中心放大
+StockTransform ComputeStockTransform(int stock_width, int stock_length, const QRect& rect,
+                                     const StockRenderOptions& options = StockRenderOptions());
+
+// 子板类型颜色 (12 色调色板循环)
+QColor GetItemTypeColor(int item_type);
+
+// 将母板绘制到 rect 内 (变换见 ComputeStockTransform)
+// 只绘制与 rect 相交的子板与切割线 (网格索引查询); 缩小到格子不足 kMinGridCellPixels 时
+// 按格子聚合颜色绘制, 绘制量与视口像素数相关而与子板数量无关
+void DrawStock(QPainter& painter, const StockData& stock,
+               int stock_width, int stock_length, const QRect& rect,
+               const StockRenderOptions& options = StockRenderOptions());
+
+// 渲染为图像 (size 为逻辑尺寸, 实际像素 = size * device_pixel_ratio)
+QImage RenderStockImage(const StockData& stock, int stock_width, int stock_length,
+                        const QSize& size, qreal device_pixel_ratio,
+                        const QColor& background,
+                        const StockRenderOptions& options = StockRenderOptions());
+
+#endif  // STOCK_RENDERER_H_
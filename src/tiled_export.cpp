@@ -0,0 +1,320 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// tiled_export.cpp - 大幅面分块导出实现
+
+#include "tiled_export.h"
+#include "stock_renderer.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+#include <QSaveFile>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr int kMinTileSize = 256;
+constexpr int kMaxTileSize = 8192;
+
+// 一批并行渲染的块数 (同时驻留内存的块数上限)
+int BatchSize() {
+    return std::max(2, QThread::idealThreadCount());
+}
+
+// 渲染画布 canvas 中的一块 (size 可大于画布剩余部分, 超出部分为白色)
+QImage RenderTile(const StockData& stock, int stock_width, int stock_length,
+                  const QRect& canvas, const QRect& tile, const QSize& size, int dpi) {
+    QImage image(size, QImage::Format_RGB32);
+    image.fill(Qt::white);
+    int dots_per_meter = qRound(dpi / 0.0254);
+    image.setDotsPerMeterX(dots_per_meter);
+    image.setDotsPerMeterY(dots_per_meter);
+
+    StockRenderOptions options;
+    options.clip = tile;
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.translate(-tile.topLeft());
+    DrawStock(painter, stock, stock_width, stock_length, canvas, options);
+    painter.end();
+    return image;
+}
+
+// ----- TIFF (小端, 分块, 无压缩 RGB) -----
+
+void PutU16(QByteArray& out, int offset, quint16 value) {
+    out[offset] = static_cast<char>(value & 0xff);
+    out[offset + 1] = static_cast<char>(value >> 8);
+}
+
+void PutU32(QByteArray& out, int offset, quint32 value) {
+    for (int k = 0; k < 4; k++) out[offset + k] = static_cast<char>((value >> (8 * k)) & 0xff);
+}
+
+// 文件头与 IFD; 块数据从返回的字节数处开始, 按行优先顺序连续存放
+QByteArray BuildTiffHeader(int width, int height, int tile_size, int tiles, int dpi) {
+    struct Entry { quint16 tag; quint16 type; quint32 count; quint32 value; };
+    constexpr quint16 kShort = 3, kLong = 4, kRational = 5;
+    constexpr int kEntryCount = 14;
+    const int ifd_offset = 8;
+    const int ifd_size = 2 + kEntryCount * 12 + 4;
+
+    // IFD 之后的附加数据: BitsPerSample (3 x SHORT), X/Y 分辨率 (RATIONAL), 块偏移与字节数 (LONG 数组)
+    const int bits_offset = ifd_offset + ifd_size;
+    const int xres_offset = bits_offset + 6 + 2;
+    const int yres_offset = xres_offset + 8;
+    const int offsets_offset = yres_offset + 8;
+    const int counts_offset = offsets_offset + 4 * tiles;
+    const int data_offset = counts_offset + 4 * tiles;
+    const quint32 tile_bytes = static_cast<quint32>(tile_size) * tile_size * 3;
+
+    // 只有一块时数组直接存放在条目中
+    const Entry entries[kEntryCount] = {
+        {256, kLong, 1, static_cast<quint32>(width)},
+        {257, kLong, 1, static_cast<quint32>(height)},
+        {258, kShort, 3, static_cast<quint32>(bits_offset)},
+        {259, kShort, 1, 1},                                    // 无压缩
+        {262, kShort, 1, 2},                                    // RGB
+        {277, kShort, 1, 3},
+        {282, kRational, 1, static_cast<quint32>(xres_offset)},
+        {283, kRational, 1, static_cast<quint32>(yres_offset)},
+        {284, kShort, 1, 1},                                    // 像素交错存储
+        {296, kShort, 1, 2},                                    // 英寸
+        {322, kLong, 1, static_cast<quint32>(tile_size)},
+        {323, kLong, 1, static_cast<quint32>(tile_size)},
+        {324, kLong, static_cast<quint32>(tiles),
+         tiles == 1 ? static_cast<quint32>(data_offset) : static_cast<quint32>(offsets_offset)},
+        {325, kLong, static_cast<quint32>(tiles),
+         tiles == 1 ? tile_bytes : static_cast<quint32>(counts_offset)},
+    };
+
+    QByteArray out(data_offset, '\0');
+    out[0] = 'I';
+    out[1] = 'I';
+    PutU16(out, 2, 42);
+    PutU32(out, 4, ifd_offset);
+
+    PutU16(out, ifd_offset, kEntryCount);
+    for (int e = 0; e < kEntryCount; e++) {
+        int at = ifd_offset + 2 + e * 12;
+        PutU16(out, at, entries[e].tag);
+        PutU16(out, at + 2, entries[e].type);
+        PutU32(out, at + 4, entries[e].count);
+        if (entries[e].type == kShort && entries[e].count == 1) {
+            PutU16(out, at + 8, static_cast<quint16>(entries[e].value));
+        } else {
+            PutU32(out, at + 8, entries[e].value);
+        }
+    }
+    PutU32(out, ifd_offset + 2 + kEntryCount * 12, 0);     // 无后续 IFD
+
+    for (int k = 0; k < 3; k++) PutU16(out, bits_offset + 2 * k, 8);
+    PutU32(out, xres_offset, static_cast<quint32>(dpi));
+    PutU32(out, xres_offset + 4, 1);
+    PutU32(out, yres_offset, static_cast<quint32>(dpi));
+    PutU32(out, yres_offset + 4, 1);
+    for (int t = 0; t < tiles; t++) {
+        PutU32(out, offsets_offset + 4 * t, static_cast<quint32>(data_offset + static_cast<qint64>(t) * tile_bytes));
+        PutU32(out, counts_offset + 4 * t, tile_bytes);
+    }
+    return out;
+}
+
+// RGB32 块转为 TIFF 的 RGB 字节
+QByteArray TileToRgb(const QImage& image) {
+    const int w = image.width();
+    const int h = image.height();
+    QByteArray out(static_cast<qsizetype>(w) * h * 3, Qt::Uninitialized);
+    char* dst = out.data();
+    for (int y = 0; y < h; y++) {
+        const QRgb* src = reinterpret_cast<const QRgb*>(image.constScanLine(y));
+        for (int x = 0; x < w; x++) {
+            *dst++ = static_cast<char>(qRed(src[x]));
+            *dst++ = static_cast<char>(qGreen(src[x]));
+            *dst++ = static_cast<char>(qBlue(src[x]));
+        }
+    }
+    return out;
+}
+
+QString TilePngPath(const QString& base, int row, int column, int digits) {
+    return QString("%1_r%2_c%3.png").arg(base)
+        .arg(row + 1, digits, 10, QChar('0'))
+        .arg(column + 1, digits, 10, QChar('0'));
+}
+
+}  // namespace
+
+TiledExportFormat TiledExportFormatFromPath(const QString& path) {
+    QString suffix = QFileInfo(path).suffix().toLower();
+    return suffix == "tif" || suffix == "tiff" ? TiledExportFormat::kTiff : TiledExportFormat::kPngTiles;
+}
+
+QSize TiledExportCanvasSize(int stock_width, int stock_length, const TiledExportOptions& options) {
+    if (stock_width <= 0 || stock_length <= 0 || options.width <= 0) return QSize();
+    // 母板按宽长比铺满画布 (DrawStock 四周留 2.5% 边距, 尺寸标注位于边距内)
+    int height = static_cast<int>(std::ceil(static_cast<double>(options.width) * stock_width / stock_length));
+    return QSize(options.width, std::max(height, 64));
+}
+
+StockExportResult ExportStockTiled(const StockData& stock, int stock_width, int stock_length,
+                                   const QString& path, const TiledExportOptions& options,
+                                   const StockExportProgress& progress) {
+    QElapsedTimer timer;
+    timer.start();
+
+    StockExportResult result;
+    const QSize canvas_size = TiledExportCanvasSize(stock_width, stock_length, options);
+    if (canvas_size.isEmpty()) {
+        result.error = QString::fromUtf8("暂无切割方案");
+        return result;
+    }
+    const TiledExportFormat format = TiledExportFormatFromPath(path);
+    int tile_size = std::clamp(options.tile_size, kMinTileSize, kMaxTileSize);
+    if (format == TiledExportFormat::kTiff) tile_size = tile_size / 16 * 16;
+
+    const QRect canvas(QPoint(0, 0), canvas_size);
+    const int columns = (canvas_size.width() + tile_size - 1) / tile_size;
+    const int rows = (canvas_size.height() + tile_size - 1) / tile_size;
+    const int tiles = columns * rows;
+    auto tile_rect = [&](int t) {
+        return QRect((t % columns) * tile_size, (t / columns) * tile_size, tile_size, tile_size);
+    };
+
+    QFile tiff;
+    QFileInfo info(path);
+    QString base = info.dir().filePath(info.completeBaseName());
+    const int digits = std::max(2, static_cast<int>(QString::number(std::max(rows, columns)).size()));
+    QStringList written;
+    auto fail = [&](const QString& error, bool cancelled) {
+        if (tiff.isOpen()) tiff.close();
+        for (const QString& file : written) QFile::remove(file);
+        result.error = error;
+        result.cancelled = cancelled;
+        result.elapsed_ms = timer.elapsed();
+        return result;
+    };
+
+    if (format == TiledExportFormat::kTiff) {
+        qint64 total_bytes = static_cast<qint64>(tiles) * tile_size * tile_size * 3;
+        if (total_bytes >= (qint64(1) << 32) - (qint64(1) << 20)) {
+            result.error = QString::fromUtf8("输出超过 TIFF 的 4 GB 上限, 请降低分辨率或导出 PNG 分块");
+            return result;
+        }
+        tiff.setFileName(path);
+        if (!tiff.open(QIODevice::WriteOnly)) {
+            result.error = QString::fromUtf8("无法写入文件: ") + path;
+            return result;
+        }
+        written << path;
+        tiff.write(BuildTiffHeader(canvas_size.width(), canvas_size.height(), tile_size, tiles, options.dpi));
+    }
+
+    // 按行优先顺序分批: 批内并行渲染 (PNG 同时在工作线程中压缩写出), TIFF 按顺序追加
+    const int batch = BatchSize();
+    std::vector<QByteArray> rgb(batch);
+    std::vector<char> saved(batch);
+    for (int start = 0; start < tiles; start += batch) {
+        int end = std::min(tiles, start + batch);
+        std::vector<int> indices(end - start);
+        for (int t = start; t < end; t++) indices[t - start] = t;
+
+        QtConcurrent::blockingMap(indices, [&, start](int t) {
+            QRect tile = tile_rect(t);
+            if (format == TiledExportFormat::kTiff) {
+                rgb[t - start] = TileToRgb(RenderTile(stock, stock_width, stock_length, canvas, tile,
+                                                      tile.size(), options.dpi));
+            } else {
+                QRect visible = tile.intersected(canvas);
+                QImage image = RenderTile(stock, stock_width, stock_length, canvas, tile,
+                                          visible.size(), options.dpi);
+                saved[t - start] = image.save(TilePngPath(base, t / columns, t % columns, digits), "PNG");
+            }
+        });
+
+        if (format == TiledExportFormat::kTiff) {
+            for (int t = start; t < end; t++) {
+                bool ok = tiff.write(rgb[t - start]) == rgb[t - start].size();
+                rgb[t - start] = QByteArray();
+                if (!ok) return fail(QString::fromUtf8("写入失败: ") + path, false);
+            }
+        } else {
+            // 先记录本批全部分块再检查失败, 失败时同批已写出的分块一并删除
+            for (int t = start; t < end; t++) {
+                written << TilePngPath(base, t / columns, t % columns, digits);
+            }
+            for (int t = start; t < end; t++) {
+                if (!saved[t - start]) {
+                    return fail(QString::fromUtf8("写入失败: ") + TilePngPath(base, t / columns, t % columns, digits),
+                                false);
+                }
+            }
+        }
+        if (progress && !progress(end, tiles)) return fail(QString(), true);
+    }
+
+    if (format == TiledExportFormat::kTiff) {
+        tiff.close();
+        if (tiff.error() != QFileDevice::NoError) return fail(QString::fromUtf8("写入失败: ") + path, false);
+    } else {
+        // 索引: 各块位置与像素 -> 模型坐标的变换 (模型 x = (px - offset_x) / scale, y = stock_width - (py - offset_y) / scale)
+        StockTransform t = ComputeStockTransform(stock_width, stock_length, canvas);
+        QJsonArray tile_array;
+        for (int k = 0; k < tiles; k++) {
+            QRect visible = tile_rect(k).intersected(canvas);
+            QJsonObject obj;
+            obj["row"] = k / columns;
+            obj["column"] = k % columns;
+            obj["x"] = visible.x();
+            obj["y"] = visible.y();
+            obj["width"] = visible.width();
+            obj["height"] = visible.height();
+            obj["file"] = QFileInfo(TilePngPath(base, k / columns, k % columns, digits)).fileName();
+            tile_array.append(obj);
+        }
+        QJsonObject root;
+        root["width"] = canvas_size.width();
+        root["height"] = canvas_size.height();
+        root["tile_size"] = tile_size;
+        root["columns"] = columns;
+        root["rows"] = rows;
+        root["dpi"] = options.dpi;
+        root["stock_id"] = stock.stock_id;
+        root["stock_width"] = stock_width;
+        root["stock_length"] = stock_length;
+        root["scale"] = t.scale;
+        root["offset_x"] = t.offset_x;
+        root["offset_y"] = t.offset_y;
+        root["tiles"] = tile_array;
+
+        QString index_path = base + "_tiles.json";
+        QSaveFile index_file(index_path);
+        if (!index_file.open(QIODevice::WriteOnly)) {
+            return fail(QString::fromUtf8("无法写入文件: ") + index_path, false);
+        }
+        index_file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+        if (!index_file.commit()) return fail(QString::fromUtf8("写入失败: ") + index_path, false);
+        written.prepend(index_path);
+    }
+
+    result.files = written;
+    for (const QString& file : result.files) result.bytes += QFileInfo(file).size();
+    result.success = true;
+    result.elapsed_ms = timer.elapsed();
+    return result;
+}
@@ -0,0 +1,48 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// tiled_export.h - 大幅面分块导出
+// 单块母板按打印分辨率 (数万像素) 输出时整幅图像放不进内存, 改为按固定边长的块渲染:
+// 全部块使用同一变换 (整幅画布), 每块只绘制与自身相交的子板与切割线 (StockRenderOptions::clip),
+// 在线程池中按批并行渲染, 写出后立即释放; 内存占用只与块大小和线程数有关, 与输出分辨率无关
+//
+// .tif / .tiff  单个分块 TIFF (无压缩 RGB, 块按行优先顺序写出), 文件须小于 4 GB
+// 其余 (.png)    每块一个 PNG <名称>_r001_c001.png, 另写索引 <名称>_tiles.json
+//                (画布尺寸、块尺寸、各块位置与文件名, 以及像素 -> 模型坐标的变换)
+
+#ifndef TILED_EXPORT_H_
+#define TILED_EXPORT_H_
+
+#include <QSize>
+#include <QString>
+#include "cutting_data.h"
+#include "stock_export.h"
+
+enum class TiledExportFormat {
+    kTiff,
+    kPngTiles
+};
+
+struct TiledExportOptions {
+    int width = 20000;          // 输出宽度 (像素), 高度按母板宽长比
+    int tile_size = 2048;       // 块边长 (像素, TIFF 取 16 的倍数)
+    int dpi = 300;              // 写入元数据, 标签字号按此换算为打印尺寸
+};
+
+// 根据扩展名判断格式
+TiledExportFormat TiledExportFormatFromPath(const QString& path);
+
+// 输出画布尺寸
+QSize TiledExportCanvasSize(int stock_width, int stock_length, const TiledExportOptions& options);
+
+// 分块导出单块母板 (阻塞; 进度按块计数, 取消或失败时删除已写出的文件)
+StockExportResult ExportStockTiled(const StockData& stock, int stock_width, int stock_length,
+                                   const QString& path, const TiledExportOptions& options,
+                                   const StockExportProgress& progress = StockExportProgress());
+
+#endif  // TILED_EXPORT_H_
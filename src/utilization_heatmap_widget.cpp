@@ -0,0 +1,128 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// utilization_heatmap_widget.cpp - 利用率热力条实现
+
+#include "utilization_heatmap_widget.h"
+
+#include <QPainter>
+#include <QMouseEvent>
+#include <QToolTip>
+#include <algorithm>
+
+UtilizationHeatmapWidget::UtilizationHeatmapWidget(QWidget* parent)
+    : QWidget(parent)
+    , current_index_(-1) {
+    setMouseTracking(true);
+    setCursor(Qt::PointingHandCursor);
+}
+
+void UtilizationHeatmapWidget::SetStatistics(std::shared_ptr<const WasteStatistics> stats,
+                                             std::vector<int> multiplicity) {
+    stats_ = std::move(stats);
+    multiplicity_ = std::move(multiplicity);
+    update();
+}
+
+void UtilizationHeatmapWidget::SetCurrentIndex(int index) {
+    if (current_index_ == index) return;
+    current_index_ = index;
+    update();
+}
+
+void UtilizationHeatmapWidget::Clear() {
+    stats_.reset();
+    multiplicity_.clear();
+    current_index_ = -1;
+    update();
+}
+
+QColor UtilizationHeatmapWidget::HeatColor(double utilization) {
+    // 50% 及以下红色, 经黄色过渡到 100% 绿色
+    double t = std::clamp((utilization - 0.5) / 0.5, 0.0, 1.0);
+    return QColor::fromHsvF(t / 3.0, 0.75, 0.9);
+}
+
+int UtilizationHeatmapWidget::ColumnOf(int index) const {
+    int count = stats_ ? stats_->size() : 0;
+    if (count == 0) return 0;
+    return static_cast<int>(static_cast<long long>(index) * width() / count);
+}
+
+int UtilizationHeatmapWidget::StockAt(int x) const {
+    int count = stats_ ? stats_->size() : 0;
+    if (count == 0 || x < 0 || x >= width()) return -1;
+    // 像素列 x 覆盖的切割方式 [first, last)
+    int first = static_cast<int>((static_cast<long long>(x) * count + width() - 1) / width());
+    int last = static_cast<int>((static_cast<long long>(x + 1) * count + width() - 1) / width());
+    if (last <= first) {
+        // 切割方式少于像素列: 落在某个切割方式的色块内
+        return std::min(count - 1, static_cast<int>(static_cast<long long>(x) * count / width()));
+    }
+    const std::vector<double>& u = stats_->utilization;
+    return static_cast<int>(std::min_element(u.begin() + first, u.begin() + last) - u.begin());
+}
+
+void UtilizationHeatmapWidget::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(235, 235, 235));
+    int count = stats_ ? stats_->size() : 0;
+    if (count == 0 || width() <= 0) return;
+
+    const std::vector<double>& u = stats_->utilization;
+    if (count <= width()) {
+        for (int i = 0; i < count; i++) {
+            int x0 = ColumnOf(i);
+            int x1 = ColumnOf(i + 1);
+            painter.fillRect(QRect(x0, 0, std::max(1, x1 - x0), height()), HeatColor(u[i]));
+        }
+    } else {
+        // 每个像素列取其中的最差利用率, 一次遍历
+        for (int x = 0; x < width(); x++) {
+            int i = StockAt(x);
+            if (i >= 0) painter.fillRect(QRect(x, 0, 1, height()), HeatColor(u[i]));
+        }
+    }
+
+    if (current_index_ >= 0 && current_index_ < count) {
+        int x0 = ColumnOf(current_index_);
+        int x1 = std::max(x0 + 3, ColumnOf(current_index_ + 1));
+        painter.setPen(QPen(Qt::black, 2));
+        painter.setBrush(Qt::NoBrush);
+        painter.drawRect(QRect(x0, 1, x1 - x0 - 1, height() - 2));
+    }
+}
+
+void UtilizationHeatmapWidget::mouseReleaseEvent(QMouseEvent* event) {
+    if (event->button() != Qt::LeftButton) return;
+    int index = StockAt(event->position().toPoint().x());
+    if (index >= 0) emit StockClicked(index);
+}
+
+void UtilizationHeatmapWidget::mouseMoveEvent(QMouseEvent* event) {
+    int index = StockAt(event->position().toPoint().x());
+    if (index < 0) {
+        QToolTip::hideText();
+        return;
+    }
+    const WasteStatistics& stats = *stats_;
+    QString text = QString::fromUtf8("方案 %1 ×%2: 利用率 %3%\n浪费 %4 (条带之外 %5)")
+        .arg(index + 1)
+        .arg(index < static_cast<int>(multiplicity_.size()) ? multiplicity_[index] : 1)
+        .arg(stats.utilization[index] * 100, 0, 'f', 1)
+        .arg(stats.waste_area[index], 0, 'f', 0)
+        .arg(stats.outside_waste[index], 0, 'f', 0);
+    int worst = stats.worst_strip[index];
+    if (worst >= 0) {
+        text += QString::fromUtf8("\n浪费最大的条带: 第 %1 条, %2")
+            .arg(worst + 1)
+            .arg(stats.strip_waste[stats.strip_start[index] + worst], 0, 'f', 0);
+    }
+    QToolTip::showText(event->globalPosition().toPoint(), text, this);
+}
@@ -0,0 +1,52 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// utilization_heatmap_widget.h - 利用率热力条
+// 全部切割方式按当前顺序排成一行, 颜色表示利用率 (50% 及以下为红, 100% 为绿);
+// 切割方式多于像素列时每列取其中利用率最低者 (点击也打开该切割方式), 悬停显示利用率与浪费
+
+#ifndef UTILIZATION_HEATMAP_WIDGET_H_
+#define UTILIZATION_HEATMAP_WIDGET_H_
+
+#include <QColor>
+#include <QWidget>
+#include <memory>
+#include <vector>
+#include "waste_statistics.h"
+
+class UtilizationHeatmapWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit UtilizationHeatmapWidget(QWidget* parent = nullptr);
+
+    // multiplicity 为各切割方式的母板张数 (与 stats 下标相同)
+    void SetStatistics(std::shared_ptr<const WasteStatistics> stats, std::vector<int> multiplicity);
+    void SetCurrentIndex(int index);
+    void Clear();
+
+    static QColor HeatColor(double utilization);
+
+signals:
+    void StockClicked(int index);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+
+private:
+    int StockAt(int x) const;               // x 处 (利用率最低) 的切割方式, 无则 -1
+    int ColumnOf(int index) const;          // 切割方式所在的起始像素列
+
+    std::shared_ptr<const WasteStatistics> stats_;
+    std::vector<int> multiplicity_;
+    int current_index_;
+};
+
+#endif  // UTILIZATION_HEATMAP_WIDGET_H_
@@ -0,0 +1,189 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// waste_report_dialog.cpp - 利用率分布对话框实现
+
+#include "waste_report_dialog.h"
+#include "utilization_heatmap_widget.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QSpinBox>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTableWidgetItem>
+#include <QHeaderView>
+#include <QPainter>
+#include <QStringList>
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+constexpr int kListedStrips = 3;    // 表格中每个切割方式列出的浪费最大的条带数
+
+// 利用率分布直方图 (按母板张数)
+class UtilizationHistogram : public QWidget {
+public:
+    UtilizationHistogram(std::shared_ptr<const WasteStatistics> stats, QWidget* parent)
+        : QWidget(parent), stats_(std::move(stats)) {
+        setMinimumHeight(140);
+    }
+
+protected:
+    void paintEvent(QPaintEvent* event) override {
+        Q_UNUSED(event);
+        QPainter painter(this);
+        painter.fillRect(rect(), Qt::white);
+
+        QFontMetrics metrics = painter.fontMetrics();
+        QRect plot = rect().adjusted(8, metrics.height() + 4, -8, -(metrics.height() + 4));
+        long long peak = *std::max_element(stats_->histogram.begin(), stats_->histogram.end());
+        if (plot.width() <= 0 || plot.height() <= 0) return;
+
+        double bar_width = plot.width() / static_cast<double>(kUtilizationBins);
+        for (int b = 0; b < kUtilizationBins; b++) {
+            long long count = stats_->histogram[b];
+            int h = peak > 0 ? static_cast<int>(plot.height() * count / static_cast<double>(peak)) : 0;
+            QRectF bar(plot.left() + b * bar_width + 2, plot.bottom() - h, bar_width - 4, h);
+            painter.fillRect(bar, UtilizationHeatmapWidget::HeatColor((b + 0.5) / kUtilizationBins));
+
+            painter.setPen(Qt::black);
+            if (count > 0) {
+                painter.drawText(QRectF(bar.left(), bar.top() - metrics.height() - 2, bar.width(), metrics.height()),
+                                 Qt::AlignCenter, QString::number(count));
+            }
+            painter.drawText(QRectF(plot.left() + b * bar_width, plot.bottom() + 2, bar_width, metrics.height()),
+                             Qt::AlignCenter, QString("%1%").arg(b * 100 / kUtilizationBins));
+        }
+        painter.setPen(QColor(160, 160, 160));
+        painter.drawLine(plot.bottomLeft(), plot.bottomRight());
+    }
+
+private:
+    std::shared_ptr<const WasteStatistics> stats_;
+};
+
+}  // namespace
+
+WasteReportDialog::WasteReportDialog(std::shared_ptr<const WasteStatistics> stats,
+                                     std::shared_ptr<const CuttingSolution> solution, QWidget* parent)
+    : QDialog(parent)
+    , stats_(std::move(stats))
+    , solution_(std::move(solution)) {
+    setWindowTitle(QString::fromUtf8("利用率分布"));
+    resize(760, 620);
+    SetupUi();
+    FillWorstTable();
+}
+
+void WasteReportDialog::SetupUi() {
+    auto* main_layout = new QVBoxLayout(this);
+
+    const WasteStatistics& stats = *stats_;
+    double sheet_area = static_cast<double>(solution_->stock_width) * solution_->stock_length;
+    summary_label_ = new QLabel(this);
+    summary_label_->setWordWrap(true);
+    summary_label_->setText(QString::fromUtf8(
+        "%1 块母板 (%2 种切割方式); 总利用率 %3%, 浪费面积 %4 (约 %5 块母板);\n"
+        "单张利用率最低 %6%, 最高 %7%; 统计用时 %8 ms")
+        .arg(stats.sheet_count)
+        .arg(stats.size())
+        .arg(stats.total_utilization * 100, 0, 'f', 2)
+        .arg(stats.total_waste_area, 0, 'f', 0)
+        .arg(sheet_area > 0 ? stats.total_waste_area / sheet_area : 0.0, 0, 'f', 1)
+        .arg(stats.min_utilization * 100, 0, 'f', 1)
+        .arg(stats.max_utilization * 100, 0, 'f', 1)
+        .arg(stats.elapsed_ms));
+    main_layout->addWidget(summary_label_);
+
+    main_layout->addWidget(new QLabel(QString::fromUtf8("利用率分布 (母板张数):"), this));
+    main_layout->addWidget(new UtilizationHistogram(stats_, this));
+
+    auto* option_layout = new QHBoxLayout();
+    option_layout->addWidget(new QLabel(QString::fromUtf8("利用率最低的切割方式:"), this));
+    worst_count_spin_ = new QSpinBox(this);
+    worst_count_spin_->setRange(1, std::max(1, stats.size()));
+    worst_count_spin_->setValue(std::min(20, std::max(1, stats.size())));
+    connect(worst_count_spin_, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &WasteReportDialog::FillWorstTable);
+    option_layout->addWidget(worst_count_spin_);
+    option_layout->addStretch();
+    main_layout->addLayout(option_layout);
+
+    worst_table_ = new QTableWidget(this);
+    worst_table_->setColumnCount(7);
+    worst_table_->setHorizontalHeaderLabels({
+        QString::fromUtf8("排名"), QString::fromUtf8("方案"), QString::fromUtf8("张数"),
+        QString::fromUtf8("利用率"), QString::fromUtf8("浪费面积"),
+        QString::fromUtf8("条带之外"), QString::fromUtf8("条带浪费 (最大的 3 条)")});
+    worst_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    worst_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    worst_table_->verticalHeader()->setVisible(false);
+    worst_table_->horizontalHeader()->setSectionResizeMode(6, QHeaderView::Stretch);
+    worst_table_->setToolTip(QString::fromUtf8("双击一行在视图中打开该切割方式"));
+    connect(worst_table_, &QTableWidget::cellDoubleClicked,
+            this, &WasteReportDialog::OnCellDoubleClicked);
+    main_layout->addWidget(worst_table_, 1);
+
+    auto* button_layout = new QHBoxLayout();
+    button_layout->addStretch();
+    auto* close_button = new QPushButton(QString::fromUtf8("关闭"), this);
+    connect(close_button, &QPushButton::clicked, this, &QDialog::accept);
+    button_layout->addWidget(close_button);
+    main_layout->addLayout(button_layout);
+}
+
+void WasteReportDialog::FillWorstTable() {
+    const WasteStatistics& stats = *stats_;
+    int rows = std::min(worst_count_spin_->value(), stats.size());
+
+    std::vector<int> strips;
+    worst_table_->setUpdatesEnabled(false);
+    worst_table_->setRowCount(rows);
+    for (int row = 0; row < rows; row++) {
+        int s = stats.by_utilization[row];
+
+        // 浪费最大的几个条带
+        const double* strip_waste = stats.strip_waste.data() + stats.strip_start[s];
+        strips.resize(stats.strip_start[s + 1] - stats.strip_start[s]);
+        std::iota(strips.begin(), strips.end(), 0);
+        int listed = std::min(kListedStrips, static_cast<int>(strips.size()));
+        std::partial_sort(strips.begin(), strips.begin() + listed, strips.end(),
+                          [strip_waste](int a, int b) { return strip_waste[a] > strip_waste[b]; });
+        QStringList strip_text;
+        for (int k = 0; k < listed; k++) {
+            strip_text << QString::fromUtf8("第 %1 条 %2").arg(strips[k] + 1).arg(strip_waste[strips[k]], 0, 'f', 0);
+        }
+
+        const QString cells[] = {
+            QString::number(row + 1),
+            QString::number(s + 1),
+            QString::number(solution_->stocks[s].multiplicity),
+            QString("%1%").arg(stats.utilization[s] * 100, 0, 'f', 2),
+            QString::number(stats.waste_area[s], 'f', 0),
+            QString::number(stats.outside_waste[s], 'f', 0),
+            strip_text.join(", ")
+        };
+        for (int column = 0; column < 7; column++) {
+            auto* item = new QTableWidgetItem(cells[column]);
+            if (column != 6) item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            if (column == 3) item->setBackground(UtilizationHeatmapWidget::HeatColor(stats.utilization[s]));
+            worst_table_->setItem(row, column, item);
+        }
+    }
+    worst_table_->setUpdatesEnabled(true);
+}
+
+void WasteReportDialog::OnCellDoubleClicked(int row, int column) {
+    Q_UNUSED(column);
+    if (row >= 0 && row < stats_->size()) {
+        emit PatternActivated(stats_->by_utilization[row]);
+    }
+}
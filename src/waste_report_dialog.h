@@ -0,0 +1,50 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// waste_report_dialog.h - 利用率分布对话框
+// 显示全部母板的利用率分布直方图与合计, 表格列出利用率最低的 N 个切割方式及其各条带浪费
+
+#ifndef WASTE_REPORT_DIALOG_H_
+#define WASTE_REPORT_DIALOG_H_
+
+#include <QDialog>
+#include <memory>
+#include "cutting_data.h"
+#include "waste_statistics.h"
+
+class QLabel;
+class QSpinBox;
+class QTableWidget;
+
+class WasteReportDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    // stats 与 solution->stocks 下标相同
+    WasteReportDialog(std::shared_ptr<const WasteStatistics> stats,
+                      std::shared_ptr<const CuttingSolution> solution, QWidget* parent = nullptr);
+
+signals:
+    void PatternActivated(int pattern_index);
+
+private slots:
+    void FillWorstTable();
+    void OnCellDoubleClicked(int row, int column);
+
+private:
+    void SetupUi();
+
+    std::shared_ptr<const WasteStatistics> stats_;
+    std::shared_ptr<const CuttingSolution> solution_;
+
+    QLabel* summary_label_;
+    QSpinBox* worst_count_spin_;
+    QTableWidget* worst_table_;
+};
+
+#endif  // WASTE_REPORT_DIALOG_H_
@@ -0,0 +1,96 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// waste_statistics.cpp - 利用率与浪费统计实现
+
+#include "waste_statistics.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <numeric>
+
+int UtilizationBin(double utilization) {
+    return std::clamp(static_cast<int>(utilization * kUtilizationBins), 0, kUtilizationBins - 1);
+}
+
+WasteStatistics ComputeWasteStatistics(const std::vector<StockData>& stocks, int stock_width, int stock_length) {
+    QElapsedTimer timer;
+    timer.start();
+
+    WasteStatistics stats;
+    const int count = static_cast<int>(stocks.size());
+    const double sheet_area = static_cast<double>(stock_width) * stock_length;
+    stats.utilization.resize(count);
+    stats.waste_area.resize(count);
+    stats.outside_waste.resize(count);
+    stats.worst_strip.assign(count, -1);
+    stats.strip_start.assign(count + 1, 0);
+    for (int s = 0; s < count; s++) {
+        stats.strip_start[s + 1] = stats.strip_start[s] + static_cast<int>(stocks[s].strips.size());
+    }
+    stats.strip_waste.resize(stats.strip_start[count]);
+
+    std::vector<int> item_strip;
+    for (int s = 0; s < count; s++) {
+        const StockData& stock = stocks[s];
+        double* strip_waste = stats.strip_waste.data() + stats.strip_start[s];
+
+        double strip_area = 0;
+        for (size_t k = 0; k < stock.strips.size(); k++) {
+            strip_waste[k] = static_cast<double>(stock.strips[k].width) * stock_length;
+            strip_area += strip_waste[k];
+        }
+        AssignItemsToStrips(stock, item_strip);
+
+        double outside_items = 0;
+        for (size_t i = 0; i < stock.items.size(); i++) {
+            const ItemRect& item = stock.items[i];
+            double area = static_cast<double>(item.width) * item.length;
+            if (item_strip[i] >= 0) {
+                strip_waste[item_strip[i]] -= area;
+            } else {
+                outside_items += area;
+            }
+        }
+
+        // 利用率取方案中记录的 StockData::utilization, 与切割视图、方案对比一致
+        stats.utilization[s] = stock.utilization;
+        stats.waste_area[s] = sheet_area * (1.0 - stock.utilization);
+        stats.outside_waste[s] = sheet_area - strip_area - outside_items;
+        if (!stock.strips.empty()) {
+            stats.worst_strip[s] = static_cast<int>(
+                std::max_element(strip_waste, strip_waste + stock.strips.size()) - strip_waste);
+        }
+    }
+
+    // 按母板张数汇总
+    double utilization_sum = 0;
+    for (int s = 0; s < count; s++) {
+        long long sheets = stocks[s].multiplicity;
+        stats.histogram[UtilizationBin(stats.utilization[s])] += sheets;
+        stats.sheet_count += sheets;
+        stats.total_waste_area += stats.waste_area[s] * sheets;
+        utilization_sum += stats.utilization[s] * sheets;
+    }
+    if (count > 0) {
+        auto [lo, hi] = std::minmax_element(stats.utilization.begin(), stats.utilization.end());
+        stats.min_utilization = *lo;
+        stats.max_utilization = *hi;
+    }
+    if (stats.sheet_count > 0) {
+        stats.total_utilization = utilization_sum / stats.sheet_count;
+    }
+
+    stats.by_utilization.resize(count);
+    std::iota(stats.by_utilization.begin(), stats.by_utilization.end(), 0);
+    std::stable_sort(stats.by_utilization.begin(), stats.by_utilization.end(),
+                     [&stats](int a, int b) { return stats.utilization[a] < stats.utilization[b]; });
+
+    stats.elapsed_ms = timer.elapsed();
+    return stats;
+}
@@ -0,0 +1,55 @@
+// ============================================================================
+// 工程标准 (Engineering Standards)
+// - 坐标系: 左下角为原点
+// - 宽度(Width): 上下方向 (Y轴)
+// - 长度(Length): 左右方向 (X轴)
+// - 约束: 长度 >= 宽度
+// ============================================================================
+
+// waste_statistics.h - 利用率与浪费统计
+// 加载时对全部切割方式计算一次 (列式数组, 下标与 stocks 相同):
+//   每块母板的利用率 (取解文件记录的值) 与浪费面积, 浪费分为条带内 (每个条带) 与条带之外 (条带间隙与顶部余量)
+// 另按母板张数 (含重复次数) 汇总利用率分布与合计, 并给出按利用率升序的切割方式排名
+
+#ifndef WASTE_STATISTICS_H_
+#define WASTE_STATISTICS_H_
+
+#include <QtGlobal>
+#include <array>
+#include <vector>
+#include "cutting_data.h"
+
+constexpr int kUtilizationBins = 10;    // 利用率分布: [0, 10%), [10%, 20%), ..., [90%, 100%]
+
+struct WasteStatistics {
+    // 每个切割方式 (单张母板)
+    std::vector<double> utilization;        // StockData::utilization (0~1)
+    std::vector<double> waste_area;         // 母板面积 x (1 - 利用率)
+    std::vector<double> outside_waste;      // 条带之外的浪费
+    std::vector<int> worst_strip;           // 浪费最大的条带 (strips 下标), 无条带时为 -1
+
+    // 每个条带的浪费 (CSR: 切割方式 s 的条带在 [strip_start[s], strip_start[s + 1]), 顺序与 strips 相同)
+    std::vector<int> strip_start;
+    std::vector<double> strip_waste;
+
+    // 按母板张数汇总
+    std::array<long long, kUtilizationBins> histogram{};
+    long long sheet_count = 0;
+    double total_utilization = 0;           // 按母板张数加权的平均利用率
+    double total_waste_area = 0;
+    double min_utilization = 0;
+    double max_utilization = 0;
+
+    std::vector<int> by_utilization;        // 切割方式下标, 按利用率升序 (最差在前)
+    qint64 elapsed_ms = 0;
+
+    int size() const { return static_cast<int>(utilization.size()); }
+    bool empty() const { return utilization.empty(); }
+};
+
+// 利用率所在的分布区间
+int UtilizationBin(double utilization);
+
+WasteStatistics ComputeWasteStatistics(const std::vector<StockData>& stocks, int stock_width, int stock_length);
+
+#endif  // WASTE_STATISTICS_H_